@@ -65,6 +65,7 @@ int main(void)
 
     static snap_membus_t din_gmem[depth_in];  // 7 for 1, 2288 = for 732x25 x2 images bw fw
     static snap_membus_t dout_gmem[depth_out]; // 1
+    static snap_membus_t d_ddrmem[512]; // card DRAM, unused by the inference jobs of the testbench
 
     action_reg act_reg;
     action_RO_config_reg Action_Config;
@@ -73,7 +74,7 @@ int main(void)
     act_reg.Control.flags = 0x0;
 #ifndef VHLS_TB
     std::cout << "Discovery : calling action to get config data\n";
-    hls_action(din_gmem, dout_gmem, &act_reg, &Action_Config);
+    hls_action(din_gmem, dout_gmem, d_ddrmem, &act_reg, &Action_Config);
     fprintf(stdout,
 	    "ACTION_TYPE:   %08x\n"
 	    "RELEASE_LEVEL: %08x\n"
@@ -260,10 +261,12 @@ int main(void)
 		 */
 
 		act_reg.Control.flags = 0x1; /* just not 0x0 */
+		act_reg.Data.jobtype = JOB_INFER;
 
 		act_reg.Data.in.addr = 0;
 		act_reg.Data.in.size = total_pixels_in_action*sizeof(float);
 		act_reg.Data.in.type = SNAP_ADDRTYPE_HOST_DRAM;
+		act_reg.Data.informat = IN_FMT_FLOAT32;
 
 		act_reg.Data.out.addr = 0;
 		act_reg.Data.out.size = MAX_NUMBER_COLUMNS_TEST_SET*sizeof(unsigned int);
@@ -275,7 +278,7 @@ int main(void)
 
 		std::cout << "Action call \n";
 		std::cout << "act_reg.Data.imgcols.cols[0] = " << act_reg.Data.imgcols.cols[0] << std::endl;
-		hls_action(din_gmem, dout_gmem, &act_reg, &Action_Config);
+		hls_action(din_gmem, dout_gmem, d_ddrmem, &act_reg, &Action_Config);
 
 		tbhexdump(stdout, &act_reg.Data, sizeof(act_reg.Data));
 
@@ -56,8 +56,17 @@ DTYPE_IMG bytesToFloatA(char b0, char b1, char b2, char b3)
     return ret_value ;
 }
 
-// Cast a word from input port (512b) to a char* word (64B)
-void mbus_to_stream(snap_membus_t mem,
+DTYPE_IMG byteToFixed(char b0)
+{
+#pragma HLS INLINE
+    DTYPE_IMG ret_value = 0;
+    /* The byte is the raw DTYPE_IMG (ap_fixed<8,4>) casted by host (IN_FMT_PACKED8) */
+    *((char*)(&ret_value) + 0) = b0;
+    return ret_value ;
+}
+
+// Append a single pixel to the fw or bw stream (or array) of the image it belongs to
+static void pixel_to_stream(DTYPE_IMG f,
 #ifdef INTERFACE_IS_STREAM
 #ifdef MANY_STREAMS_FOR_MANY_ACCS
 							hls::stream<DTYPE_IMG> image_fw[ACC_CALLS_PER_ACTION],
@@ -87,34 +96,13 @@ void mbus_to_stream(snap_membus_t mem,
 #endif /* ACC_CALLS_PER_ACTION */
 							)
 {
-#pragma HLS INLINE off
-
-	assert(sizeof(float)==4);
-    snap_membus_t tmp = mem;
+#pragma HLS INLINE
 
 #if ACC_CALLS_PER_ACTION == 1
     const uint32_t img_id_val = 0;
     const uint32_t *img_id = &img_id_val;
 #endif /* ACC_CALLS_PER_ACTION */
 
-	union {
-    	float f;
-    	char b[sizeof(float)];
-    } u;
-    //u.f = 0.0;
-    DTYPE_IMG f;
-	char b0,b1,b2,b3;
-
-    loop_mbus_to_word:
-    for (unsigned char k = 0; k < sizeof(word_t); k+=4) {
-    //#pragma HLS UNROLL
-    	b0 = u.b[0] = tmp(7, 0);
-        b1 = u.b[1] = tmp(15, 8);
-        b2 = u.b[2] = tmp(23, 16);
-        b3 = u.b[3] = tmp(31, 24);
-        f = bytesToFloatA(b0,b1,b2,b3);
-        tmp = tmp >> 32;
-
     	//std::cout << "DEBUG in: global_a = " << global_a++ << ", pixels_all = " << pixels_all << \
     			", *pixels_fed = " << *pixels_fed << " ";
 
@@ -141,20 +129,19 @@ void mbus_to_stream(snap_membus_t mem,
 #ifdef INTERFACE_IS_STREAM
 #ifdef MANY_STREAMS_FOR_MANY_ACCS
         			image_fw[*img_id].write(f);
-        			//cast.f = (DTYPE_IMG)u.f;
         			//printf("write fw : %f in DTYP is %f (0x%x)\n", u.f, f, *b);
 #else /* MANY_STREAMS_FOR_MANY_ACCS */
-        			image_fw.write((DTYPE_IMG)u.f);
+        			image_fw.write(f);
         			write_fw++;
         			//std::cout << "write fw : " << u.f << std::endl;
 #endif /* MANY_STREAMS_FOR_MANY_ACCS */
 #else /* INTERFACE_IS_STREAM */
 #ifdef MANY_STREAMS_FOR_MANY_ACCS
-        			image_fw[*img_id][*addr_fw] = (DTYPE_IMG)u.f;
+        			image_fw[*img_id][*addr_fw] = f;
         			*addr_fw = *addr_fw + 1;
 #else /* MANY_STREAMS_FOR_MANY_ACCS */
         			//std::cout << " DEBUG *addr_fw = " << *addr_fw << std::endl;
-        			image_fw[*addr_fw] = (DTYPE_IMG)u.f;
+        			image_fw[*addr_fw] = f;
         			*addr_fw = *addr_fw + 1;
 #endif /* MANY_STREAMS_FOR_MANY_ACCS */
 
@@ -165,17 +152,17 @@ void mbus_to_stream(snap_membus_t mem,
 #ifdef MANY_STREAMS_FOR_MANY_ACCS
         			image_bw[*img_id].write(f);
 #else /* MANY_STREAMS_FOR_MANY_ACCS */
-        			image_bw.write((DTYPE_IMG)u.f);
+        			image_bw.write(f);
         			write_bw++;
         			//std::cout << "write bw : " << u.f << std::endl;
 #endif /* MANY_STREAMS_FOR_MANY_ACCS */
 #else /* INTERFACE_IS_STREAM */
 #ifdef MANY_STREAMS_FOR_MANY_ACCS
-        			image_bw[*img_id][*addr_bw] = (DTYPE_IMG)u.f;
+        			image_bw[*img_id][*addr_bw] = f;
         			*addr_bw = *addr_bw + 1;
 #else /* MANY_STREAMS_FOR_MANY_ACCS */
         			//std::cout << " DEBUG *addr_bw = " << *addr_bw << std::endl;
-        			image_bw[*addr_bw] = (DTYPE_IMG)u.f;
+        			image_bw[*addr_bw] = f;
         			*addr_bw = *addr_bw + 1;
 #endif /* MANY_STREAMS_FOR_MANY_ACCS */
 #endif /* INTERFACE_IS_STREAM */
@@ -186,6 +173,84 @@ void mbus_to_stream(snap_membus_t mem,
         	}
         	*pixels_fed = *pixels_fed + 1;
         }
+}
+
+#ifdef INTERFACE_IS_STREAM
+#define PIXEL_TO_STREAM_ARRAYS image_fw, image_bw
+#else /* INTERFACE_IS_STREAM */
+#define PIXEL_TO_STREAM_ARRAYS image_fw, image_bw, addr_fw, addr_bw
+#endif /* INTERFACE_IS_STREAM */
+#if ACC_CALLS_PER_ACTION > 1
+#define PIXEL_TO_STREAM_COUNTERS pixels_fed, pixels_all, pixels_fed_curr_img, pixels_curr_img, cols, img_id
+#else /* ACC_CALLS_PER_ACTION */
+#define PIXEL_TO_STREAM_COUNTERS pixels_fed, pixels_all
+#endif /* ACC_CALLS_PER_ACTION */
+
+// Cast a word from input port (512b) to a char* word (64B)
+void mbus_to_stream(snap_membus_t mem,
+#ifdef INTERFACE_IS_STREAM
+#ifdef MANY_STREAMS_FOR_MANY_ACCS
+							hls::stream<DTYPE_IMG> image_fw[ACC_CALLS_PER_ACTION],
+							hls::stream<DTYPE_IMG> image_bw[ACC_CALLS_PER_ACTION],
+#else /* MANY_STREAMS_FOR_MANY_ACCS */
+							hls::stream<DTYPE_IMG> &image_fw,
+							hls::stream<DTYPE_IMG> &image_bw,
+#endif /* MANY_STREAMS_FOR_MANY_ACCS */
+#else /* INTERFACE_IS_STREAM */
+#ifdef MANY_STREAMS_FOR_MANY_ACCS
+							DTYPE_IMG image_fw[ACC_CALLS_PER_ACTION][MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
+							DTYPE_IMG image_bw[ACC_CALLS_PER_ACTION][MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
+#else /* MANY_STREAMS_FOR_MANY_ACCS */
+							DTYPE_IMG image_fw[ACC_CALLS_PER_ACTION * MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
+							DTYPE_IMG image_bw[ACC_CALLS_PER_ACTION * MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
+#endif /* MANY_STREAMS_FOR_MANY_ACCS */
+							uint32_t *addr_fw,
+							uint32_t *addr_bw,
+#endif /* INTERFACE_IS_STREAM */
+							uint32_t *pixels_fed,
+							uint32_t pixels_all,
+#if ACC_CALLS_PER_ACTION > 1
+							uint32_t *pixels_fed_curr_img,
+							uint32_t *pixels_curr_img,
+							uint16_t cols[8],
+							uint32_t *img_id,
+#endif /* ACC_CALLS_PER_ACTION */
+							uint32_t informat
+							)
+{
+#pragma HLS INLINE off
+
+	assert(sizeof(float)==4);
+    snap_membus_t tmp = mem;
+
+    DTYPE_IMG f;
+	char b0,b1,b2,b3;
+
+#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
+	if (informat == IN_FMT_PACKED8) {
+		/* 64 raw DTYPE_IMG pixels per 512b word */
+		loop_mbus_to_packed:
+		for (unsigned char k = 0; k < sizeof(word_t); k++) {
+			b0 = tmp(7, 0);
+			f = byteToFixed(b0);
+			tmp = tmp >> 8;
+			pixel_to_stream(f, PIXEL_TO_STREAM_ARRAYS, PIXEL_TO_STREAM_COUNTERS);
+		}
+		return;
+	}
+#endif /* IMG_FLOAT_TO_FIXED_CASTING_IN_CPU */
+
+	/* 16 float slots per 512b word */
+    loop_mbus_to_word:
+    for (unsigned char k = 0; k < sizeof(word_t); k+=4) {
+    //#pragma HLS UNROLL
+    	b0 = tmp(7, 0);
+        b1 = tmp(15, 8);
+        b2 = tmp(23, 16);
+        b3 = tmp(31, 24);
+        f = bytesToFloatA(b0,b1,b2,b3);
+        tmp = tmp >> 32;
+        pixel_to_stream(f, PIXEL_TO_STREAM_ARRAYS, PIXEL_TO_STREAM_COUNTERS);
     }
 }
 
@@ -218,27 +283,159 @@ static snap_membus_t word_to_mbus_little_endian(uint32_t *vecPredictedStringInd)
 }
 
 
+// Replace the weights of the model by the NUMBER_OF_WEIGHTS floats of the input (JOB_LOAD_WEIGHTS),
+// 16 per 512b word. The inference jobs that follow run on them.
+static void load_weights(snap_membus_t *din_gmem,
+						 uint32_t size,
+						 action_reg *act_reg)
+{
+#pragma HLS INLINE off
+
+	uint32_t index, cnt_trans;
+	union {
+		uint32_t i;
+		float f;
+	} u;
+
+	if (size != NUMBER_OF_WEIGHTS * sizeof(float)) {
+		act_reg->Data.status |= ACC_ERR_WEIGHTS_SIZE;
+		return;
+	}
+
+	index = 0;
+	cnt_trans = 0;
+	main_loop_weights:
+	while (index < NUMBER_OF_WEIGHTS) {
+		const int tripcount = CEILING_POS((float)(NUMBER_OF_WEIGHTS * sizeof(float)) / sizeof(snap_membus_t));
+#pragma HLS LOOP_TRIPCOUNT min=tripcount max=tripcount
+		snap_membus_t tmp = (din_gmem + cnt_trans)[0];
+
+		loop_mbus_to_weights:
+		for (unsigned char k = 0; k < sizeof(word_t); k+=4) {
+#pragma HLS PIPELINE II=1
+			u.i = tmp(31, 0);
+			tmp = tmp >> 32;
+			if (index < NUMBER_OF_WEIGHTS)
+				Store_Weight(index, u.f);
+			index++;
+		}
+		cnt_trans++;
+	}
+
+	act_reg->Data.axitrans_in = cnt_trans;
+	act_reg->Data.status |= ACC_WEIGHTS_LOADED;
+}
+
+// Copy in.size bytes from the input to the output, each one in host or card DRAM after its type (JOB_COPY),
+// a 512b word at a time. The range in card DRAM shall be within CARD_DRAM_SIZE.
+static void copy_mem(snap_membus_t *din_gmem,
+					 snap_membus_t *dout_gmem,
+					 snap_membus_t *d_ddrmem,
+					 action_reg *act_reg)
+{
+#pragma HLS INLINE off
+
+	const bool from_card = (act_reg->Data.in.type == SNAP_ADDRTYPE_CARD_DRAM);
+	const bool to_card = (act_reg->Data.out.type == SNAP_ADDRTYPE_CARD_DRAM);
+	const uint64_t i_idx = act_reg->Data.in.addr >> ADDR_RIGHT_SHIFT;
+	const uint64_t o_idx = act_reg->Data.out.addr >> ADDR_RIGHT_SHIFT;
+	const uint64_t size = act_reg->Data.in.size;
+	const uint32_t words = (size + sizeof(snap_membus_t) - 1) / sizeof(snap_membus_t);
+	uint32_t cnt_trans;
+
+	if ((from_card && (act_reg->Data.in.addr + size > CARD_DRAM_SIZE)) ||
+		(to_card && (act_reg->Data.out.addr + size > CARD_DRAM_SIZE))) {
+		act_reg->Data.status |= ACC_ERR_SIZE_MISMATCH;
+		act_reg->Control.Retc = SNAP_RETC_FAILURE;
+		return;
+	}
+
+	main_loop_copy:
+	for (cnt_trans = 0; cnt_trans < words; cnt_trans++) {
+		const int max_tripcount = CARD_DRAM_SIZE / sizeof(snap_membus_t);
+#pragma HLS LOOP_TRIPCOUNT min=1 max=max_tripcount
+#pragma HLS PIPELINE II=1
+		snap_membus_t tmp = from_card ? (d_ddrmem + i_idx)[cnt_trans] : (din_gmem + i_idx)[cnt_trans];
+		if (to_card)
+			(d_ddrmem + o_idx)[cnt_trans] = tmp;
+		else
+			(dout_gmem + o_idx)[cnt_trans] = tmp;
+	}
+
+	act_reg->Data.axitrans_in = cnt_trans;
+	act_reg->Data.axitrans_out = cnt_trans;
+	act_reg->Control.Retc = SNAP_RETC_SUCCESS;
+}
+
+// Cast a 512b word to a descriptor of a batch, see blstm_desc_t
+static void mbus_to_desc(snap_membus_t mem, blstm_desc_t *desc)
+{
+#pragma HLS INLINE
+	desc->in_addr  = mem(63, 0);
+	desc->out_addr = mem(127, 64);
+	desc->in_size  = mem(159, 128);
+	desc->informat = mem(191, 160);
+	for (unsigned int i = 0; i < 8; i++) {
+#pragma HLS UNROLL
+		desc->imgcols.cols[i]   = mem(207 + 16 * i, 192 + 16 * i);
+		desc->imgstrlen.cols[i] = mem(335 + 16 * i, 320 + 16 * i);
+	}
+	desc->status   = mem(479, 448);
+	desc->pad      = mem(511, 480);
+}
+
+// Cast a descriptor of a batch to a 512b word, see blstm_desc_t
+static snap_membus_t desc_to_mbus(blstm_desc_t *desc)
+{
+#pragma HLS INLINE
+	snap_membus_t mem = 0;
+	mem(63, 0)    = desc->in_addr;
+	mem(127, 64)  = desc->out_addr;
+	mem(159, 128) = desc->in_size;
+	mem(191, 160) = desc->informat;
+	for (unsigned int i = 0; i < 8; i++) {
+#pragma HLS UNROLL
+		mem(207 + 16 * i, 192 + 16 * i) = desc->imgcols.cols[i];
+		mem(335 + 16 * i, 320 + 16 * i) = desc->imgstrlen.cols[i];
+	}
+	mem(479, 448) = desc->status;
+	mem(511, 480) = desc->pad;
+	return mem;
+}
+
 //----------------------------------------------------------------------
 //--- MAIN PROGRAM -----------------------------------------------------
 //----------------------------------------------------------------------
+// The images and the labels are in host or card DRAM after their types (card DRAM for the jobs of a batch)
 void process_action(snap_membus_t din_gmem[2288],
 			  snap_membus_t dout_gmem[46],
-			  /* snap_membus_t *d_ddrmem, *//* not needed */
+			  snap_membus_t *d_ddrmem,
 			  action_reg *act_reg)
 {
 #pragma HLS INLINE off
 
-	uint32_t size, bytes_to_transfer, pixels_all, pixels_fed, cnt_trans;
+	uint32_t size, bytes_to_transfer, pixels_all, pixels_fed, cnt_trans, informat, bytes_per_pixel;
 #if ACC_CALLS_PER_ACTION > 1
 	uint32_t size_from_cols_reg, pixels_fed_curr_img, pixels_curr_img, imgs, img_id;
 #endif /* ACC_CALLS_PER_ACTION */
 
 	uint64_t i_idx, o_idx;
+	const bool from_card = (act_reg->Data.in.type == SNAP_ADDRTYPE_CARD_DRAM);
+	const bool to_card = (act_reg->Data.out.type == SNAP_ADDRTYPE_CARD_DRAM);
 
 	/* byte address received need to be aligned with port width */
 	i_idx = act_reg->Data.in.addr >> ADDR_RIGHT_SHIFT;
 	o_idx = act_reg->Data.out.addr >> ADDR_RIGHT_SHIFT;
 	size = act_reg->Data.in.size;
+	informat = act_reg->Data.informat;
+
+	/* Dense format only when casting is done in CPU, else fall back to the float slots */
+#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
+	bytes_per_pixel = (informat == IN_FMT_PACKED8) ? sizeof(DTYPE_IMG) : sizeof(float);
+#else
+	informat = IN_FMT_FLOAT32;
+	bytes_per_pixel = sizeof(float);
+#endif /* IMG_FLOAT_TO_FIXED_CASTING_IN_CPU */
 
 
 	const unsigned int imgs_cols_regs_on_AXIl = sizeof(act_reg->Data.imgcols.cols)/sizeof(act_reg->Data.imgcols.cols[0]);
@@ -257,8 +454,8 @@ void process_action(snap_membus_t din_gmem[2288],
 		if (cols[i] != 0)
 			imgs++;
 	}
-	size_from_cols_reg = size_from_cols_reg << 3; // x2 for bw/fw, x4 for sizeof(float) in bytes
-	size_from_cols_reg *= HIGHT_IN_PIX;
+	size_from_cols_reg = size_from_cols_reg << 1; // x2 for bw/fw
+	size_from_cols_reg *= HIGHT_IN_PIX * bytes_per_pixel;
 
 	/* check that size on argument call is the actual size of all images reported to AXI registers */
 	assert(size == size_from_cols_reg);
@@ -282,7 +479,7 @@ void process_action(snap_membus_t din_gmem[2288],
 #endif /* VHLS_TB */
 #endif /* ACC_CALLS_PER_ACTION */
 
-	pixels_all = size/sizeof(float);
+	pixels_all = size/bytes_per_pixel;
 	pixels_fed = 0;
 	std::cout << "DEBUG: pixels to push to steam: " << pixels_all << "\n";
 
@@ -342,10 +539,10 @@ void process_action(snap_membus_t din_gmem[2288],
 
 		// Temporary workaround due to Xilinx memcpy issue - fixed in HLS 2017.4 */
 		//memcpy(&buffer_in, din_gmem + i_idx, sizeof(buffer_in));
-		buffer_in = (din_gmem + i_idx)[0];
+		buffer_in = from_card ? (d_ddrmem + i_idx)[0] : (din_gmem + i_idx)[0];
 
 		//std::cout << "DEBUG in: size = " << size << ", i_idx = " << i_idx << ", bytes_to_transfer = " << bytes_to_transfer << "\n";
-		/* cast 64B word buffer to a float[16] img and append to stream fifo */
+		/* cast 64B word buffer to a float[16] (or DTYPE_IMG[64]) img and append to stream fifo */
 		mbus_to_stream(	buffer_in,
 						image_fw,
 						image_bw,
@@ -354,14 +551,14 @@ void process_action(snap_membus_t din_gmem[2288],
 						&addr_bw,
 #endif
 						&pixels_fed,
-						pixels_all
+						pixels_all,
 #if ACC_CALLS_PER_ACTION > 1
-						,&pixels_fed_curr_img,
+						&pixels_fed_curr_img,
 						&pixels_curr_img,
 						cols,
-						&img_id
+						&img_id,
 #endif
-						);
+						informat);
 
 		//stream_buffer_in.write(buffer_in);
 		//stream_buffer_in[cnt_trans] = buffer_in;
@@ -470,7 +667,10 @@ void process_action(snap_membus_t din_gmem[2288],
 
 		// Temporary workaround due to Xilinx memcpy issue - fixed in HLS 2017.4 */
 		//memcpy(dout_gmem + o_idx, &buffer_out, sizeof(buffer_out));
-		(dout_gmem + o_idx)[0] = buffer_out;
+		if (to_card)
+			(d_ddrmem + o_idx)[0] = buffer_out;
+		else
+			(dout_gmem + o_idx)[0] = buffer_out;
 
 		size -= bytes_to_transfer;
 		o_idx++;
@@ -487,16 +687,96 @@ void process_action(snap_membus_t din_gmem[2288],
 	//return 0;
 }
 
+// Run the inference jobs of an action call, through the single instance of process_action(): the job of
+// the registers (JOB_INFER), or every descriptor of the table in card DRAM (JOB_INFER_BATCH). The jobs
+// of a batch infer images in card DRAM, their labels go to card DRAM and their lengths and status back
+// into their descriptors. A single action call infers the whole batch staged by the host (JOB_COPY),
+// and fails if any of its jobs does.
+static void process_jobs(snap_membus_t *din_gmem,
+						 snap_membus_t *dout_gmem,
+						 snap_membus_t *d_ddrmem,
+						 action_reg *act_reg)
+{
+#pragma HLS INLINE off
+
+	const bool batch = (act_reg->Data.jobtype == JOB_INFER_BATCH);
+	const uint64_t d_idx = act_reg->Data.in.addr >> ADDR_RIGHT_SHIFT;
+	const uint32_t jobs = batch ? act_reg->Data.in.size / sizeof(snap_membus_t) : 1;
+	action_reg job_reg;
+	blstm_desc_t desc;
+	uint32_t cnt_job, errors = 0;
+
+	/* The table of descriptors shall be whole, and within card DRAM */
+	if (batch && ((act_reg->Data.in.type != SNAP_ADDRTYPE_CARD_DRAM) ||
+				  (act_reg->Data.in.size % sizeof(snap_membus_t) != 0) ||
+				  (act_reg->Data.in.addr + act_reg->Data.in.size > CARD_DRAM_SIZE))) {
+		act_reg->Data.status |= ACC_ERR_DESC;
+		act_reg->Control.Retc = SNAP_RETC_FAILURE;
+		return;
+	}
+
+	main_loop_jobs:
+	for (cnt_job = 0; cnt_job < jobs; cnt_job++) {
+		const int max_tripcount = CARD_DRAM_SIZE / (ACC_CALLS_PER_ACTION * 2 * HIGHT_IN_PIX * sizeof(snap_membus_t));
+#pragma HLS LOOP_TRIPCOUNT min=1 max=max_tripcount
+		if (batch) {
+			/* The images and the labels of the action are in card DRAM */
+			mbus_to_desc((d_ddrmem + d_idx)[cnt_job], &desc);
+			memset(&job_reg, 0, sizeof(job_reg));
+			job_reg.Data.in.addr = desc.in_addr;
+			job_reg.Data.in.size = desc.in_size;
+			job_reg.Data.in.type = SNAP_ADDRTYPE_CARD_DRAM;
+			job_reg.Data.out.addr = desc.out_addr;
+			job_reg.Data.out.size = ACC_CALLS_PER_ACTION * MAX_PREDICTED_STRING_LENGTH * sizeof(uint32_t);
+			job_reg.Data.out.type = SNAP_ADDRTYPE_CARD_DRAM;
+			job_reg.Data.informat = desc.informat;
+			job_reg.Data.jobtype = JOB_INFER;
+			job_reg.Data.imgcols = desc.imgcols;
+		}
+		else
+			job_reg = *act_reg;
+
+		/* The images and the labels in card DRAM shall be within it */
+		if (((job_reg.Data.in.type == SNAP_ADDRTYPE_CARD_DRAM) &&
+			 (job_reg.Data.in.addr + job_reg.Data.in.size > CARD_DRAM_SIZE)) ||
+			((job_reg.Data.out.type == SNAP_ADDRTYPE_CARD_DRAM) &&
+			 (job_reg.Data.out.addr + job_reg.Data.out.size > CARD_DRAM_SIZE))) {
+			job_reg.Data.status |= ACC_ERR_DESC;
+			job_reg.Control.Retc = SNAP_RETC_FAILURE;
+		}
+		else
+			process_action(din_gmem, dout_gmem, d_ddrmem, &job_reg);
+
+		if (batch) {
+			desc.imgstrlen = job_reg.Data.imgstrlen;
+			desc.status = job_reg.Data.status;
+			(d_ddrmem + d_idx)[cnt_job] = desc_to_mbus(&desc);
+			/* The errors of every action are reported on the batch too */
+			errors |= job_reg.Data.status & ACC_ERR_MASK;
+		}
+		else
+			*act_reg = job_reg;
+	}
+
+	if (batch) {
+		act_reg->Data.axitrans_in = cnt_job;
+		act_reg->Data.status |= errors | ACC_BATCH_EXECUTED;
+		act_reg->Control.Retc = errors ? SNAP_RETC_FAILURE : SNAP_RETC_SUCCESS;
+	}
+}
+
 //--- TOP LEVEL MODULE -------------------------------------------------
 void hls_action(snap_membus_t *din_gmem,
 		snap_membus_t *dout_gmem,
-		/* snap_membus_t *d_ddrmem, */ /* if unused => export SDRAM_USED=FALSE */
+		snap_membus_t *d_ddrmem,
 		action_reg *act_reg,
 		action_RO_config_reg *Action_Config)
 {
 #pragma HLS INLINE off
 	// Host Memory AXI Interface
-const int depth_in = CEILING_POS((float)(ACC_CALLS_PER_ACTION * 2 * MAX_NUMBER_COLUMNS_TEST_SET*HIGHT_IN_PIX*sizeof(float))/sizeof(snap_membus_t));
+const int depth_img = CEILING_POS((float)(ACC_CALLS_PER_ACTION * 2 * MAX_NUMBER_COLUMNS_TEST_SET*HIGHT_IN_PIX*sizeof(float))/sizeof(snap_membus_t));
+const int depth_weights = CEILING_POS((float)(NUMBER_OF_WEIGHTS*sizeof(float))/sizeof(snap_membus_t));
+const int depth_in = (depth_img > depth_weights) ? depth_img : depth_weights; /* images or a model (JOB_LOAD_WEIGHTS) */
 #pragma HLS INTERFACE m_axi port=din_gmem bundle=host_mem offset=slave depth=depth_in \
   max_read_burst_length=64 max_write_burst_length=64
 #pragma HLS INTERFACE s_axilite port=din_gmem bundle=ctrl_reg offset=0x030
@@ -507,11 +787,13 @@ const int depth_out = CEILING_POS((float)(ACC_CALLS_PER_ACTION * MAX_PREDICTED_S
 #pragma HLS INTERFACE s_axilite port=dout_gmem bundle=ctrl_reg offset=0x040
 
 	std::cout << "DEBUG: AXI master interface with width = " << sizeof(snap_membus_t) << " bytes, depth_in = " << depth_in << ", depth_out = " << depth_out << "\n";
-/*	// DDR memory Interface
- * #pragma HLS INTERFACE m_axi port=d_ddrmem bundle=card_mem0 offset=slave depth=512 \
- *   max_read_burst_length=64  max_write_burst_length=64
- * #pragma HLS INTERFACE s_axilite port=d_ddrmem bundle=ctrl_reg offset=0x050
- */
+	// DDR memory Interface: the batches staged by the host (JOB_COPY, JOB_INFER_BATCH).
+	// The depth only sizes the port for C/RTL co-simulation, after the d_ddrmem[512] of hw/action_blstm_tb.cpp:
+	// the action addresses all of CARD_DRAM_SIZE.
+#pragma HLS INTERFACE m_axi port=d_ddrmem bundle=card_mem0 offset=slave depth=512 \
+  max_read_burst_length=64  max_write_burst_length=64
+#pragma HLS INTERFACE s_axilite port=d_ddrmem bundle=ctrl_reg offset=0x050
+
 	// Host Memory AXI Lite Master Interface
 #pragma HLS DATA_PACK variable=Action_Config
 #pragma HLS INTERFACE s_axilite port=Action_Config bundle=ctrl_reg offset=0x010
@@ -540,8 +822,19 @@ const int depth_out = CEILING_POS((float)(ACC_CALLS_PER_ACTION * MAX_PREDICTED_S
 		/* Update MMIO status register */
 		act_reg->Data.status |= PROCESS_INIT;
 
-        process_action(din_gmem, dout_gmem, act_reg);
-        /* process_action(din_gmem, dout_gmem, d_ddrmem, act_reg); */
+		switch (act_reg->Data.jobtype) {
+		case JOB_LOAD_WEIGHTS:
+			/* A model to load, nothing to infer: read straight off the host bus, whose depth covers it */
+			load_weights(din_gmem + (act_reg->Data.in.addr >> ADDR_RIGHT_SHIFT), act_reg->Data.in.size, act_reg);
+			act_reg->Control.Retc = (act_reg->Data.status & ACC_ERR_WEIGHTS_SIZE) ? SNAP_RETC_FAILURE : SNAP_RETC_SUCCESS;
+			break;
+		case JOB_COPY:
+			copy_mem(din_gmem, dout_gmem, d_ddrmem, act_reg);
+			break;
+		default:
+			process_jobs(din_gmem, dout_gmem, d_ddrmem, act_reg);
+			break;
+		}
 
     	/* Update MMIO status register */
     	act_reg->Data.status |= PROCESS_EXECUTED;
@@ -125,6 +125,21 @@ int main(int argc, const char* argv[])
 
 #endif
 
+  // RECIPROCAL LUT, of the mantissa m in [1, 2): the value at the middle of each interval
+  fprintf(fp, "\n/* Look-up table for the approximation of 1.0/m, 1 <= m < 2 */\n");
+  fprintf(fp, "\n#ifndef RECIP_LUT_H\n#define RECIP_LUT_H\n");
+  fprintf(fp, "\n/* Bits:%d, Size:%d */\n", (int)LUT_BITS_RECIP, (int)LUT_SIZE_RECIP);
+  fprintf(fp, " static DTYPE_RECIP recip_lut[LUT_SIZE_RECIP] = {");
+  for(i = 0; i < LUT_SIZE_RECIP; i++) {
+    x = 1.0 + (i + 0.5) / LUT_SIZE_RECIP;
+    y = 1.0 / x;
+    fprintf(fp, "%.15f", (float)y);
+    if (i != LUT_SIZE_RECIP-1)
+      fprintf(fp, ", ");
+    else
+      fprintf(fp, "};\n");
+  }
+  fprintf(fp, "\n#endif\n");
 
 
 
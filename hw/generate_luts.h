@@ -82,6 +82,18 @@
   * */
 #define LUT_SIZE_EXPF 256
 
+/*!
+ * \def LUT_BITS_RECIP
+ * The leading fraction bits of the mantissa (in [1, 2)) that index the reciprocal LUT.
+ * */
+#define LUT_BITS_RECIP 6
+
+/*!
+ * \def LUT_SIZE_RECIP
+ * The size in values of the reciprocal LUT.
+ * */
+#define LUT_SIZE_RECIP (1 << LUT_BITS_RECIP)
+
 /*!
  * \def PWL_SIZE_EXPF
  * The piecewise linear step size of exp() function.
@@ -0,0 +1,45 @@
+/****************************************************************************
+   Copyright 2018 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH. All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file model_projection.h
+ * @brief The weights of the non-recurrent inputs of the hidden layers (bias and pixels), i.e. the first
+ * NUMBER_OF_INPUTS_NONRECURRENT of every neuron in model.h, for the input projection stage alone
+ * (INPUT_PROJECTION_STAGE). Being its own ROMs, they leave the weight ROMs of model.h to the recurrence
+ * stage, and the two dataflow stages share no memory.
+ * */
+
+
+#ifndef MODEL_PROJECTION_H
+#define MODEL_PROJECTION_H
+
+/* The inputs of a cell that do not depend on the previous column: 1.0 + the pixels of the column */
+#define NUMBER_OF_INPUTS_NONRECURRENT (1 + HIGHT_IN_PIX)
+
+// forward network input weights
+static DTYPE_WEIGHTS_WGI_fw WGI_fw_in[NUMBER_OF_NEURONS][NUMBER_OF_INPUTS_NONRECURRENT] = {{0.0436908,0.0820919,-0.0583287,-0.0535142,-0.0585895,-0.0604027,-0.0876737,-0.0664874,0.0261505,0.0886946,-0.0151176,-0.0546744,-0.186026,-0.0211434,-0.162925,-0.0343479,-0.0662033,0.0235734,-0.016807,0.00228257,0.115908,0.17263,0.0401789,0.0762886,0.00233701,-0.0125738},{0.504844,0.105689,-0.278256,-0.359324,-0.41652,-0.229343,-0.181184,-0.270136,-0.0353034,-0.257385,-0.327747,-0.32912,-0.129801,-0.274128,-0.477995,-0.570746,-0.519774,-0.432741,-0.432902,-0.348263,-0.190828,-0.104726,-0.148439,-0.249189,-0.326355,0.0999201},{-0.137363,0.010959,0.0471018,-0.00223139,-0.0308898,0.0215428,0.123833,0.286027,0.360703,0.461409,0.302951,0.102382,0.120728,0.18571,0.249338,-0.0244123,-0.0586412,0.0650903,0.150563,0.188236,0.1404,0.0386292,0.281092,0.218586,-0.127591,-0.0828352},{0.148579,-0.0231801,-0.0534844,0.00498697,0.186592,0.10055,0.173315,0.108585,0.140347,0.037837,-0.0255033,0.107428,0.0992422,0.251354,0.169319,0.107545,0.201437,0.241631,0.125554,0.164258,0.0924307,0.0581485,0.139226,0.141004,-0.0529927,-0.0766044},{0.0410662,-0.0439992,0.138302,0.0766019,0.0619867,-0.141127,-0.106705,-0.093144,-0.213663,-0.10393,0.130499,0.189937,0.373458,0.521052,0.492782,0.369282,0.412037,0.244579,-0.0546142,-0.25282,-0.172348,-0.260727,-0.356385,-0.234804,0.107528,-0.118923},{0.152992,-0.106091,-0.147348,-0.341242,-0.268788,-0.221608,0.0201962,-0.0189373,0.0894236,0.0556997,-0.13813,0.00534293,-0.00557451,-0.0464667,-0.183238,-0.208778,-0.028888,0.0421781,0.0599454,-0.0515047,0.0607881,-0.105925,-0.293668,-0.589298,-0.306616,-0.022064},{0.11289,0.0447417,0.058524,-0.0301864,-0.0251817,-0.0115971,-0.31812,-0.250792,-0.117556,-0.0533191,0.175411,0.176124,0.281699,0.276526,0.177808,0.0449476,0.0944333,0.07878,0.355836,0.39902,0.280877,-0.0199759,-0.0669365,-0.102796,0.049102,0.142047},{0.272628,0.00317296,0.0175363,-0.0917346,0.024194,0.071641,0.275088,0.235815,0.20261,0.0952669,-0.103702,-0.16971,-0.0873549,-0.0264738,0.192426,0.100597,0.120768,0.0181815,-0.11809,-0.124234,-0.333194,0.0415487,0.217005,0.162994,0.0584602,-0.0799595},{0.587471,-0.0710102,-0.25692,-0.505373,-0.773836,-0.514184,-0.187813,-0.351384,-0.424215,-0.582362,-0.825717,-0.742713,-0.605335,-0.578135,-0.646131,-0.487318,-0.482696,-0.583149,-0.395902,-0.272584,-0.252281,-0.368137,-0.486708,-0.292362,-0.162881,0.159128},{0.152354,-0.0127193,0.0776246,0.0838083,0.0825959,-0.0247223,-0.228982,-0.15571,-0.0868724,0.066354,0.0117742,0.107493,0.196308,0.220443,0.165142,-0.0337952,0.0674926,0.1158,0.192664,0.0983367,0.126231,0.102038,-0.0142648,0.0702397,0.0651486,0.0915128},{0.419219,0.0770137,0.07959,0.0905128,0.109403,0.137839,0.0813523,-0.0263269,-0.168246,0.013235,0.0104427,-0.025557,-0.243557,-0.175446,-0.242457,-0.303524,-0.375588,-0.36528,-0.376565,-0.221427,0.0168651,0.046532,-0.0205984,-0.181228,0.0279606,0.0670288},{-0.0241965,-0.16111,-0.180644,-0.157427,0.0166449,0.219029,0.383063,0.373865,0.361126,0.315171,0.113284,-0.0805154,-0.0196772,0.0395997,-0.0420195,-0.0129864,0.262843,0.33216,0.231279,0.103132,-0.100525,0.049403,0.289574,0.29845,0.0514883,-0.165235},{0.0491607,0.0200276,-0.0548233,-0.167572,-0.260648,0.00531879,0.2548,0.277184,0.0212414,0.10868,0.130027,0.0366883,-0.0324416,-0.126168,-0.327283,-0.440167,-0.409286,-0.33409,0.0303905,0.162982,0.217816,0.400935,0.299626,0.245569,0.00341842,-0.154833},{0.0934083,-5.16249e-05,0.00419898,0.00954173,-0.0281977,0.116721,0.245006,0.371741,0.169768,0.0270835,-0.143189,-0.531244,-0.740344,-0.210788,0.254004,0.418743,0.157759,-0.330939,-0.153947,-0.176943,-0.118282,0.0096489,0.165285,0.0384124,-0.0210483,0.00858786},{0.195698,-0.163806,-0.167951,-0.208912,-0.27358,-0.00895412,-0.0176587,-0.127191,-0.133267,-0.266592,-0.119474,-0.123395,-0.146556,-0.236792,-0.26203,-0.257736,-0.164447,-0.145781,-0.134633,0.0120371,0.140134,0.116202,-0.00131545,8.71921e-06,-0.155231,0.10219},{0.193627,0.0347623,-0.109018,-0.048209,-0.0309221,0.216853,0.152152,0.284374,0.0563638,0.125795,-0.00287196,0.0295022,0.128353,0.0504487,-0.0163695,0.0177683,0.0934333,0.193192,0.239161,0.24268,0.207495,0.0636927,0.0668238,0.0732738,-0.115404,-0.103748},{0.120896,0.0260017,0.0392515,-0.0966568,0.0589773,-0.00656237,-0.013886,0.0151079,-0.0970344,-0.0417547,-0.0118396,-0.068513,-0.0912846,-0.0944831,-0.0499167,0.0362589,-0.00713983,0.0138639,-0.0349949,-0.0707084,0.00906764,-0.098396,-0.181272,-0.00654876,-0.0893168,-0.058675},{0.0510752,-0.0452932,-0.00289277,-0.0199617,-0.0720391,-0.0964383,-0.170117,-0.231238,-0.0556186,-0.0715215,-0.219214,-0.327427,-0.338473,-0.47633,-0.45997,-0.249877,-0.2434,-0.131975,-0.188688,-0.115689,0.00216179,0.149456,0.0252366,-0.0340683,-0.0393059,0.0057138},{-0.116175,-0.0141128,-0.0534463,-0.0256414,0.0330377,0.0511213,-0.0341057,0.161588,0.156858,0.140991,0.0996473,0.0752488,-0.00671395,-0.0279278,-0.0933926,-0.0871127,0.0233043,0.3056,0.561136,0.402544,0.00850614,0.19172,0.240514,0.113583,-0.0342528,-0.093945},{0.0455376,0.0735613,-0.0518068,-0.0104271,0.00735372,0.00372056,0.0315167,-0.0589006,-0.139145,-0.0698362,-0.151245,0.146294,0.562925,0.443463,0.189713,0.131275,0.00581697,-0.612377,-1.0613,-0.766086,-0.418228,-0.00352747,0.220209,0.124825,0.142995,0.0257126},{0.229596,0.00211264,0.0274328,-0.127286,0.0604047,0.283413,0.145762,0.0753194,-0.00497395,-0.182025,-0.26723,-0.277218,-0.0822879,0.0679613,0.0721656,0.00462342,-0.0703806,-0.340181,-0.404891,-0.348314,-0.187828,0.0986845,0.16408,0.304895,0.125022,-0.0540157},{0.0900391,-0.041813,5.47136e-06,-0.116753,-0.124897,-0.174592,-0.277769,-0.0815082,-0.0776085,0.0385136,-0.0738127,-0.200116,-0.103175,0.0641075,0.267456,0.260988,0.140772,0.168882,0.157605,-0.198541,-0.210581,0.281388,0.693614,0.377287,0.00295952,-0.0975895},{0.16192,0.0538504,0.123002,-0.0201751,0.00291082,0.0114803,-0.0195494,-0.0187595,0.137427,0.0510112,-0.0322155,0.0263675,0.113585,-0.266003,-0.824032,-0.668882,-0.230204,-0.0934321,-0.477542,-0.221345,-0.0461158,-0.0779751,0.0341112,-0.0036773,0.0184666,0.00128866},{0.161183,-0.00316631,-0.00305304,0.0803904,0.0403803,0.226433,0.265774,0.167514,0.0428082,-0.185301,-0.276376,-0.156012,-0.115608,-0.0489839,0.181866,0.241331,0.0515929,-0.0513881,-0.0752987,-0.000752986,0.0642484,0.0788578,-0.00154103,-0.0371492,-0.136765,0.0280655},{0.176568,-0.0732519,-0.066101,-0.195552,-0.0581277,0.0145442,-0.0547145,0.139666,0.129443,0.0773329,-0.0360684,-0.259891,-0.273682,-0.619556,-0.5615,-0.548381,-0.280402,-0.169926,-0.172517,0.0955981,0.130073,-0.0270551,-0.0879776,-0.0079725,0.0155506,-0.0199062},{-0.0484985,0.110109,0.0660088,0.272143,0.475337,0.251708,0.36839,0.341819,0.272501,0.28928,0.483637,0.460529,0.355723,0.25289,0.271603,0.122492,0.268991,0.303237,0.547961,0.463826,0.341411,0.307453,0.211728,0.209539,0.0710618,-0.126695},{-0.213498,0.0539899,0.162208,0.228422,0.0793611,0.0339853,0.104778,0.0536556,-0.022417,-0.177517,-0.109649,0.0290571,0.196951,0.325571,0.33116,0.245121,0.179252,0.032759,-0.0254031,-0.0601625,-0.0969526,-0.0102215,0.0591949,-0.0213751,-0.120564,0.0864517},{0.297371,-0.0410207,0.00407868,0.00714202,0.00540207,-0.0586581,0.01974,-0.0591491,0.0557298,0.0154952,-0.0484009,0.0286219,-0.0442873,-0.0365291,-0.185545,-0.138375,-0.160386,-0.133813,-0.139719,-0.071559,-0.0645578,0.0321183,-0.032641,-0.0699116,-0.0655426,-0.0582499},{0.270935,-0.131323,-0.149827,-0.0426449,-0.295924,-0.106866,0.0273413,-0.025871,-0.0533956,-0.0917437,0.0195824,-0.21872,-0.239102,-0.274605,-0.187372,-0.185692,-0.178494,-0.151223,-0.0178648,-0.0165642,-0.140424,-0.0243948,-0.127726,-0.175628,-0.206329,-0.199971},{0.282464,-0.0315003,0.0119789,-0.0316405,-0.317475,-0.339241,-0.267177,0.0497324,-0.0432219,-0.416363,-0.68348,-0.501883,-0.285282,-0.181847,-0.340732,-0.281626,-0.2281,-0.112862,-0.0677001,0.037328,0.155506,0.00346645,-0.085721,-0.237454,0.0601676,0.267553},{0.248536,0.0160328,-0.142025,-0.100414,-0.0291518,0.0144739,-0.139791,0.0907227,0.0699396,-0.0567825,0.0320833,-0.00463279,0.123825,0.0248721,0.190933,0.0396396,0.0116074,0.204603,0.307661,0.324094,0.215784,0.197363,-0.0125971,-0.195106,-0.0944362,0.212192},{0.869254,-0.252093,-0.35215,-0.759377,-1.03991,-0.54901,-0.111351,-0.0730746,-0.186577,-0.405904,-0.832248,-0.894658,-0.707451,-0.543315,-0.581546,-0.71509,-0.713088,-0.978073,-1.13721,-0.941648,-0.575033,-0.251843,-0.254967,-0.424014,-0.325427,0.241801},{0.0669202,-0.0160245,0.029742,-0.106431,-0.0103822,-0.13663,-0.166901,-0.0138657,-0.0363534,-0.00921757,-0.138443,-0.0913734,0.0464956,0.154499,0.0169535,0.110299,0.0966995,0.109778,-0.00604971,-0.00121704,0.143411,0.0541008,0.0250022,-0.0445892,-0.0695944,-0.0268985},{0.584762,-0.543592,-0.46492,-0.67126,-1.02782,-0.841688,-0.295037,-0.137355,-0.100582,-0.183104,-0.511339,-0.736245,-0.724189,-0.752836,-0.514077,-0.734003,-0.752997,-0.801965,-0.687933,-0.531669,-0.398288,-0.186604,-0.298263,-0.316435,-0.454336,-0.194346},{0.223927,-0.0944409,0.0507809,0.0687064,-0.00617737,-0.133868,-0.130622,-0.189035,-0.157991,-0.091329,-0.0337714,-0.20608,-0.311605,-0.269615,-0.215169,-0.314374,-0.253945,-0.116535,-0.154203,-0.242341,-0.055312,-0.0446517,0.0546951,0.115647,-0.0181465,0.0384381},{0.48627,-0.0384896,-0.243273,-0.443219,-0.913598,-0.725986,-0.323356,-0.279714,-0.25656,-0.364245,-0.544168,-0.625844,-0.688443,-0.515099,-0.587476,-0.559743,-0.646664,-0.584135,-0.567827,-0.614443,-0.566073,-0.456656,-0.484362,-0.683444,-0.47233,0.0675536},{0.131989,0.0235298,-0.0888849,0.0595183,-0.0524765,-0.165154,-0.339787,-0.316078,-0.270575,0.0426739,0.301426,0.484013,0.632798,0.371255,0.195371,0.0435392,0.0333034,-0.104555,-0.0711083,0.230335,0.209819,0.250185,0.211139,0.178731,0.135059,-0.00914881},{0.088107,-0.0258127,-0.0849313,-0.164422,-0.180154,0.0730702,0.124198,0.201965,0.371198,0.387674,0.0204015,-0.0337656,-0.0148904,-0.0206968,0.0225004,0.148959,-0.0604558,-0.0298376,-0.086867,-0.10439,-0.380136,-0.0701977,0.226522,0.295823,-0.0517165,0.0334643},{0.162895,-0.0571821,-0.0158381,0.00758805,-0.233508,-0.186499,-0.15109,-0.105264,-0.138481,-0.167975,-0.361811,-0.237999,-0.29122,-0.280284,-0.451548,-0.434097,-0.347665,-0.144996,-0.0361462,-0.153315,-0.0510302,-0.00394407,0.0178522,0.0590098,0.13756,0.0336615},{0.173703,-0.195573,0.343728,0.147214,0.180561,0.372212,0.190801,0.194715,0.0131789,0.0569529,0.170035,0.140618,0.247627,0.252029,0.0731942,0.141508,0.00722019,-0.0485232,0.121346,0.206591,0.327224,0.236695,0.184234,0.146495,0.159289,0.112486},{-0.0521736,-0.0647819,-0.102407,-0.179295,-0.00571375,0.1671,0.237593,0.258769,0.291718,0.272505,0.316635,0.0035484,-0.0539297,-0.0284262,0.15494,0.2386,0.325379,0.254246,0.223051,0.368698,0.172845,-0.0131178,0.0450584,0.213262,-0.0265483,-0.0355892},{0.170607,0.0194792,0.00734533,0.0574798,-0.0150547,-0.0468687,0.0285068,0.0740582,0.168759,0.305965,0.0980207,-0.0523429,-0.0422591,-0.0198451,-0.0918516,-0.11659,0.112752,0.142243,0.0266653,0.0791068,0.200011,0.117723,-0.117221,-0.281413,-0.169348,0.0764689},{0.187368,-0.0328901,-0.0523035,-0.110477,-0.189627,-0.2121,-0.281828,-0.174341,-0.180663,-0.0821562,-0.0639683,-0.265949,-0.272732,-0.275952,-0.206747,-0.135368,-0.199797,-0.0969171,-0.145407,-0.112402,-0.00643796,-0.0570731,0.0680229,-0.136821,-0.0341236,-0.124208},{0.501469,-0.0186993,-0.124937,-0.412314,-0.519745,-0.0341091,-0.0094888,0.0670499,-0.0725056,-0.306915,-0.38585,-0.405522,-0.455278,-0.508635,-0.296077,-0.246027,-0.235263,-0.327784,-0.255059,-0.198678,-0.147618,-0.0498874,-0.253454,-0.264279,-0.32964,0.0813029},{0.350196,-0.0369473,0.124852,0.0291773,-0.0287693,-0.00107383,-0.0875392,-0.121921,-0.0446723,-0.175075,-0.267961,-0.32362,-0.271029,-0.410807,-0.352344,-0.34123,-0.189024,-0.121131,0.00384022,-0.0723448,-0.0588855,0.140542,0.0708606,0.00706892,0.0245123,0.0556808},{0.201675,0.0674592,0.122817,0.0684923,-0.078661,0.00847234,0.047952,-0.0868198,-0.0455312,0.152124,0.153443,0.145077,0.101074,0.194527,0.0658071,-0.0593866,-0.0241275,-0.225877,-0.280833,-0.107315,0.0462692,0.0273315,0.00789596,0.0179543,0.0139974,0.0426821},{0.241676,-0.000941532,0.0554289,0.00303588,-0.404132,-0.256613,-0.189066,0.116438,0.200867,0.13534,0.0501218,-0.00775695,-0.0675065,-0.0961652,-0.224848,-0.215145,-0.330671,-0.224483,-0.0511766,-0.132365,-0.0452362,0.154748,0.287652,0.0806956,-0.0651354,0.0791838},{0.0542075,0.0125584,0.0483739,0.0595641,-0.0523524,-0.0581184,-0.0441356,0.0267224,0.437628,0.361945,-0.0640194,-0.290725,-0.23884,0.0886638,0.137668,-0.0225744,-0.147853,-0.172022,-0.387325,-0.347576,0.0220448,0.068927,-0.252719,-0.053883,-0.00427996,0.0498509},{0.715052,-0.0985516,-0.351168,-0.490276,-0.993718,-0.911265,-0.368696,-0.115272,-0.235868,-0.451641,-0.598855,-0.619433,-0.523793,-0.500264,-0.442923,-0.60423,-0.516813,-0.612831,-0.612697,-0.629638,-0.478422,-0.438961,-0.455952,-0.717902,-0.615373,-0.269574},{0.148977,-0.0563368,-0.0295322,0.0861321,-0.0511869,-0.120477,-0.18525,-0.218332,-0.131996,0.19385,0.107768,0.122469,0.0544443,0.235612,0.092703,0.0185565,-0.163926,-0.28567,-0.475517,-0.58618,-0.56393,-0.132457,0.0365718,-0.0202589,0.0958372,-0.126588},{0.379481,-0.0687911,-0.0426899,-0.083809,-0.18155,-0.194927,-0.478509,-0.303977,-0.220483,-0.0612806,-0.157825,-0.301061,-0.253735,-0.105608,0.094751,0.107872,0.0617576,-0.00926441,0.0985946,0.178222,0.165373,0.18316,-0.0107477,-0.0412867,-0.0322787,0.191785},{0.133934,0.0349586,0.00184244,-0.202434,0.0533598,0.274068,0.243756,0.0330674,0.0514905,0.147152,0.13452,0.0703007,0.260854,0.268113,-0.0357078,-0.172475,-0.129582,-0.286998,-0.186553,0.0361452,0.134739,0.233793,0.13151,0.115441,-0.090331,0.0436688},{0.905359,-0.119954,-0.423744,-0.857103,-1.29802,-0.859624,-0.453743,-0.412413,-0.592185,-0.458828,-0.681638,-0.75622,-0.757166,-0.792874,-0.817073,-0.856142,-0.849459,-0.987815,-0.968089,-0.740516,-0.480353,-0.586004,-0.439393,-0.445313,-0.527607,0.0676837},{0.656396,0.0368945,-0.0506743,-0.0523254,-0.407784,-0.194253,-0.18975,-0.304666,-0.395965,-0.081202,-0.0760719,-0.177319,-0.208959,-0.289198,-0.380538,-0.307286,-0.248462,-0.278564,-0.203239,-0.388109,-0.342881,-0.137927,-0.0627153,-0.0955129,-0.0263018,0.214699},{0.254954,-0.0156441,-0.0150046,-0.157931,-0.221974,0.0321667,0.179936,-0.11514,-0.0328534,0.179794,0.0744497,0.0929587,0.217668,0.196711,0.306157,0.506282,0.475294,0.0598714,-0.434983,-0.397063,-0.461038,-0.365897,-0.08407,0.145555,-0.0269407,0.00644983},{0.218774,-0.0587147,0.119991,-0.05272,0.0930897,0.0184559,-0.12665,-0.112532,-0.09186,-0.108802,-0.143877,-0.0175999,-0.0287852,-0.223639,-0.188919,-0.427397,-0.425123,-0.330953,-0.228398,-0.207187,-0.170967,-0.207451,-0.164998,-0.190688,-0.0402591,0.0464934},{0.19945,-0.0290615,-0.0175199,-0.0445866,-0.0501424,0.110237,0.00259215,0.00956191,0.0344384,0.0128384,-0.185281,-0.129434,-0.153645,-0.141764,-0.290345,-0.263838,-0.144486,-0.0449267,-0.0424538,0.1701,0.217949,0.18586,0.0709764,-0.0978843,-0.0662836,0.0220256},{0.278028,-0.146779,-0.299056,-0.3265,-0.341475,-0.22127,-0.0621358,0.058389,-0.0785507,-0.169467,-0.194088,-0.345024,-0.248783,-0.253161,-0.179235,-0.317914,-0.332602,-0.236696,-0.201088,-0.110518,-0.0798349,-0.135204,-0.197171,-0.327771,-0.17161,-0.0754657},{-0.287379,-0.00577872,-0.0845214,0.0872993,0.120467,-0.104859,-0.0204246,-0.0661039,-0.170759,-0.0808489,0.050827,0.0691054,-0.0270245,-0.0916766,-0.251448,-0.0541148,-0.0258923,0.249843,0.352753,0.525685,0.337154,0.112008,0.0258027,0.0640662,0.110845,-0.154108},{0.00912598,-0.105291,0.0689085,-0.0799314,-0.0955881,-0.151572,0.0413424,-0.0585718,-0.138022,-0.180998,-0.30741,-0.256082,-0.292459,-0.223275,-0.2732,-0.287089,-0.00324569,0.00355185,-0.0697273,-0.394135,-0.342851,-0.0832382,0.134083,0.144532,-0.0498093,0.214304},{0.122715,-0.0709574,-0.11168,-0.0700795,0.0392085,-0.00556973,0.00954613,0.18188,0.0670295,-0.221703,-0.190958,-0.126353,-0.225732,0.0789354,0.4389,0.248417,0.048436,0.0889898,0.0410775,-0.226161,0.0136641,0.0784312,0.0031881,-0.0379966,0.0472608,-0.0503587},{0.0416038,0.0417548,0.0153256,0.000864319,-0.0120708,0.205917,0.106876,0.38473,0.476258,0.107282,-0.539514,-0.427898,-0.243681,0.329606,0.535121,0.448847,0.303295,0.205248,0.0386455,-0.0435438,-0.0442589,0.069583,-0.0324028,-0.0702038,0.0730592,0.034486},{0.229984,0.0340653,0.0120639,0.00169899,-0.0822301,-0.0255684,-0.115724,0.0351657,0.266565,0.0630253,-0.147806,-0.259579,-0.316511,-0.418175,-0.452488,-0.325928,-0.310261,-0.0719398,-0.0831433,-0.157636,-0.165666,-0.297139,-0.0403332,0.0285898,0.169017,-0.0500448},{0.360583,-0.156168,-0.00837609,-0.196079,-0.312219,-0.021433,-0.13587,0.0828246,0.0466674,0.131373,0.193664,0.145659,-0.111519,-0.161245,-0.19196,-0.189189,-0.103734,0.00584932,-0.0564768,0.101281,0.190251,0.056326,-0.315025,-0.310035,-0.363367,0.193172},{0.20489,0.00666968,-0.0519342,0.075262,0.00935372,0.0215751,-0.0557493,-0.213804,-0.109536,-0.17181,0.0425509,0.00933798,0.0513104,0.128312,0.0881937,-0.0155193,0.00769121,-0.0610182,0.0845593,-0.0717843,0.00540952,0.104674,-0.0522416,-0.0494788,0.0359273,-0.0631218},{0.262268,0.0307412,-0.0400953,-0.164587,-0.152182,-0.104824,-0.0186517,0.00549975,0.0628839,0.0153899,0.0653242,-0.128196,-0.214762,-0.165205,-0.123637,-0.15461,-0.059548,-0.0511431,-0.128925,-0.0465619,0.0272973,0.0156189,-0.104827,-0.174999,-0.16225,-0.0707911},{0.0330824,0.0175622,-0.146607,-0.11056,0.0630905,0.268592,0.187289,0.151326,0.061987,0.185759,0.32538,0.369551,0.351034,0.300076,0.381802,0.232049,0.323646,0.48375,0.433706,0.441063,0.339723,0.202587,0.178808,0.15102,-0.019594,-0.0974902},{0.197938,-1.34475,-0.496428,-0.274339,-0.174216,0.0784524,0.0181642,0.135192,-0.0740856,-0.16579,-0.29519,-0.162079,-0.300762,-0.192578,-0.302382,-0.133528,-0.2148,-0.277715,-0.446338,-0.368846,-0.316454,-0.123396,0.000786179,-0.0508619,0.0157065,0.0418909},{0.408376,-0.0967476,-0.0166019,-0.187451,-0.0788101,-0.0395655,-0.0278728,0.0671917,0.0762174,0.163182,-0.0151198,-0.355051,-0.317857,-0.145274,-0.174238,-0.233595,-0.178226,-0.134766,-0.114695,-0.0485672,0.0123876,-0.0344935,0.0350418,-0.0631257,-0.193318,-0.0144581},{0.111291,0.0640544,0.0172462,0.17087,0.0544062,0.0119949,0.00617165,0.0296102,0.161936,0.100017,-0.378531,-0.483856,-0.448673,-0.221132,-0.40299,-0.334637,-0.217254,-0.279851,-0.179932,-0.127493,-0.24317,-0.265117,-0.0981592,-0.187113,0.072492,0.120562},{-0.0905716,-0.0280003,0.0176435,0.0127841,-0.206559,0.0135053,0.143656,0.373915,0.1488,-0.0992594,-0.0564888,-0.103896,-0.035985,0.108006,0.216634,-0.0498178,-0.136669,-0.159804,0.127533,0.232282,0.465293,0.323523,0.100962,0.0901745,0.0620532,0.00769887},{0.131201,0.160954,-0.0651497,-0.106775,-0.185689,-0.0890929,-0.102359,0.0537937,-0.0770949,-0.493264,-0.373144,-0.270093,-0.031587,0.213807,0.361179,0.35034,0.204278,0.210141,0.329367,0.243555,0.446888,0.334806,0.158101,-0.0469855,-0.115908,-0.0658094},{0.00301226,0.08931,0.0105126,0.0634749,0.00453561,-0.0128905,0.0403486,-0.048239,-0.0021222,0.11572,-0.0870194,-0.126763,-0.1715,-0.0291969,-0.00188944,0.0697928,0.095741,0.0782404,0.0722686,0.0991178,0.205954,0.186085,0.0834232,0.0955652,-0.0285698,0.0893271},{0.329043,-0.029601,0.160529,0.0800297,7.36247e-05,0.0410172,-0.104302,-0.0326264,-0.00946733,-0.159296,-0.387132,-0.409813,-0.583184,-0.41268,-0.417746,-0.253392,-0.157294,-0.142851,-0.26924,-0.177903,-0.107998,-0.064775,0.034422,0.0931665,0.218886,-0.0336965},{-0.0355489,0.132185,0.059909,-0.00238084,0.0335456,0.0677815,-0.0369035,0.0938536,0.130074,-0.220085,-0.497122,-0.298092,0.214162,0.314263,0.296216,0.209052,0.210236,0.128897,0.237203,0.353606,0.328455,-0.00803344,0.010009,0.0824663,0.181593,0.0234789},{-0.0791501,0.074862,0.0299474,-0.0726822,-0.0350783,-0.0460377,-0.0138868,-0.0754045,-0.217599,-0.343578,-0.0687019,0.462005,0.495352,0.071987,0.220043,0.763979,0.681188,-0.0582387,-0.145696,-0.0761674,0.020221,0.137512,0.226569,0.0723115,-0.0304077,-0.0550822},{0.252474,-0.0925464,-0.158849,-0.197438,-0.456106,-0.34004,-0.127171,-0.196763,-0.0519806,-0.111182,-0.09789,-0.241128,-0.265073,-0.142776,-0.193032,-0.240145,-0.273152,-0.348952,-0.234629,-0.30308,-0.166162,-0.212083,-0.201094,-0.0928611,-0.0367206,-0.0918993},{-0.158842,0.0681518,-0.0475902,-0.0827197,-0.415633,-0.377464,0.0280158,0.474873,0.639583,0.450679,0.0713943,-0.174903,0.194391,0.264705,0.0405355,-0.19912,-0.239593,0.0217339,0.217369,0.215734,0.0182285,-0.140507,-0.0255231,0.0469823,-0.0743184,-0.126391},{0.138941,0.0155335,-0.0299644,-0.0919805,-0.0477802,0.193215,0.115794,0.134466,0.18691,0.208168,0.0103274,-0.0612255,-0.150265,-0.368871,-0.561702,-0.386724,-0.0401745,0.275074,0.375621,0.248805,0.1012,-0.0131693,0.0356867,0.118867,0.0231913,-0.0150429},{0.307818,-0.0836248,0.0650066,0.0686071,0.0244993,0.123679,-0.0256539,0.0186951,-0.0756321,-0.0652143,-0.0925586,-0.232093,-0.259703,-0.384696,-0.308142,-0.308471,-0.151863,0.010406,0.0483666,0.0736327,0.0893357,0.154295,0.263732,0.20564,0.0299762,0.0760641},{0.338895,0.0448511,0.0578022,-0.091046,-0.14188,0.101007,0.145643,0.122457,-0.0247506,0.138678,-0.00201829,-0.0569126,0.0766531,0.0288827,0.303195,0.213223,0.0536968,-0.0810481,-0.160211,-0.231365,-0.210521,-0.0584564,-0.260743,-0.0620138,0.0286735,0.0230321},{0.519552,-0.199705,-0.135313,-0.227593,-0.157805,-0.201064,-0.248373,-0.229087,-0.387894,-0.4762,-0.484396,-0.45965,-0.491502,-0.511037,-0.738102,-0.597243,-0.482546,-0.286724,-0.378785,-0.294649,-0.205934,0.0138893,0.0886754,-0.0696291,0.184945,0.096075},{-0.0267071,-0.107179,0.104051,0.0449284,-0.00763778,-0.129414,-0.127717,-0.0896267,-0.0725258,0.246374,0.312144,0.267794,0.281542,0.137025,0.13877,0.190195,0.533106,0.67519,0.466733,0.395239,0.203114,-0.103914,0.0204492,-0.00454991,0.0359143,-0.108251},{-0.176289,0.117111,0.173719,0.0143614,0.0189912,0.0797717,0.0322635,0.108741,0.0859745,0.148205,0.0526875,0.28975,0.119728,-0.00213405,0.166089,-0.0323379,-0.088073,-0.0618258,0.20663,0.442931,0.333359,0.259573,0.1021,0.126052,0.0586462,-0.0602407},{0.04864,0.0256771,0.0424398,-0.0688854,-0.0400548,0.0208272,0.0602226,-0.0548725,-0.0548399,-0.0588514,0.058993,-0.0673793,-0.0345874,-0.0373883,-0.00570734,-0.132543,-0.0667417,-0.0757286,-0.043232,-0.018838,-0.0532205,0.0932223,-0.0438826,-0.0267371,0.000430096,0.0574619},{0.0182426,-0.0227644,-0.0767053,-0.0247779,0.167895,0.0693926,-0.0366682,-0.0248048,-0.110795,-0.220379,-0.351406,-0.308486,-0.27376,-0.330204,-0.426956,-0.350529,-0.194097,-0.0460251,-0.161252,-0.07983,0.0447989,0.0490629,0.00522474,0.0660987,0.0350986,-0.0786284},{-0.180699,-0.0983598,0.0836426,0.00711957,0.152062,0.0556165,-0.0888648,-0.228642,0.056172,0.212956,-0.0928828,-0.447586,-0.572192,-0.530755,-0.501865,-0.502115,-0.385273,0.141747,0.254849,0.399068,0.235728,0.101466,0.219647,0.23216,0.0514898,-0.0569044},{-0.237838,0.00796612,0.0038571,0.0883421,0.418814,0.436452,0.524046,0.452096,0.399975,0.197778,0.300011,0.475544,0.474408,0.481014,0.382433,0.302958,0.228494,0.247466,0.366347,0.329206,0.0445457,0.0739139,0.257813,0.24829,0.100456,-0.0864049},{0.300335,-0.0481029,-0.104888,-0.213616,-0.244722,-0.139776,-0.0526056,-0.00718452,0.146085,0.302431,-0.0483643,-0.29164,-0.378787,-0.240604,-0.217261,-0.197251,-0.0160521,0.137196,0.0268523,-0.447175,-0.395749,0.135436,0.35036,0.100046,-0.0785684,0.0909141},{-0.231947,0.115711,0.115891,0.395187,0.600738,0.416912,0.210993,0.229816,0.196036,0.0185052,-0.0290437,0.0708858,0.122235,0.325125,0.401501,0.492569,0.545337,0.714746,0.586918,0.416737,0.320578,0.261919,0.177084,0.203144,-0.00659377,-0.43122},{0.468561,0.0633246,0.0576024,-0.0752905,-0.0643701,0.0771501,0.0840934,-0.126684,-0.130114,-0.0158476,-0.097959,-0.264051,-0.295117,-0.228367,-0.203213,-0.183169,-0.105658,-0.116787,-0.0330645,-0.18258,0.00919262,0.0891399,-0.0229588,0.172868,0.069441,0.0261749},{0.272531,-0.148993,-0.253424,-0.240771,-0.459916,-0.0669108,0.165828,0.0130366,0.110127,0.0457583,-0.222152,-0.166225,-0.188692,-0.316317,-0.468871,-0.386773,-0.352314,-0.31489,-0.308757,0.00466041,0.0636087,0.150927,-0.00343189,0.0303801,0.0794707,0.253163},{0.236294,0.00986658,-0.00998809,-0.118648,-0.106574,-0.0611721,0.0290888,0.0799355,0.0553231,-0.0738367,-0.0933976,-0.196739,-0.392332,-0.495267,-0.458908,-0.438352,-0.346667,-0.140765,-0.0310578,0.0787649,0.0574502,0.126316,0.122586,0.060947,-0.163562,0.00581051},{-0.0106558,0.0314084,-0.00715385,-0.0201999,-0.158866,-0.0144577,0.0116286,0.0972172,-0.0321169,-0.25722,-0.107946,-0.174817,-0.140202,-0.0243202,-0.124039,-0.0334192,0.128324,0.0981062,0.190882,0.269446,0.353518,0.0162867,0.0164257,0.0603377,-0.106238,0.0129231},{0.338095,-0.121718,-0.200015,-0.220026,-0.139576,-0.185968,-0.0713933,-0.0519897,0.0170052,-0.0690857,-0.131552,-0.235074,-0.287886,-0.309599,-0.21353,-0.0925984,-0.0994425,-0.13941,-0.243722,-0.190059,-0.13571,-0.150217,-0.0177919,-0.221228,-0.106218,0.0340306},{0.627328,0.00854855,-0.0575982,-0.399698,-0.581663,-0.447849,-0.31398,-0.215798,-0.210536,-0.338173,-0.382139,-0.427,-0.38437,-0.233281,-0.256442,-0.383255,-0.371611,-0.548261,-0.343915,-0.212208,-0.182619,-0.158229,-0.125864,-0.131051,-0.11659,0.139606},{-0.737268,0.185148,0.320667,0.868445,1.02237,0.582411,-0.0527123,0.378869,0.326507,0.213644,0.300274,0.497986,0.700452,0.920003,1.10522,0.929814,1.04244,1.22644,1.14945,0.754086,0.333662,0.309925,0.320964,0.176341,0.742101,-0.04074},{0.148681,0.0406495,0.0865915,0.0904217,-0.156806,-0.0867004,-0.0239292,0.0265807,-0.180649,-0.0220544,0.0777968,0.008438,-0.035801,-0.245418,-0.340265,-0.130076,-0.19279,0.0671035,-0.157005,-0.126754,-0.177293,-0.226784,0.0461599,0.211036,0.18944,-0.0680665},{-0.031429,-0.100594,-0.0347758,0.102075,0.238449,0.125687,-0.192238,-0.0316594,0.223144,0.160698,0.362492,0.433389,0.407178,0.511136,0.371315,0.370576,0.339231,0.42113,0.462517,0.257434,0.285086,0.233209,0.349473,0.241178,0.212534,0.142966},{0.077217,0.0394565,0.0475872,0.0479577,0.116013,0.00182229,-0.109324,0.00578543,0.114987,0.0379804,-0.148405,-0.253443,-0.445104,-0.33551,-0.220325,-0.291027,-0.120431,0.131306,0.308892,0.362237,0.285875,-0.162607,-0.334944,-0.365342,-0.150442,0.102011}};
+static DTYPE_WEIGHTS_WGF_fw WGF_fw_in[NUMBER_OF_NEURONS][NUMBER_OF_INPUTS_NONRECURRENT] = {{0.18334,0.0542354,-0.0122609,-0.0876681,-0.00324864,0.0929281,0.121559,0.164586,0.139473,0.11867,0.0406247,-0.0309022,-0.0538565,0.0202502,0.0355456,-0.0506887,-0.0600989,-0.113688,0.00467872,0.180516,0.0705436,0.0698049,-0.146646,-0.0680601,-0.196135,0.00702306},{-0.192954,0.0247875,0.123059,0.289088,0.492208,0.216786,0.0106511,0.163095,0.412554,0.251802,0.252039,0.195226,0.330651,0.461226,0.366476,0.430889,0.361176,0.0978775,0.0836837,0.0908731,0.257705,0.125338,0.0228065,-0.0662109,0.13864,-0.164373},{0.147232,-0.0570971,0.0711068,0.0149325,-0.112801,0.0423701,0.135482,0.0595068,0.0826424,0.277397,0.152829,-0.0099128,0.083848,0.149967,0.154886,0.172233,-0.0313538,-0.452713,-0.267723,0.004241,0.176945,0.0996735,0.0530177,-0.00289104,-0.0133164,-0.052242},{0.194269,-0.0301305,-0.218897,-0.230687,0.117248,0.0636274,0.227755,-0.0540984,-0.0232056,0.077641,0.0393806,0.0242565,0.0483229,0.089701,0.125647,0.0793205,-0.0643011,0.153028,0.100057,0.335123,0.314122,0.152024,-0.0899186,0.0544755,0.121617,0.0922984},{0.0566025,0.012958,-0.0232378,0.184737,-0.00541311,0.10378,0.10396,0.180116,0.0617257,-0.238302,-0.234258,-0.405788,-0.303181,-0.219498,-0.126578,-0.322849,-0.322128,-0.300123,0.0634704,0.108334,0.0204396,0.027509,-0.0827027,-0.0343492,0.104351,0.00184295},{0.0268909,0.0396135,0.0607616,0.159107,0.12803,-0.0215176,0.0801272,-0.0178302,0.0478997,0.107087,0.158341,-0.0449454,-0.111652,0.2916,0.605659,0.675231,0.441367,0.0447701,-0.061202,-0.0753991,0.0714824,-0.162616,-0.155306,-0.0580826,0.082854,-0.0223704},{-0.00667842,0.026548,-0.0294618,0.112687,0.142461,-0.0232249,-0.128432,0.0781301,0.208708,0.199156,0.0369328,-0.0880021,0.0221632,0.220618,0.108767,0.0828794,0.152669,-0.124595,-0.214683,-0.194343,0.0951631,-0.0590401,0.108029,-0.0483615,0.0509346,-0.0783419},{0.0655137,-0.00144464,-0.00986128,0.0272222,-0.0335241,-0.112042,-0.154901,0.0696779,0.0885933,0.222959,0.434762,0.241999,0.187425,0.100204,-0.0850932,-0.0542058,0.108264,0.0749469,0.263368,0.2893,0.545385,0.0076302,-0.451235,-0.406049,-0.110667,0.0333175},{-0.0848365,0.0257105,-0.0623046,0.0104491,0.00208831,-0.197746,-0.122955,-0.13576,0.0521709,0.116656,0.0663706,0.0495516,0.0525883,-0.0572695,-0.193413,-0.174758,-0.130085,-0.029416,-0.0140023,0.0242734,0.112399,-0.146723,-0.19622,0.0754686,0.115786,0.0137099},{0.073417,-0.131822,-0.209761,0.0747665,0.0528842,-0.0237707,-0.0992903,-0.226124,-0.0405658,0.113935,0.216085,0.256073,0.197376,0.125398,-0.000427518,-0.140119,-0.187802,-0.210295,-0.290473,0.0420855,0.120724,5.72186e-05,-0.0973489,-0.0489523,0.07146,-0.0401837},{-0.261202,0.0340679,0.128568,-0.0815632,-0.0749713,-0.216761,-0.276498,-0.391172,-0.469711,-0.312442,-0.131534,-0.262752,-0.0749577,-0.020185,-0.138114,-0.0563122,-0.192369,-0.237203,-0.173515,-0.0357879,-0.010299,-0.221991,-0.278827,-0.321198,-0.203266,0.0674743},{-0.0729622,-0.253733,-0.0248081,0.00725166,-0.0514917,-0.11083,-0.238052,-0.138373,-0.263851,0.0073467,0.016731,-0.107024,-0.0541823,0.06388,0.126624,0.106093,0.0195771,0.0600984,0.0108547,0.057495,0.201664,0.108494,-0.0455298,0.0784756,0.0964529,0.00786599},{0.08947,0.0190236,-0.0213015,-0.00494103,-0.01678,0.168526,0.251132,0.144774,0.339207,0.306054,0.24676,0.104512,-0.0826622,-0.0455762,0.0630201,0.0500947,-0.0158382,-0.0746184,0.199299,0.304573,0.429187,0.0899754,-0.0980307,-0.233632,-0.0801717,-0.0474029},{0.0543099,-0.0908599,-0.0564187,-0.121484,-0.0380804,0.0122595,-0.175075,-0.110186,0.00308832,0.550881,0.688356,0.531406,0.0809098,-0.179341,-0.170829,0.00212347,0.0843002,0.227284,0.217212,0.223727,0.18982,0.102779,-0.0382626,0.0244808,-0.117749,-0.0449015},{0.0643976,0.112566,-0.0356634,-0.153126,-0.062379,0.131482,0.390515,0.304005,0.0684648,0.0193836,-0.103485,-0.131843,-0.203838,-0.0925862,0.0165503,-0.184488,-0.101638,-0.292899,-0.211976,-0.0583258,-0.0198547,0.0364063,-0.156808,-0.0450394,0.0857673,0.0897727},{0.144998,-0.0051676,0.0151057,-0.0378691,-0.0765219,0.00648552,0.108466,0.111009,0.251843,0.236301,0.29482,0.261648,0.312296,0.379153,0.224159,0.234732,0.0978419,-0.145757,-0.267627,-0.211943,-0.136963,-0.107305,-0.0381063,-0.0510827,-0.100683,-0.0557545},{0.351085,-0.0499941,0.0196874,0.095944,-0.010886,-0.010238,-0.0457874,0.00804548,-0.0977349,-0.082389,-0.0101505,-0.107233,0.0748279,0.0248651,0.00184409,-0.0912682,0.036572,-0.0925599,0.0265038,0.110353,-0.0350781,-0.00409237,-0.199909,-0.0583019,0.0100034,0.0580839},{0.33359,0.0516884,-0.0540908,-0.140899,-0.337954,-0.114694,0.158676,0.0611288,0.0747581,0.0835962,-0.116851,-0.0231878,-0.0265887,0.115109,-0.146896,-0.261897,-0.508481,-0.38907,-0.294977,-0.12272,-0.0444304,-0.092957,-0.0795232,0.071117,-0.0804114,0.00282114},{0.00269749,-0.00245801,0.11247,0.0144321,0.0223635,0.0885529,0.0223004,0.0301023,-0.0681886,0.0742797,0.122961,0.0112597,0.12485,0.0358999,0.151604,0.0676313,0.0418489,0.00250295,0.0993278,0.208521,0.201588,-0.215898,-0.52528,-0.1767,-0.0200446,0.0346797},{0.0177552,-0.00933595,0.0117024,-0.0392197,-0.1705,-0.132052,-0.188362,-0.293677,-0.232691,-0.0846173,0.137805,0.147998,0.228497,0.344832,0.462442,0.423779,0.244648,-0.166802,-0.246574,-0.171362,0.0243704,-0.0818512,-0.114253,-0.000403757,0.0673144,0.0168754},{0.0604513,0.064747,-0.0845393,-0.00519445,-0.103936,-0.0672504,-0.106336,-0.13225,-0.0810907,0.0533312,0.193623,0.0422971,-0.00816536,-0.023335,-0.117576,0.0113598,-0.0194228,0.138065,0.283624,0.161355,0.190619,0.0395062,0.00571799,-0.0876794,-0.106818,-0.125889},{0.153083,0.0102927,-0.0764019,-0.0795521,-0.0954773,0.0234251,0.0127782,0.090159,0.0955203,-0.060306,-0.0154225,-0.0133965,-0.0895948,-0.108395,0.045471,-0.0280084,-0.012734,0.126625,0.339657,0.512344,0.284825,-0.378646,-0.411959,0.137446,0.142702,0.0246984},{0.0852034,-0.0675223,0.00489659,0.0385918,-0.0931734,0.072288,0.0959946,0.172142,0.21644,0.184219,0.205308,0.317547,0.400567,0.311869,0.300254,0.131036,-0.0885718,-0.159561,0.0283819,0.248807,0.189188,-0.0730818,-0.0992903,-0.267774,-0.0254562,0.0641035},{-0.00647216,0.00908306,0.0515841,0.0558507,0.0198365,0.0939911,0.138439,0.104452,0.230819,0.310827,0.364349,0.317206,0.268769,0.219749,0.210186,0.0704515,0.147165,0.190858,0.144804,-0.14273,-0.340084,-0.173603,-0.13899,-0.136525,-0.184426,0.00245914},{0.0486769,0.00223028,-0.0834203,0.0436926,-0.0901707,-0.091445,-0.0621588,-0.190674,-0.0784034,0.154746,0.500932,0.374644,0.22188,0.139553,0.140582,0.0670685,0.0726409,0.025036,-0.0364642,0.0159683,0.0052164,0.0611435,-0.00970123,0.000252274,-0.0991959,-0.02634},{-0.0298951,0.0663719,0.1747,0.170907,0.489,0.338126,0.0890213,0.103244,-0.0354164,-0.0974567,0.0207977,0.233298,0.329036,0.333686,0.31422,0.334689,0.328516,0.488399,0.492947,0.194458,0.203575,0.0786121,0.0379801,0.13918,0.0660677,-0.168873},{-0.304197,0.372651,0.0599499,0.125565,0.0733884,0.196342,0.144365,0.129616,0.0836074,-0.0213056,-0.0503035,-0.0811789,-0.0462,-0.142643,-0.246667,0.037229,0.192247,0.0655526,0.081747,0.0830564,-0.0531905,-0.159438,-0.100869,-0.0189076,-0.0742253,0.285673},{0.290202,0.0479537,-0.0095137,0.0655576,-0.062991,0.0916117,0.105696,0.0666151,0.0521196,0.0864674,0.102453,-0.0573196,0.0133852,0.123562,-0.0168885,0.0729618,0.131567,0.0712044,0.0468133,-0.0502822,0.0101965,-0.0538969,-0.0332995,-0.0111054,0.0460622,0.0262009},{0.581061,0.0670298,0.204121,-0.110905,-0.363425,-0.00337759,-0.0180521,-0.0733505,-0.122171,0.0227909,0.128535,0.0876163,0.0774913,0.0486372,0.235223,0.151648,0.0480405,0.257013,0.369667,0.436653,0.406757,0.250804,0.174625,0.214824,0.267876,-0.0411696},{-0.461943,0.0304868,0.188615,0.528161,0.830229,0.353731,0.0112449,0.452373,0.697479,0.56422,0.53756,0.406272,0.463326,0.407593,0.419147,0.431111,0.626909,0.75725,0.651853,0.384616,0.434682,0.297018,0.194244,-0.00074653,0.0681946,-0.0324602},{-0.272577,0.0316663,-0.0753543,0.14974,0.266971,-0.0898209,-0.465685,-0.0862474,0.125033,0.293402,0.311497,0.165237,0.240886,0.157258,0.189518,0.159897,0.148841,0.437229,0.283706,0.28801,0.12746,0.220498,0.0950177,-0.0366336,0.179032,-0.0973768},{0.495645,-0.166983,-0.175403,-0.364862,-0.579371,-0.387054,-0.284625,-0.2114,-0.206808,-0.613109,-0.896139,-1.03227,-0.726274,-0.707823,-0.460463,-0.517123,-0.367298,-0.670664,-0.778409,-0.667736,-0.482659,-0.390319,-0.273476,-0.513808,-0.276118,0.173345},{0.175178,-0.0538675,-0.0579927,0.0626023,-0.0942705,-0.0395688,-0.12385,-0.0656969,0.162796,0.224495,-0.0441699,-0.0777337,-0.190118,0.025218,0.047013,-0.073893,-0.0880364,-0.0926028,-0.239018,-0.140262,0.0549935,0.0424824,0.0973591,-0.064502,0.037798,0.116074},{0.0388959,-0.652056,-0.29044,-0.0756959,0.127217,0.00590453,0.0176335,0.0964248,0.114879,0.178868,0.15969,0.0107461,-0.0572396,0.0425638,-0.0155926,0.0862894,0.00767567,-0.00480874,0.238572,0.11924,-0.0574391,-0.182912,-0.0754473,0.00636622,0.11494,0.0420047},{0.927612,-0.203571,-0.205499,-0.439266,-0.814989,-0.464675,-0.0172616,-0.204852,-0.272448,-0.404464,-0.537022,-0.693181,-0.495195,-0.644819,-0.672628,-0.642752,-0.595827,-0.710797,-0.785312,-0.556264,-0.281986,-0.426719,-0.427703,-0.365962,-0.355933,-0.15277},{1.27823,-0.251767,-0.333526,-0.935318,-1.43392,-1.06292,-0.4977,-0.606055,-0.526564,-0.628137,-1.02337,-1.30208,-1.2891,-1.18883,-1.10109,-1.11544,-1.10186,-1.14637,-1.25094,-1.14025,-0.98526,-0.406227,-0.373623,-0.566622,-0.668672,-0.0758694},{-0.0220348,0.00325433,0.0209137,0.227835,-0.0327093,0.0608434,-0.104471,-0.280048,-0.332597,-0.421001,-0.390894,-0.230637,0.103083,0.232891,0.216735,0.233783,0.0260663,-0.175074,-0.394333,-0.239317,-0.0445004,0.040846,-0.0650378,0.0269364,0.161988,0.0795391},{0.363414,-0.0242431,-0.0216876,0.133727,-0.0486928,0.0125995,0.0363932,-0.186113,-0.143296,-0.0410809,-0.0125429,0.0162294,0.0130703,-0.0448884,-0.126378,-0.11801,-0.106169,-0.17773,-0.220044,-0.166979,-0.309118,-0.0568415,0.241276,0.153937,-0.0128417,0.0269497},{-1.27113,0.262812,0.298485,0.785762,1.2337,0.648501,0.140222,0.361924,0.222255,0.409582,0.796377,1.06929,1.025,1.03874,0.908758,0.923428,0.892323,1.10728,1.19714,1.00554,0.47608,0.0816419,0.195425,0.167865,0.427884,-0.231381},{0.418452,-0.252784,1.01439,0.72823,0.732523,0.679605,0.589933,0.294383,0.238377,0.154503,0.0252544,0.0143119,0.177059,0.290072,0.170838,0.224701,0.100449,0.0119678,0.185035,0.479903,0.518486,0.213556,0.0445392,0.154326,0.315951,0.466528},{-0.0291264,-0.00386041,0.020066,0.0368343,0.0038394,-0.0705154,-0.111453,-0.343814,-0.144814,0.184677,0.140671,0.156006,0.17906,0.21915,-0.195119,-0.156713,0.0456862,0.201137,0.172894,0.122823,0.120233,0.119759,0.0116561,0.0654419,0.0328561,0.0962632},{0.164178,0.0248939,0.0503605,0.0815275,0.109647,0.207144,0.0456462,-0.060691,-0.139306,-0.130995,0.00740144,0.240584,0.257013,0.455323,0.307623,0.215247,-0.142343,-0.073031,0.212363,0.31162,0.32948,0.0581127,-0.197202,-0.220002,-0.0619841,-0.00755157},{-0.157891,0.0434703,0.0852908,0.320694,0.383366,0.224968,-0.0377575,0.138034,0.0965775,0.249813,0.359669,0.254303,0.247728,0.325031,0.353557,0.251825,0.190489,0.079263,0.155609,0.200467,0.279171,-0.0277127,-0.22321,-0.116693,0.14755,0.0596889},{-0.0279528,-0.0669568,-0.0940813,0.128371,0.0318363,-0.0013395,0.00113155,-0.112231,-0.0788332,0.149194,0.429116,0.302599,0.318789,0.2342,0.172123,0.301067,0.426143,0.298978,0.256231,0.120816,0.204653,0.0345115,-0.0885042,-0.237785,-0.0944372,0.074134},{-0.00428684,0.0408511,0.0310953,0.0300619,-0.0403384,0.00309425,0.0026298,0.0982924,0.11313,0.0165997,0.071772,0.0882103,0.101769,0.225351,0.306829,0.212691,-0.00240577,-0.281269,-0.191263,-0.155594,-0.29111,-0.34043,-0.241056,0.0807427,0.0129096,0.0113093},{0.276464,0.0398971,-0.0495415,0.109656,0.12907,-0.0949276,-0.145363,-0.177205,-0.260582,-0.187563,-0.269322,-0.42674,-0.473421,-0.614079,-0.564042,-0.587158,-0.349865,-0.367639,-0.652769,-0.54573,-0.18872,-0.0661766,-0.0399881,0.151574,0.145803,0.0967101},{0.0933489,0.0342363,-0.0644215,0.121272,0.0319543,0.168107,0.287355,0.385955,0.0373816,-0.182673,-0.379636,-0.251249,-0.0310306,0.189296,0.177949,0.259891,0.333487,0.238978,0.208585,-0.0276795,-0.0972502,-0.0976517,-0.154759,-0.0926076,-0.0233403,-0.0390057},{-0.0837168,-0.0383506,-0.0730627,0.0848947,-0.0572797,-0.114098,-0.260389,-0.301268,-0.247004,0.256432,0.428012,0.298074,0.202674,0.104567,0.198461,0.178725,0.362243,0.40645,0.0517602,-0.0156903,-0.0269361,0.0396459,0.06533,0.213017,0.104198,-0.046516},{0.652671,-0.207683,0.00448344,-0.173894,-0.247955,-0.266381,-0.245576,-0.0906661,-0.0106061,-0.108883,-0.185059,-0.232657,-0.163613,-0.00310345,-0.0984636,-0.199448,-0.136001,-0.104215,-0.23273,-0.152853,-0.132309,0.0504464,-0.0370025,-0.0759423,-0.0480132,-0.0377714},{0.250498,0.0826703,-0.0216597,0.0125043,0.124256,0.167501,0.177974,0.0568785,0.0524727,-0.159261,-0.105111,-0.603629,-0.575997,-0.497806,-0.340336,-0.335769,-0.229418,-0.0708589,0.219738,0.266573,0.337159,0.235573,0.192285,0.0560767,-0.121497,0.0165642},{-0.0228653,-0.0708668,0.0761977,-0.0337096,0.0901961,0.141653,0.035649,0.01797,-0.115292,-0.100015,-0.198344,-0.083242,-0.176549,-0.077062,-0.0672719,-0.0963358,-0.264852,-0.349273,-0.182139,0.161741,0.159725,-0.337712,-0.310389,-0.162414,-0.00713704,0.0914384},{0.0342455,0.0181039,-0.0326952,-0.0453342,0.110054,0.263095,0.187717,0.0468957,-0.327058,-0.407025,-0.349715,-0.194449,0.226262,0.171347,0.0347151,0.0693244,-0.105174,-0.0252629,0.0783583,0.00537991,0.174837,0.118448,-0.249195,-0.155233,-0.219682,0.0193523},{0.225583,-0.0340653,-0.0124362,-0.0828877,-0.0558382,-0.255753,-0.217264,-0.25576,-0.302318,-0.448226,-0.488532,-0.392447,-0.409284,-0.401187,-0.208999,-0.193118,0.0122659,-0.0438125,-0.139373,-0.115855,0.0651339,0.110894,-0.060612,0.0736171,0.09511,0.262602},{-0.0600711,0.0522339,0.0273425,0.0858961,0.0229598,0.112704,0.0178099,0.0155758,-0.0410796,-0.0256441,0.124367,-0.236035,-0.142021,0.0968823,0.245398,0.367464,0.396982,0.411205,0.411247,0.281293,0.179537,-0.0947123,-0.316735,-0.224432,0.1086,-0.0859881},{0.178156,-0.0332886,-0.0137917,0.122777,0.00797764,-0.00419847,0.00953869,0.103957,-0.066561,0.0685856,0.213932,0.353123,0.183425,0.0269577,0.00725734,0.0978854,0.256925,0.453049,0.449448,0.38888,0.212751,-0.025927,-0.157704,-0.0601059,-0.158643,-0.0136091},{0.050927,0.0422925,-0.0236621,-0.0511582,0.10365,0.110905,0.153285,0.111419,0.00787767,0.11943,-0.0529525,-0.138795,0.0183434,0.333295,0.504163,0.425218,0.0460418,-0.115399,-0.163798,-0.115241,-0.0982302,-0.106545,0.0315061,-0.0837932,-0.0737561,-0.0190273},{-0.129752,-0.0600432,0.00693824,-0.0639241,-0.0755239,0.229901,0.169879,0.347921,0.363313,0.289668,0.0471256,-0.0356993,0.268826,0.0656002,-0.104288,0.147189,0.166073,0.0108425,-0.0884152,0.139404,0.18445,0.0492164,0.0574707,0.0412849,-0.1198,-0.0150162},{0.90693,-0.245142,-0.51066,-0.985421,-1.25622,-0.545086,-0.082322,-0.144793,-0.220539,-0.456468,-0.698605,-0.977751,-1.02332,-0.870236,-0.908296,-1.08383,-1.17993,-1.24258,-1.28187,-1.23824,-0.890571,-0.610332,-0.493059,-0.617659,-0.343445,0.390658},{0.312892,0.049994,0.0737806,0.0425898,0.226122,0.0472012,-0.0322938,0.00371449,0.109546,0.0010695,-0.0981046,-0.160307,-0.0321185,-0.0283798,0.0885039,0.0593121,0.069012,0.00773154,0.0870902,-0.0105631,0.196398,0.252298,0.140377,-0.0215301,-0.0488415,-0.118794},{0.229664,-0.196632,0.118602,0.0181734,0.094701,-0.0989387,-0.0255915,-0.0531883,0.0168306,-0.0343848,-0.0966301,-0.166206,0.0664092,0.227292,0.103788,0.109188,-0.137189,-0.16454,-0.175213,-0.105687,0.0869957,-0.0896214,-0.0669837,0.246319,0.444331,0.163201},{0.0769202,0.0468066,-0.062977,-0.167836,0.011582,0.241031,0.0995799,-0.239591,-0.293116,0.0639147,0.362542,0.283832,-0.00275793,-0.319471,-0.062434,0.46754,0.652927,0.426166,0.397274,0.198625,-0.383123,-0.187264,0.060187,0.0367178,-0.00889523,-0.023119},{-0.158743,0.0625615,-0.0797142,0.0336454,-0.181159,-0.213094,-0.0935391,0.0840345,0.577535,0.830254,0.217843,-0.217031,-0.339631,-0.217779,0.100043,0.0631477,0.0487611,0.172588,0.320046,0.312147,0.159924,-0.0761352,-0.202413,-0.24423,-0.0725103,0.043438},{0.288958,-0.00178475,-0.094502,0.0553143,-0.00278741,-0.055108,-0.136522,0.021096,-0.114682,-0.0110826,0.18519,0.0443553,-0.102237,0.132423,0.267608,0.298403,0.290333,0.276018,0.129412,0.0959263,0.17396,0.193861,0.0146119,-0.0243282,-0.0827018,0.0127516},{0.222671,0.076516,0.0211267,-0.150206,-0.276522,-0.062444,-0.167361,-0.042925,-0.292718,-0.326344,-0.459853,-0.380897,-0.143529,0.0512568,0.0170909,-0.137908,-0.149031,-0.43896,-0.829568,-0.743579,-0.550897,-0.16088,-0.0914417,-0.347856,-0.0920351,0.140368},{0.00908482,0.0397936,0.0233413,0.153498,-0.0993411,-0.167927,-0.189625,0.0241486,0.130505,0.143455,0.150931,-0.0882787,0.103371,0.301548,-0.0332552,-0.10915,0.154785,0.248385,0.13694,0.12608,-0.0118343,-0.0595075,-0.183854,-0.191119,-0.0636377,0.213781},{0.0657612,0.00166135,-5.4626e-05,0.160926,0.0898795,0.0398525,-0.0494114,-0.238452,-0.0178353,-0.0520748,0.0135869,-0.115494,-0.0522028,0.00576764,-0.026592,-0.103323,-0.0692671,-0.0806542,-0.177353,-0.186839,0.032646,0.199465,0.117326,0.115091,0.284549,0.226573},{-0.0198304,0.0225004,-0.067016,0.140461,-0.0167576,-0.270441,-0.289623,-0.449006,-0.215853,0.331626,0.379492,-0.0250093,-0.0956259,0.18033,0.196715,0.308288,0.193131,0.0390034,0.0726148,0.0732568,0.0307985,0.0547915,-0.0943937,-0.117915,-0.00487279,0.0333554},{-0.190304,0.0442846,0.0844696,0.0469811,-0.0506621,-0.217577,-0.13842,-0.321634,-0.184326,-0.144135,-0.209166,-0.180477,-0.204801,-0.355374,-0.327891,-0.367963,-0.469088,-0.439989,-0.3186,-0.470876,-0.317194,-0.12892,-0.0373589,-0.153132,0.0668539,0.0368552},{-0.057754,-0.151308,-0.240346,-0.204315,0.0638045,0.0265371,0.0122674,0.0875836,0.23079,0.159129,-0.110915,-0.187133,-0.211625,-0.263072,-0.230883,-0.324492,-0.389592,-0.268531,-0.167964,0.0335616,0.0858119,0.131118,-0.0644721,-0.139433,0.0237961,0.0254681},{-0.0620422,0.0704882,-0.0096221,0.174006,0.197061,0.0291416,-0.0324145,-0.000969075,0.182501,0.264071,0.14268,-0.0742177,-0.0595811,0.194022,0.455869,0.392003,0.0501667,0.0549502,0.149209,0.235636,0.472828,0.370506,-0.0276247,0.0550557,0.161363,-0.106096},{0.223884,-0.0151471,0.0602119,0.0479475,-0.0573039,0.0307976,0.0671283,0.0764501,-0.016117,0.0532316,0.215323,0.198699,0.0957268,0.0300941,-0.0659269,0.173112,0.29705,0.206488,0.0157697,-0.22241,-0.195337,-0.0806902,0.0220803,-0.0610269,0.0123071,-0.00543652},{0.123394,-0.0140493,-0.177248,0.0203762,0.0127098,0.143549,0.0695443,0.298447,0.352041,0.125633,0.015207,-0.231937,-0.438385,-0.407583,-0.482186,-0.485297,-0.464163,-0.609687,-0.822821,-0.557003,-0.340391,-0.180135,-0.0062405,0.0330719,0.0538181,-0.0169976},{0.158252,0.252599,0.166917,0.237902,0.0281335,-0.0624867,-0.0258976,-0.0223171,0.0820946,0.138691,-0.0472363,-0.0308881,-0.0734771,-0.114236,-0.074305,-0.0552193,0.018416,0.0634484,0.01735,-0.0946934,0.0647669,-0.0528984,0.0475268,0.0289654,-0.0174833,-0.000996015},{0.163374,-0.170914,-0.248583,-0.175646,0.00901848,-0.162318,-0.152742,0.0226419,0.000248482,-0.0410012,-0.203711,-0.266545,-0.319914,-0.0860648,0.166913,0.110303,-0.280641,-0.526044,-0.356052,-0.12482,-0.199121,-0.5445,-0.436289,-0.0117469,0.147321,0.168862},{-0.137099,-0.041889,0.0878243,0.244393,0.322305,0.496721,0.345446,0.138139,0.164487,0.275686,0.0701386,0.184924,0.142663,0.089151,0.0320658,-0.069598,0.00604492,0.124222,-0.0178297,0.0494195,-0.0933418,0.100084,0.206415,0.199027,0.104607,0.0772535},{0.125839,-0.0133861,-0.0267964,-0.0442325,-0.156461,-0.0394097,0.0920405,0.111783,0.248371,0.130834,0.107204,0.493292,0.706542,0.313528,0.0916474,-0.00673167,-0.0618185,-0.187077,0.23101,0.410914,0.515215,0.0618859,-0.16012,0.0160558,-0.0522779,0.00862963},{0.167538,0.0387644,-0.0897328,0.136141,0.196129,0.0783699,0.227703,0.0792772,-0.0524648,-0.188768,-0.110823,-0.0441272,0.0647444,0.094091,0.168643,0.00728749,-0.00902696,0.0312874,0.314559,0.41571,0.578392,0.339494,0.317433,0.428222,0.198733,-0.117801},{-0.105272,-0.0782904,0.120832,0.0379789,0.0183465,0.354883,0.453136,0.33354,-0.0920325,-0.541916,-0.580789,-0.126911,0.185188,-0.179542,-0.475181,-0.113224,0.0651422,0.156922,-0.137412,-0.181136,-0.0901732,0.124162,0.105947,-0.0368824,-0.042263,-0.0672788},{0.0644222,-0.0173962,0.0059967,-0.0173252,0.100306,-0.19805,-0.15991,-0.182986,0.0633901,0.473143,0.567999,0.33245,0.36231,0.352459,0.152594,0.209426,0.151495,0.286422,0.472846,0.557961,0.456685,0.00158335,-0.206613,-0.168683,-0.00455096,0.0176653},{-0.0989192,-0.232873,0.0486549,-0.100102,-0.350633,-0.335996,-0.203003,0.0605292,-0.117323,-0.198307,-0.0134771,-0.012701,0.0891125,0.147787,-0.0849503,-0.0801956,-0.0490037,-0.19003,-0.0755897,-0.164436,-0.224043,-0.369464,-0.271548,-0.237966,-0.237611,0.028028},{0.236594,-0.132067,0.0527435,0.209356,-0.0422466,-0.0306701,-0.103953,-0.15995,-0.039619,-0.201472,-0.324491,-0.277619,-0.40524,-0.454395,-0.597647,-0.639447,-0.675228,-0.60701,-0.384517,-0.140473,-0.0561556,0.0292326,-0.0165138,0.136726,0.140403,0.0798958},{-0.516018,0.322185,0.653442,0.875511,1.34235,0.725399,-0.184185,0.0971571,0.104707,0.207673,0.486123,0.723627,0.68883,0.447119,0.512844,0.609599,0.640644,0.723629,0.675703,0.619873,0.706094,0.541132,0.580628,0.437412,0.576147,-0.16726},{0.00133737,-0.0864659,-0.0455388,0.101597,0.0611025,0.119571,0.202712,0.190322,0.128567,-0.106524,-0.114532,-0.0613786,0.377788,0.252473,-0.0583177,-0.368786,-0.275488,-0.516337,-0.531067,-0.32572,-0.0367326,0.11303,0.140634,0.133628,0.0950634,-0.087819},{0.0867948,-0.0906883,-0.138153,0.0111541,-0.0185359,0.0654385,0.165557,0.0763466,-0.0639819,-0.0267127,0.133527,0.0327259,0.0639995,0.0925656,0.151498,-0.0159282,-0.190659,-0.388549,-0.440935,-0.488717,-0.320866,0.061144,0.0487228,0.0969625,-0.0779216,-0.162191},{0.022644,-0.0476583,0.0277134,-0.0464744,0.0678187,0.151075,0.137148,0.121148,-0.0300069,-0.0139942,0.0192581,-0.150036,-0.167735,-0.192811,-0.0303676,-0.221372,-0.0882589,-0.163876,-0.0533934,0.0767844,0.0676873,-0.0543504,-0.0650601,-0.122677,-0.0816211,0.100164},{0.165052,-0.009405,-0.0277781,-0.0169423,-0.155626,-0.00632028,-0.1136,-0.0107927,0.115144,0.22045,0.234438,0.257437,0.220702,0.248919,-0.166745,-0.235544,-0.154237,0.0872116,0.246448,0.174187,0.13897,-0.072115,0.00424322,0.0668215,-0.00199555,0.0033223},{0.122472,-0.0151581,-0.0642345,-0.00289108,-0.103905,0.04374,0.158902,0.235892,0.295463,0.13135,0.224682,0.31163,0.428976,-0.0358762,-0.274639,-0.248821,-0.0454796,-0.144767,-0.148621,-0.190853,0.139054,-0.0515882,-0.218299,0.0358874,0.0747811,0.0705835},{-1.29971,0.346543,0.60749,1.42115,2.4137,1.48576,0.578333,0.742767,1.07429,1.1671,1.4078,1.4559,1.52202,1.63898,1.67121,1.5901,1.57373,1.77283,1.81654,1.84907,1.66487,1.20196,1.02255,0.88766,0.808796,-0.158697},{0.0428185,0.0818605,0.0709194,-0.0220492,-0.0318326,-0.0572266,-0.211212,-0.278845,0.0338481,0.117213,0.154314,0.0430988,-0.00477669,-0.0406432,-0.152204,-0.199893,0.176752,0.569132,0.581308,0.730703,0.445025,-0.440676,-0.619572,-0.277697,0.117238,0.18457},{-0.488509,0.209829,0.0900315,0.593061,0.86338,0.343083,0.000338264,0.165363,0.197229,0.145024,0.218474,0.365529,0.317378,0.326654,0.147996,0.181653,0.275065,0.442654,0.56632,0.425036,0.368241,0.215911,0.212173,0.283923,0.281381,-0.109904},{-0.0507108,-0.01066,0.0152511,0.0136146,-0.131245,-0.0850605,-0.00411252,0.00365939,-0.0292995,-0.23154,-0.181528,-0.0014121,0.299752,0.265222,0.278488,0.243312,0.181753,-0.0535124,-0.144191,-0.0967032,0.0600399,0.0159584,0.0653341,0.174211,0.129301,-0.027629},{0.104538,-0.112766,0.127405,0.146395,-0.0449056,0.00438708,-0.290477,-0.458372,-0.41577,-0.0856348,0.0229408,-0.00990442,0.0876828,0.0619355,0.0725235,0.189502,0.23105,-0.226476,-0.425563,-0.462166,-0.351877,-0.244587,-0.0597196,0.0464654,0.0671628,0.11726},{0.0652563,0.0552907,-0.011375,-0.121467,0.01537,0.0385993,0.0276152,0.00714112,0.0599822,-0.0592385,-0.0826816,-0.0131096,0.115613,0.238652,0.0860661,-0.0473258,-0.0938847,-0.118911,-0.0512944,0.0762925,-0.0235243,-0.194025,-0.217091,-0.0853263,-0.0502557,-0.105178},{0.0997733,-0.211712,-0.0846223,0.0155222,0.0597622,0.262688,0.320875,0.378738,0.279309,0.0536959,0.0161908,-0.299255,-0.0563562,-0.153254,-0.384752,-0.340639,-0.052389,0.147755,0.313369,0.234205,0.159688,-0.170987,-0.185511,-0.202129,-0.110981,-0.0330718},{0.380784,-0.0872636,-0.0797594,-0.0867174,-0.170669,-0.126969,0.0596321,0.129054,-0.00407123,0.00638152,-0.00244025,-0.11671,-0.157131,-0.165935,-0.368481,-0.296736,-0.238356,-0.0870661,-0.287397,-0.20983,-0.213823,-0.0513869,-0.149324,-0.195763,-0.155712,0.0601676},{0.00479758,-0.0753982,-0.10022,-0.168845,-0.0327049,0.134311,0.125277,-0.221542,-0.359107,-0.319899,-0.0715421,-0.00675487,-0.0848284,0.00689296,-0.0987548,-0.0487139,-0.153901,-0.22754,-0.0972001,0.131178,0.0426062,-0.0331062,-0.139986,-0.159484,-0.161374,-0.0522098},{0.284181,-0.0516713,-0.106607,-0.126637,-0.159115,-0.0895455,0.15494,-0.140038,-0.0669666,0.122504,-0.196598,-0.376687,-0.140352,-0.173262,-0.0583435,-0.0472464,-0.0531178,-0.287203,-0.361323,-0.30923,0.0219428,-0.181332,-0.0793545,-0.040064,-0.216918,-0.0461563},{-0.0254797,0.027872,0.0100461,0.0670475,0.0609214,0.0345805,0.0792796,-0.0425515,-0.285269,-0.330152,0.215406,0.678806,0.532245,0.250272,0.252065,0.239798,0.275705,0.254846,0.380796,0.509589,0.476619,-0.00282618,-0.273861,-0.191317,-0.157105,-0.052425},{-0.409434,0.160664,0.331348,0.553757,0.730122,0.369512,0.181318,0.317777,0.394836,0.468406,0.43174,0.489223,0.693113,0.971721,0.899749,0.725979,0.362204,0.286164,0.315527,0.27582,0.336389,0.206226,0.0172769,0.156633,0.119848,-0.18378},{0.0337173,-0.0502706,-0.048759,0.0423594,0.00220538,0.0335704,0.0153919,-0.0283111,-0.279733,-0.41422,0.0430046,0.551084,0.530746,0.503794,0.191559,0.326141,0.365983,0.0954853,-0.0859156,-0.0531561,-0.0932643,-0.09009,-0.378098,-0.240398,-0.147093,0.0121836}};
+static DTYPE_WEIGHTS_WGO_fw WGO_fw_in[NUMBER_OF_NEURONS][NUMBER_OF_INPUTS_NONRECURRENT] = {{0.202319,0.0102896,-0.0204124,-0.217504,-0.332205,-0.122726,0.149224,0.218463,0.150388,0.0488022,-0.0315648,-0.087988,-0.188419,-0.0279579,-0.18103,-0.180934,-0.0782225,0.0178429,0.0982319,0.344321,0.197203,0.0797863,-0.0570023,-0.152679,-0.297389,-0.165002},{1.10818,-0.137828,-0.389222,-0.754518,-1.12416,-0.463011,-0.0296583,-0.21681,-0.278014,-0.560579,-0.773643,-1.00829,-0.83595,-0.899337,-0.802449,-0.911575,-0.824423,-0.984737,-1.0416,-0.749696,-0.454446,-0.250198,-0.411083,-0.37617,-0.494839,0.0111115},{0.221867,0.0619508,-0.0575916,0.00763822,0.0739104,0.177967,0.211897,0.354532,0.37671,0.223973,0.12861,0.0594603,0.233794,0.128195,0.0668545,0.114709,0.0889789,0.0391266,-0.0723434,0.0494987,0.14548,0.21134,0.0822451,0.0038791,-0.103441,-0.0169341},{-0.246514,0.052026,0.0462898,0.201056,0.290814,0.332741,0.440149,0.321247,0.375887,0.397665,0.329438,0.253601,0.364083,0.282033,0.223786,0.398912,0.422161,0.430461,0.385692,0.464333,0.360096,0.123941,0.225064,0.277429,0.10195,-0.339964},{0.743409,0.048769,-0.0390236,-0.194519,-0.284485,-0.0685513,-0.188567,0.0465194,0.180669,0.0514785,-0.15247,-0.239337,-0.27237,-0.239954,-0.206257,-0.0730066,0.00792535,-0.20241,-0.00683357,-0.0986283,-0.0845903,-0.151314,-0.217966,-0.33298,-0.267228,0.0917924},{0.595692,0.0379264,-0.049,-0.188822,-0.310089,-0.249802,-0.0075632,-0.0434863,0.0800325,0.0526183,0.0466036,-0.17839,-0.348033,-0.253845,-0.169231,-0.11617,-0.137946,-0.163591,-0.299181,-0.223934,-0.0290089,-0.19604,-0.349499,-0.198852,-0.173818,0.0698131},{0.393461,0.0279096,0.0637916,-0.096383,-0.0227555,-0.190888,-0.127115,-0.175441,-0.0828488,0.122555,0.194584,-0.0745586,-0.0449132,-0.135922,-0.0120596,0.0662247,-0.0133173,-0.0608725,-0.0427325,0.0434912,0.154923,0.0870954,0.011848,-0.0311143,0.110899,0.145432},{0.598383,0.0897338,-0.0139022,-0.141081,-0.149097,0.0137936,0.257663,0.0916531,0.115297,0.061118,0.139746,0.0588355,-0.0885853,-0.0281805,-0.0659231,-0.114379,0.068952,-0.0360052,0.00626641,-0.0552874,-0.0189449,0.0380455,0.100629,0.047204,-0.136764,-0.00808148},{0.914679,-0.101694,-0.209759,-0.429431,-0.694053,-0.52924,-0.200904,-0.397925,-0.19969,-0.265074,-0.483289,-0.867717,-0.734835,-0.71451,-0.710746,-0.724784,-0.767078,-0.59772,-0.516239,-0.495938,-0.239321,-0.459858,-0.439099,-0.395973,-0.154394,0.165668},{0.867538,-0.0206544,-0.0691731,-0.193297,-0.514225,-0.311991,0.00511168,-0.113453,-0.0324393,-0.181045,-0.0998432,-0.253235,-0.125235,-0.2217,-0.0807893,-0.291404,-0.192076,-0.355535,-0.186619,-0.221667,-0.0527768,-0.0291367,-0.166074,-0.239721,-0.190702,0.207429},{0.393813,0.039507,0.0497643,-0.0123951,0.189345,-0.074275,-0.0958702,0.00162235,0.260884,0.395837,-0.119641,-0.494183,-0.457809,-0.373177,-0.298517,-0.392643,-0.430726,-0.329149,-0.477438,-0.358115,-0.140173,-0.151124,-0.29439,-0.0750166,0.0667362,-0.00192064},{0.182494,0.0435031,-0.0515721,-0.111738,0.000366306,0.136652,0.145826,0.202863,0.323683,0.264919,0.18585,0.0972017,0.00636261,0.0229249,0.00682386,0.123862,0.234713,0.174884,0.11392,0.19068,0.069277,0.11648,0.138291,0.118233,0.0942844,-0.0235137},{0.150344,0.0961067,0.0348998,-0.108832,0.0601562,0.0789875,0.132696,0.309344,0.293313,0.340936,0.359536,0.0813711,0.136164,0.030242,0.0537088,-0.043379,0.00906426,0.0430978,0.208055,0.249534,0.337689,0.380301,0.071408,-0.0153462,-0.10248,-0.237473},{0.444257,0.0104157,-0.00384857,-0.00553815,0.0349267,0.0533749,-0.0037927,-0.00544092,-0.00931092,0.170538,0.106063,0.0107495,-0.166702,-0.0641686,-0.00234353,0.0841825,-0.0113555,0.0565765,0.0451729,-0.0466374,-0.140234,-0.0741707,-0.0234681,0.0983683,0.132315,0.0609077},{0.552676,-0.000113028,-0.0797258,-0.252421,-0.3953,-0.299961,-0.422785,-0.151396,-0.252065,-0.220857,-0.288371,-0.406189,-0.385637,-0.388205,-0.42842,-0.299913,-0.364914,-0.263545,-0.200189,-0.146845,0.0656633,0.0206875,-0.09275,-0.235725,-0.249635,0.0592407},{0.251482,-0.030306,-0.0241983,-0.185478,-0.11351,0.193125,0.359694,0.311159,0.280906,0.24443,0.0739959,0.0492642,0.142721,0.199862,-0.0219748,0.121135,0.214476,0.107631,0.299398,0.294348,0.230495,0.0563817,-0.0198689,-0.0432922,-0.159942,-0.113581},{0.253082,-0.0213054,0.0229754,-0.0237684,-0.0123881,-0.113335,-0.107874,-0.0362563,-0.105839,0.0376513,-0.00562604,-0.00898877,0.0116603,0.00799034,0.0522619,-0.0626758,0.0394022,0.0216181,-0.0226247,0.0567077,-0.0021495,-0.0933272,-0.128346,-0.251558,-0.0887841,-0.0712932},{0.796209,-0.0551649,-0.150276,-0.371034,-0.444588,-0.172104,0.0543997,-0.0928944,-0.0161397,-0.081146,-0.459271,-0.498174,-0.602601,-0.369414,-0.436277,-0.538892,-0.378053,-0.364705,-0.465531,-0.28818,-0.214858,-0.0669066,-0.035313,-0.120799,-0.0500436,0.0550735},{0.146572,0.0801778,-0.0820075,-0.0524002,-0.0522901,0.0944676,0.0374302,0.115223,0.156087,0.251299,0.323852,0.479338,0.495056,0.422052,0.100693,0.0040289,0.0720708,0.241992,0.146652,0.158027,0.0565813,0.0124004,0.036824,0.0828078,-0.150373,-0.0627277},{0.716581,-0.0135736,-0.0384987,-0.0772526,-0.387073,-0.37456,-0.455065,-0.499643,-0.338862,-0.177925,-0.149184,-0.0520475,-0.125891,-0.111902,-0.130947,-0.0344404,0.105313,-0.0202887,-0.18408,-0.221391,-0.20329,0.0218146,-0.0200349,-0.0595492,0.0239166,0.124811},{0.69704,0.0762522,-0.0294901,-0.129524,-0.234917,-0.212598,-0.175672,-0.246805,-0.200307,-0.0659255,-0.244462,-0.269606,-0.323852,-0.184624,-0.260734,-0.18631,-0.196119,-0.159164,-0.228872,-0.120899,-0.0488652,0.190038,0.093504,-0.157526,-0.14236,-0.0463592},{0.278222,-0.0155356,-0.0778857,-0.195153,-0.16555,0.0721587,0.132477,0.125466,0.0519941,0.0945083,0.100595,-0.0388365,-0.138479,0.000686679,-0.0514062,-0.0783604,0.135189,0.118866,0.28756,0.155184,0.223051,0.128479,0.22972,0.190406,-0.0158065,-0.0420388},{0.722273,0.0533308,0.00496163,-0.141728,-0.235934,-0.10708,-0.225926,0.109798,0.0724546,0.00583612,-0.157971,-0.0554365,-0.170319,-0.048181,-0.052843,-0.087909,-0.106238,-0.0591272,-0.187812,-0.125226,-0.190522,-0.183418,-0.247142,-0.405419,-0.116892,0.136506},{0.359694,0.0266709,-0.0348312,0.0360535,0.0411491,0.103862,0.111606,0.11422,0.0784746,0.0146023,0.0165319,0.194478,0.268539,0.150347,0.201306,0.257012,0.0917427,0.135105,0.154229,0.103512,0.121381,0.148637,0.0533721,0.0364626,0.0433519,0.0327794},{0.512604,0.0294649,-0.0195527,-0.217967,-0.275947,-0.218095,-0.0723784,0.0311664,0.103326,0.21254,0.0205896,0.0371011,-0.0267101,0.0383627,-0.0731674,-0.204082,-0.119206,-0.0508701,0.0104686,0.217269,0.107728,0.0962553,-0.0674531,-0.256146,-0.110243,0.0660364},{0.0751608,0.0250033,0.0680005,0.237706,0.288568,0.247318,0.271286,0.232975,0.38989,0.162191,0.330952,0.36404,0.302765,0.314735,0.277471,0.360559,0.347656,0.291757,0.189414,0.312174,0.258704,0.18652,0.248855,0.303782,0.0594763,-0.0689523},{0.456832,-0.0679018,0.0357972,0.185011,0.0172163,-0.183862,-0.132807,-0.307751,-0.277244,-0.393616,-0.507303,-0.397954,-0.251272,-0.138266,0.0466812,-0.0186951,-0.22616,-0.37024,-0.593575,-0.635873,-0.304208,-0.00629625,0.162768,0.0415799,0.15246,-0.0747842},{0.515032,-0.0902946,-0.0580435,-0.0472334,-0.0999045,-0.0349745,0.0973153,0.091753,-0.0274645,-0.0869823,0.0136418,0.0327283,0.0504157,-0.0550045,-0.103197,0.0607877,0.0141102,-0.0658169,-0.150482,0.00429663,-0.105768,-0.0605441,-0.0895389,0.00235863,-0.170051,-0.0708952},{0.352316,0.0626738,-0.190136,-0.116976,-0.168141,-0.0698264,0.180299,0.149742,0.185018,0.034162,-0.331406,-0.401211,-0.215427,0.016492,0.168861,0.0303343,0.0443186,0.0910711,0.141679,0.137398,-0.00996818,-0.256078,-0.294648,-0.251211,-0.220291,-0.0616194},{0.334239,0.0192616,-0.0384661,-0.0183861,-0.100465,-0.162742,-0.126225,0.25328,0.440453,0.0577055,-0.538434,-0.48039,-0.166148,0.171674,0.162659,0.048087,0.101261,0.00641936,-0.0588682,0.110519,0.170415,0.0697928,-0.146556,-0.165479,-0.111568,0.0823998},{0.337153,0.030656,0.00626502,-0.00950224,0.024846,-0.265585,-0.744852,-0.133922,0.0125298,-0.0195357,0.0587,0.0781314,-0.00252469,0.0167378,0.170397,0.152975,-0.0298809,0.0336637,0.00908307,0.105427,0.276621,0.18589,0.0062622,-0.410377,-0.160296,0.119637},{0.755543,-0.043826,-0.161652,-0.453637,-0.56231,-0.285796,0.013877,-0.0423978,-0.107194,-0.316668,-0.377504,-0.555823,-0.358296,-0.321674,-0.409038,-0.332117,-0.369921,-0.521616,-0.533536,-0.538714,-0.403148,-0.135584,-0.25805,-0.317593,-0.213656,0.162838},{0.28525,-0.00258995,0.000861413,-0.0341119,0.0462287,0.146539,0.0473403,0.0380819,0.0918812,0.192461,-0.0645634,-0.0585319,0.0271265,0.00522523,0.064152,0.141467,-0.0219086,-0.106638,0.0289424,0.0961453,0.231991,0.0831492,0.0911112,0.0719754,-0.0517522,0.038957},{0.830549,-0.118359,-0.218031,-0.511572,-0.541996,-0.469341,-0.315667,-0.433606,-0.254131,-0.0955227,-0.393087,-0.626402,-0.811693,-0.933805,-0.782916,-0.665305,-0.534311,-0.584021,-0.488042,-0.435195,-0.272797,-0.189021,-0.213272,-0.347193,-0.195795,-0.015011},{0.992549,-0.183858,-0.30101,-0.551313,-0.867993,-0.632036,-0.0558174,-0.380908,-0.507591,-0.411045,-0.675819,-0.74791,-0.755457,-0.707987,-0.76576,-0.651043,-0.632203,-0.883251,-0.800901,-0.707124,-0.428589,-0.220226,-0.127512,-0.271027,-0.420938,0.0641702},{0.848239,-0.104838,-0.350015,-0.798992,-0.964032,-0.613729,-0.278463,-0.320666,-0.230383,-0.456988,-0.696145,-0.736863,-0.810509,-0.831101,-0.675531,-0.77346,-0.740126,-0.733854,-0.809646,-0.717904,-0.455041,-0.350888,-0.335181,-0.338283,-0.498138,-0.0026009},{0.485495,0.0452269,0.0601099,-0.173711,-0.358526,-0.515589,-0.500761,-0.48327,-0.476354,-0.227846,-0.153933,0.00446985,0.0544788,0.106702,-0.14583,-0.174634,-0.139297,-0.290053,-0.379878,-0.0253942,0.0877643,0.110736,-0.102356,0.05384,-0.027287,0.281185},{0.581434,-0.00703535,-0.0827859,-0.169717,-0.2203,0.0716184,0.040324,-0.138925,-0.062185,0.0444339,-0.0536939,-0.0706793,-0.0594564,-0.17608,-0.187792,-0.136021,-0.106542,-0.215293,-0.199954,-0.155054,0.0802,0.323303,0.203707,0.188582,0.147459,0.293585},{0.0270187,-0.00138026,0.15569,-0.00810729,0.234566,0.226881,0.138474,0.0134725,-0.104418,-0.0893322,0.00703162,-0.189781,-0.291188,-0.194892,-0.254364,-0.401696,-0.137961,0.171372,0.349399,0.348525,0.316795,0.186517,-0.0773134,-0.320269,-0.122837,-0.114543},{0.228137,0.0488803,0.066604,0.00499745,0.0774356,0.110144,0.0537744,0.073512,-0.138881,-0.137485,-0.19598,-0.0926568,0.0751194,0.313832,0.143727,0.188289,0.00194589,0.134556,0.231213,0.182541,0.253908,0.268994,0.225077,0.166636,0.138059,-0.0310445},{0.152114,0.0435232,0.0555853,0.128816,0.099735,-0.0990738,-0.376341,-0.228346,-0.173402,0.128134,0.344356,0.419087,0.382862,0.130079,0.0304659,0.0828994,0.25778,0.228155,0.223353,0.194393,0.13742,0.141793,0.090018,0.0696399,0.0765704,0.0210789},{0.267566,-0.0696363,-0.0937398,-0.198027,-0.159363,0.142043,0.285149,0.28939,0.271866,0.2553,0.169719,0.256059,0.0903711,0.0959042,0.0227492,0.140535,0.362222,0.585124,0.747312,0.757831,0.520839,0.148158,-0.162463,-0.152631,-0.267173,-0.00310502},{0.398029,0.035644,-0.0357166,-0.0762691,-0.162273,-0.0753423,-0.137779,-0.0060662,0.0356775,-0.0927009,-0.227344,-0.479716,-0.491722,-0.361329,-0.504018,-0.366717,-0.348146,-0.411116,-0.359645,-0.193145,-0.0909747,-0.0316143,-0.057072,-0.0764452,0.00885322,0.0920238},{0.654114,-0.00640442,-0.0990383,-0.256353,-0.417343,-0.20093,-0.0105058,0.0174163,-0.0634768,0.0611421,-0.0532917,-0.13636,-0.262944,-0.0431471,-0.00929703,-0.141148,-0.135066,-0.116155,-0.164952,-0.159955,-0.0125062,-0.162541,-0.282727,-0.417187,-0.310216,0.11214},{0.508398,0.0708923,0.0400436,-0.00689779,-0.108409,0.0489537,0.0605757,0.0884281,0.209419,-0.115768,-0.338483,-0.412199,-0.0540297,0.00545988,0.15448,0.202367,0.104431,0.0179638,-0.162585,-0.107754,0.0667307,0.179899,-0.0197388,-0.147059,-0.0915086,0.0303184},{0.222324,-0.0699527,-0.0313049,0.154088,-0.120304,-0.20995,-0.140172,-0.0603986,0.0122007,0.044948,-0.200523,-0.410455,-0.401635,-0.229739,-0.260536,-0.118859,-0.159081,-0.464764,-0.382753,-0.139302,0.0848503,0.110368,0.120384,0.0716265,0.0581918,0.102462},{0.297815,0.0347512,-0.114097,0.0424304,-0.0719014,0.0861366,0.232703,0.326639,0.260298,0.0499878,-0.0114397,0.0740875,0.181494,0.246597,0.14437,0.211052,0.124875,0.186726,0.127723,0.144903,-0.162054,-0.31298,-0.376522,-0.318095,-0.158701,0.0453673},{0.628588,-0.122516,-0.139943,-0.298485,-0.375734,-0.0649902,-0.0183362,0.0186349,-0.146666,0.00975519,-0.100522,-0.25918,-0.184528,-0.110214,0.078102,-0.116895,-0.0937045,-0.1533,-0.423821,-0.359385,-0.308655,0.0212735,-0.0236986,-0.157255,-0.00722162,0.113885},{0.520105,-0.0407528,-0.0688386,-0.290933,-0.302127,-0.266826,-0.161485,-0.0993365,-0.0455309,-0.207255,-0.272219,-0.291982,-0.158143,-0.215466,-0.140975,-0.260584,-0.181188,-0.273816,-0.19076,-0.153535,-0.275194,-0.064437,-0.13877,-0.137693,-0.229809,0.021421},{0.783718,0.0939676,0.078165,-0.179985,-0.175218,-0.0327974,0.198407,0.0681527,0.146083,0.125442,0.00677053,-0.21607,-0.311285,-0.314144,-0.142085,-0.175844,-0.0991236,-0.335745,-0.287647,-0.159233,-0.071956,0.132471,0.0855556,-0.00634968,-0.171569,0.0466092},{0.367237,0.034703,0.0893155,-0.118442,-0.0219702,-0.0130011,-0.230118,-0.219982,-0.0577338,-0.0618003,-0.0557319,-0.168036,-0.129714,-0.17169,0.0731069,0.0180195,0.13895,0.0346942,-0.0523385,0.0243943,0.171564,-0.0177957,-0.176152,-0.266614,-0.159226,0.202553},{0.355921,0.0300675,-0.0503076,-0.176408,-0.0116726,0.142139,0.193541,0.102563,-0.136496,-0.30424,-0.167276,-0.124128,0.0516723,0.156243,0.158307,-0.00116156,-0.115248,0.0477441,0.177089,0.21204,0.208028,0.143358,0.0363678,-0.0512335,-0.166398,-0.183379},{0.247121,0.00620048,-0.12049,-0.0471543,-0.152452,-0.177103,-0.297608,-0.316129,-0.297139,-0.232644,-0.329079,-0.0579236,-0.113731,-0.00866786,-0.0817813,-0.0876425,-0.21544,-0.0516918,0.0180374,0.0659243,0.0899257,0.0214076,0.0710762,0.139071,0.121629,-0.0809321},{1.05206,0.0212351,0.0767156,-0.210559,-0.348172,-0.234286,-0.435174,-0.173668,-0.242244,-0.101056,-0.228009,-0.33866,-0.321924,-0.215291,-0.35673,-0.251949,-0.0332644,-0.095015,-0.0834194,-0.201282,-0.0986948,-0.125785,-0.122041,-0.309038,-0.162106,0.257029},{0.608224,0.0408757,0.0245988,-0.253564,-0.258661,0.0428544,0.226055,-0.0860082,-0.0625606,-0.053685,-0.0591325,-0.0985067,-0.058599,-0.169072,-0.236341,-0.0321185,-0.103644,-0.222533,-0.307376,-0.318005,-0.121927,-0.0016772,0.062045,-0.030547,-0.126764,0.104179},{0.526562,-0.0369215,0.0530204,0.128616,0.242753,0.381492,0.351198,0.36146,0.417312,0.26999,0.122048,0.199071,0.311521,0.582148,0.47585,0.374764,0.244876,0.025219,-0.0973975,-0.00321636,0.0161411,0.115957,0.17928,0.307483,0.191694,-0.0191088},{0.378643,0.0769922,0.0700884,-0.101834,0.0993383,0.149022,0.299683,0.367358,0.244838,0.306376,0.213873,0.273736,0.224984,0.083028,0.108771,0.0297279,0.10076,0.183701,0.295319,0.402896,0.321438,0.166356,0.0706209,0.14154,-0.143804,-0.172571},{-0.0331151,0.164014,0.0796322,0.202942,0.486823,0.354532,0.364468,0.00164288,-0.162622,-0.173022,-0.170225,-0.0793355,0.104752,0.119131,0.0893012,0.0531514,-0.162828,0.104466,0.240445,0.644613,0.638557,0.330016,0.0789048,0.0918028,0.0305812,-0.112656},{0.110257,0.106729,0.0259224,0.0377097,0.2416,0.089863,0.253145,0.348784,0.265341,0.187598,0.0728415,0.0671307,0.151838,0.196956,0.16226,0.0948145,0.0947206,0.146085,0.145343,0.192693,0.180413,0.211792,-0.00162369,-0.0203194,-0.212973,-0.15075},{0.198795,0.0629661,-0.00659206,0.0112758,0.0888635,-0.0707207,-0.0510934,-0.138009,-0.140715,-0.03821,-0.185239,-0.181206,-0.196523,-0.35672,-0.428803,-0.327195,-0.00648868,0.102555,0.0347692,-0.164363,-0.25086,-0.154897,0.148352,0.30687,0.168431,0.153067},{0.520038,-0.0466983,0.042463,-0.0854568,-0.0441494,-0.103445,-0.104316,-0.0463059,0.158086,0.0900055,0.221161,0.0052717,-0.0866406,-0.0522539,0.0920312,0.262034,0.240139,0.148558,0.0440902,0.014541,0.0141334,0.0399209,0.0595151,0.0294631,0.162061,0.0479913},{0.461738,-0.0183655,-0.0585598,-0.104184,-0.208343,-0.0385006,0.029876,0.129732,0.223663,0.121284,0.107369,-0.206865,-0.105584,-0.164725,-0.0188943,-0.000701036,-0.0824863,-0.147569,-0.0476124,-0.0204479,0.169307,-0.0320898,-0.153337,-0.265045,-0.152936,0.0902725},{1.69254,-0.0591848,-0.407681,-0.852802,-1.61055,-1.22741,-0.739263,-0.374019,-0.245878,-0.625769,-0.943425,-1.13538,-0.951837,-0.877853,-0.836678,-0.927278,-0.947053,-0.933951,-1.17825,-1.02769,-0.651701,-0.30615,-0.420399,-0.877945,-0.581808,0.315303},{0.353772,0.0182038,-0.0124095,-0.094995,-0.159362,-0.245655,-0.455817,-0.188015,-0.0771574,-0.0604339,-0.102704,-0.109402,-0.0429014,-0.0979325,0.0347268,0.129507,0.16677,0.0876772,-0.098149,-0.0876547,-0.0918426,-0.0526365,-0.232887,-0.304836,-0.0843847,0.227296},{0.270347,0.0612983,0.130955,0.14225,0.0394119,-0.182408,-0.366035,-0.20224,-0.0993891,-0.00672136,-0.0106629,0.00417271,-0.0291027,0.0142539,0.00530519,-0.0351249,-0.0543281,0.117989,0.244935,0.219645,0.217703,0.0621693,-0.184942,-0.361046,-0.0710418,0.126354},{0.419777,-0.010643,-0.00158979,0.0520834,-0.0342863,-0.0250921,0.0596695,0.0290432,0.0142292,-0.0426405,0.0646409,-0.163786,-0.0329801,-0.120403,-0.0144849,0.069196,-0.0649601,-0.0325434,-0.156966,-0.0911141,-8.79184e-05,-0.0592787,-0.0401167,0.00475649,-0.1379,-0.0244115},{0.419162,0.0369528,0.00039237,-0.040002,-0.0696943,-0.0425353,-0.014241,-0.0166701,0.122193,0.140702,0.0747331,0.0991522,0.160598,0.0516302,0.148193,0.0669737,0.184984,0.0388739,0.016346,0.00596716,0.112025,-0.015778,0.00809352,0.00217799,-0.116555,-0.0717792},{0.613034,-0.0372567,-0.234734,-0.498491,-0.694814,-0.630138,-0.494037,-0.319855,-0.314497,-0.682815,-0.849974,-0.903072,-0.809417,-0.606152,-0.721947,-0.798743,-0.695542,-0.817266,-0.834515,-0.618862,-0.561989,-0.347756,-0.351679,-0.515556,-0.125247,0.393384},{0.534021,0.051905,0.0312265,-0.223761,-0.20231,-0.0284661,0.087827,0.0559434,0.133868,0.0972785,-0.218404,-0.483026,-0.456241,-0.224024,-0.326683,-0.310879,-0.256433,-0.413658,-0.440751,-0.172301,0.0390341,0.0125535,-0.0631456,-0.0971955,-0.0556835,0.0910048},{1.40949,0.0277917,-0.251492,-0.714431,-0.994764,-0.933182,-0.862807,-0.334934,-0.137497,-0.35318,-0.863993,-0.984251,-0.994299,-0.754601,-0.596658,-0.741749,-0.730941,-0.770384,-0.810063,-0.780909,-0.570248,-0.372948,-0.32496,-0.751193,-0.282991,0.319673},{0.151208,0.0930378,-0.000106035,-0.040579,-0.176821,-0.0895018,-0.0636171,0.0112784,0.090674,0.42185,0.3638,0.289872,0.258527,0.401427,0.262408,0.381468,0.448307,0.311831,0.207419,0.21584,-0.0171242,0.0960704,-0.0360008,0.0195014,-0.0513262,0.0655095},{1.21536,-0.0713328,-0.264962,-0.588371,-0.931442,-0.510422,-0.248597,-0.223798,-0.278099,-0.560056,-0.830365,-0.993947,-0.909671,-0.72885,-0.679377,-0.78428,-0.925842,-0.919873,-0.708191,-0.646367,-0.318203,-0.261946,-0.253124,-0.501706,-0.283228,0.186736},{0.085357,0.0103114,-0.03179,0.0391423,-0.146041,-0.125364,-0.147501,-0.0895566,-0.139771,-0.124676,-0.17822,-0.174006,-0.241564,-0.10179,-0.135246,-0.0820645,-0.0916914,-0.0782526,-0.0351821,-0.0524103,-0.262117,-0.209213,-0.000709915,-0.0446279,-0.0675259,-0.0766838},{0.454783,0.0270582,0.242235,0.147786,0.173758,-0.0696383,-0.11166,-0.290779,-0.246997,-0.0829208,-0.343322,-0.419969,-0.291157,-0.162709,-0.0360159,0.0671344,0.083736,0.208066,0.18113,0.255067,0.262147,-0.17738,-0.559523,-0.381802,-0.0308451,0.0547432},{0.65658,-0.027798,-0.13596,-0.413341,-0.387776,-0.0374504,0.0779496,0.115514,-0.115481,-0.330485,-0.547457,-0.544746,-0.191436,-0.0902716,-0.087801,-0.25524,-0.163344,-0.250658,-0.166086,-0.146317,-0.174925,-0.122279,-0.206095,-0.224588,-0.0928677,0.0188035},{0.332204,-0.0184209,-0.0285952,0.0838381,-0.0229127,0.222918,0.286387,0.172028,0.162715,0.028076,0.278025,0.366321,0.379452,0.300325,0.258342,0.275975,0.249793,0.199663,0.20775,0.324324,0.365741,0.0853969,0.159955,0.00283022,-0.0641464,-0.0887032},{0.433382,-0.0152309,0.0252881,-0.0891815,-0.259793,-0.113039,0.207791,0.0745697,0.0769227,0.001943,-0.11875,-0.295098,-0.162837,-0.163124,-0.137087,-0.142788,-0.0577202,-0.117379,-0.0959491,-0.228538,0.0116688,-0.0659288,0.137915,0.129975,0.102067,-0.01509},{0.605731,0.046897,0.0153286,-0.132275,-0.306071,-0.254751,-0.425175,-0.374457,-0.402974,-0.290785,-0.196895,-0.125011,-0.111206,-0.138347,-0.367118,-0.256775,-0.0925211,-0.0273296,-0.0263277,0.113701,0.192258,0.149836,0.130322,-0.0126881,-0.226745,0.146334},{0.788888,-0.0116519,0.0287486,-0.0741703,-0.411736,-0.241443,-0.197936,-0.205051,-0.161422,-0.00814975,-0.0475667,-0.143688,-0.205635,-0.22117,-0.260554,-0.132264,0.0445116,0.0402847,0.0131652,-0.133433,0.000824513,-0.0307645,0.0140406,-0.108845,0.0103991,0.160634},{0.468697,0.0326168,0.0818877,-0.0718607,-0.0839233,0.0721719,0.212058,0.108315,0.196391,0.0779832,0.364708,0.350933,0.241289,0.29213,0.162967,0.0769532,0.0587922,0.131623,0.371263,0.307262,0.163083,0.02848,-0.0412669,0.049274,-0.168331,-0.145947},{0.417172,0.0858586,0.00379309,0.0698785,0.109554,0.0731435,0.207559,0.0841713,0.0571815,0.132202,-0.0904492,-0.142841,-0.121202,-0.242351,-0.1733,-0.107378,-0.338533,-0.239339,-0.280831,-0.208772,-0.102619,-0.0654521,0.0124162,0.24861,0.172667,-2.65353e-06},{0.293203,-0.0545591,-0.163892,-0.349953,-0.497067,-0.483621,-0.318775,-0.217732,-0.282516,-0.119084,-0.0454687,-0.0420435,-0.270409,-0.471488,-0.458989,-0.359234,-0.359773,-0.20867,-0.0549515,-0.164347,-0.166606,-0.194752,-0.137665,-0.0850083,-0.0963665,-0.00481902},{0.425233,0.0615999,0.126989,0.0486487,-0.156928,-0.0740281,0.0838451,0.0552187,0.0171431,0.248391,0.313119,0.335618,0.344246,0.152371,0.135424,-0.0342663,0.0560555,0.174282,0.208991,0.243507,0.0392613,-0.00421998,-0.145059,-0.0923814,-0.27872,-0.143469},{0.291762,0.0700954,0.0290566,-0.0326145,-0.0151976,0.0146418,0.186813,0.184544,0.222762,0.0772387,0.00833375,-0.170081,-0.112803,-0.0840138,-0.0686515,-0.0191894,-0.0310137,-0.0556618,-0.0416649,-0.0256068,-0.0192664,-0.0454363,-0.0290614,-0.130285,-0.143245,-0.0757223},{0.112302,-0.0750663,0.125147,0.0687563,-0.00742965,0.0893391,0.184712,0.24161,0.277699,0.263922,-0.0028766,-0.0220092,-0.0461966,0.038157,0.171261,0.026772,-0.000461084,0.0206359,0.0823313,-0.029496,-0.225313,-0.226845,-0.115304,-0.143459,-0.109941,-0.0122895},{0.451825,0.0254107,0.0456055,-0.0373102,-0.11144,-0.0201081,0.142368,0.136962,0.0414142,0.134752,-0.143701,-0.136992,0.00506109,0.0104476,-0.132493,-0.0864666,0.0340796,-0.0892278,0.0461504,0.125091,0.12822,0.174772,0.295332,0.205066,-0.0370002,-0.0480608},{0.428,0.0330355,-0.00879799,-0.00705148,-0.0648246,-0.0932353,0.0719884,-0.104866,-0.0624834,0.118633,-0.0663657,-0.0432837,-0.151398,-0.077521,-0.23236,-0.0967519,-0.0477227,-0.113449,-0.0593019,0.117255,0.216708,0.0762851,0.0968893,0.0378941,0.217947,-0.0228219},{-0.186692,0.077396,0.225352,0.410782,0.682391,0.659349,0.573268,0.552678,0.622244,0.630315,0.472633,0.388963,0.429486,0.417112,0.344719,0.488544,0.342917,0.309915,0.414447,0.563376,0.534105,0.318936,0.369576,0.527126,0.361215,-0.0306991},{0.55224,0.0568374,0.0438834,-0.192821,-0.123353,-0.102622,-0.19255,-0.202195,-0.0326638,-0.0057844,-0.0386594,-0.0633463,-0.258863,-0.325049,-0.313372,-0.331738,0.0729295,0.0999277,0.273475,0.00603664,-0.209261,-0.325762,-0.193751,-0.570448,-0.527679,0.104154},{0.0597672,0.128366,0.123663,0.208839,0.41541,0.12305,-0.0853163,0.177093,0.121652,0.139389,0.114074,0.133477,-0.00697442,0.150391,0.167866,0.211545,0.193968,0.411763,0.207336,0.192016,0.0338776,0.0555155,0.134851,0.102931,0.168769,-0.0220632},{0.526288,0.0201998,0.142831,0.0126751,0.0104528,-0.00391575,-0.24823,-0.36405,-0.317743,-0.308079,-0.277035,-0.233417,-0.0948414,-0.112199,0.00251635,0.15328,0.166536,0.0325578,-0.201139,-0.208025,0.0894731,0.0912113,0.0336312,-0.00315109,0.0207572,0.0444358},{0.404838,-0.0737899,0.0590427,0.031152,-0.0420805,-0.0751189,-0.0264808,0.0812313,0.0625509,0.273597,0.162767,0.0569645,-0.0846612,-0.0178029,-0.113935,0.0874489,0.100086,0.00482631,-0.20165,-0.281684,-0.392101,-0.209352,-0.0164026,0.0612332,0.0709618,0.196154},{0.577101,0.0328785,-0.0810322,-0.275624,-0.470986,-0.145435,0.177798,-0.0874752,-0.141876,-0.0899856,-0.325711,-0.322978,-0.37547,-0.327727,-0.286636,-0.344488,-0.375185,-0.248597,-0.348513,-0.205919,-0.1016,-0.0862738,-0.198833,-0.0223477,-0.222153,0.0055761},{0.260903,0.0774251,-0.0323476,-0.0256665,0.0678858,0.167326,0.10305,0.220806,0.0856553,0.238599,0.0940273,-0.159894,-0.0610861,-0.125925,-0.106762,-0.216383,-0.194321,0.101537,0.0522963,0.0607593,0.111901,-0.104116,-0.343416,-0.499327,-0.277088,0.000408352},{0.583679,-0.11661,-0.176811,-0.522688,-0.664467,-0.291327,0.156832,0.184701,0.219952,-0.231182,-0.318369,-0.163596,-0.0536087,-0.0673059,0.0189245,-0.072882,-0.169912,-0.333302,-0.491203,-0.24668,-0.215484,-0.0308206,-0.0378154,-0.2708,-0.342934,0.159053},{0.721448,-0.0982987,-0.0937802,-0.385255,-0.526632,-0.33936,-0.167513,-0.265026,-0.260702,-0.377484,-0.523248,-0.551496,-0.481608,-0.392066,-0.336067,-0.511165,-0.50095,-0.500064,-0.328234,-0.105112,-0.0831748,-0.110349,-0.0930677,-0.127911,-0.151925,0.0887076},{-0.203544,0.11749,0.0754724,0.48353,0.652677,0.430114,0.113987,0.279903,0.53755,0.697734,0.36418,0.390444,0.309578,0.369288,0.548483,0.592242,0.60117,0.504131,0.50294,0.369833,0.334873,0.185631,0.00665941,-0.155734,0.010842,-0.149506},{0.301479,0.131081,0.190851,0.124379,-0.043751,-0.0101913,-0.128972,-0.0238011,-0.195606,-0.0115572,0.142011,0.212819,0.338808,0.264278,0.269168,0.159973,0.0454378,0.158017,0.124007,0.21834,0.162059,0.055518,-0.0136743,0.0219446,0.0324394,0.139197},{0.34136,0.0704707,-0.0231415,-0.126562,0.0544838,-0.0130728,-0.13668,-0.0450838,0.176608,0.116726,-0.139428,-0.0848694,0.0666994,0.0338706,-0.05623,0.0614436,-0.0666957,0.0458674,-0.0267966,-0.0468811,-0.00999511,0.151378,0.177717,0.0909584,-0.0250433,-0.0399057},{0.649823,0.0822737,0.00729035,0.0132451,-0.0401496,0.0143325,-0.121675,-0.0239844,-0.187889,-0.112887,-0.192561,-0.300913,-0.331857,-0.26769,-0.205972,-0.203283,0.0143083,-0.0759653,0.0140542,-0.01068,-0.0491057,-0.133943,-0.171679,-0.180643,-0.142704,0.0163461}};
+static DTYPE_WEIGHTS_WCI_fw WCI_fw_in[NUMBER_OF_NEURONS][NUMBER_OF_INPUTS_NONRECURRENT] = {{0.267305,-0.127297,0.0861631,0.177951,0.121501,-0.0654159,-0.0438896,-0.132657,-0.0130093,0.0286562,-0.178751,-0.226092,-0.199504,-0.109798,0.0705912,0.0129066,-0.0281848,-0.174965,-0.114358,0.0248986,0.0835895,0.107796,0.0713111,0.0624821,0.194973,-0.156239},{-0.525302,-0.0191399,0.190845,0.432356,0.73637,0.215622,-0.0378059,0.0328368,0.275413,0.313413,0.242821,0.136483,0.275065,0.631631,0.860223,0.666853,0.66211,0.889383,0.695328,0.521579,0.511697,0.286198,0.132711,-0.137523,-0.0321254,-0.151109},{-0.208576,-0.0778837,0.0536588,-0.0277043,-0.0513383,0.177613,0.217659,0.101686,0.222444,0.108357,-0.0878804,-0.091891,-0.0272968,0.383317,0.0763759,-0.643265,-1.29658,-1.03408,-0.405068,-0.0943703,-0.0750002,0.0486553,0.14696,0.165941,0.0105594,-0.00606783},{0.296081,-0.403312,-0.532906,-0.376794,0.0231524,0.012197,-0.054351,-0.316729,-0.521235,-0.522362,0.0407188,0.153217,0.307005,0.0674489,-0.0633067,-0.0405423,-0.0715616,-0.107388,0.00305182,-0.0738914,-0.110513,0.0580944,0.113698,0.186628,-0.00562214,-0.142842},{0.318943,0.00903678,-0.125371,-0.0112152,0.00948498,-0.262624,-0.35526,-0.23417,-0.591212,-0.5052,-0.217839,-0.340887,-0.373671,-0.193734,-0.242575,-0.105778,0.10385,0.334884,0.16278,-0.0820123,-0.0610375,-0.104417,-0.159917,0.102957,0.243778,-0.0259031},{-0.946048,0.151072,0.401051,1.00934,1.51822,0.716609,0.311429,0.421145,0.461552,0.485645,0.589685,0.833842,0.793977,0.838594,1.29423,1.32446,1.07576,0.9005,1.11084,1.02563,0.767618,0.661762,0.589109,0.572815,0.614555,-0.201399},{-0.200644,0.100919,-0.0147313,0.0268363,-0.0272585,-0.499301,-0.433885,-0.546286,-0.344431,0.303453,0.649426,0.632844,0.73502,0.291942,-0.11056,-0.272335,0.0421397,0.408733,0.319875,0.0357792,-0.0268773,-0.0835756,-0.07144,-0.119444,0.0987725,0.0926701},{0.257791,-0.0918239,-0.0555325,0.0758762,0.0545055,-0.141578,-0.072858,-0.291902,-0.0772566,0.0928728,0.105664,0.221219,0.0676795,-0.216291,-0.166693,0.0700623,0.469963,0.740994,0.2128,-0.231748,-0.216947,-0.3515,-0.265328,-0.115372,0.0950985,-0.0154416},{-0.000995202,-0.0276162,-0.0203328,-0.00914219,-0.288687,0.299139,0.723569,0.501723,0.348278,-0.154944,-0.502397,-0.375546,-0.0858968,-0.0282412,-0.330662,-0.418888,-0.312811,-0.462469,-0.3907,-0.38341,-0.144213,-0.354452,-0.408946,0.0017563,-0.0381911,-0.0561404},{-0.312744,0.0148095,-0.0428176,-0.0340892,-0.0792563,-0.103485,0.245335,0.484036,0.438711,0.11167,0.0994159,0.0307181,-0.135258,-0.0826861,0.197735,0.417747,0.461613,0.314963,0.300077,0.214549,0.220784,-0.110351,-0.20249,-0.0781095,0.16664,0.0204639},{1.69389,-0.050994,-0.0489606,0.00964458,-0.153623,-0.364174,-0.140308,-0.172757,0.0436403,0.597799,0.911091,0.645922,0.301449,-0.209739,-0.230138,0.0803333,0.405123,0.488571,0.13867,-0.391911,-0.493112,-0.20142,-0.0946018,-0.423768,-0.134323,-0.0519633},{-0.305387,0.318608,0.0598114,-0.169268,-0.124781,-0.0741383,0.122458,0.355509,0.478402,0.497905,0.47059,0.296348,-0.274059,-0.776105,-0.578026,-0.122406,0.181301,0.0758972,0.122955,0.403164,0.209674,0.381826,0.38716,0.29352,0.0417646,0.0206654},{0.239483,-0.0670445,-0.00714206,-0.067621,-0.0461816,0.0654504,0.119517,0.207167,0.1601,0.0781132,0.104161,0.235473,0.139705,0.449866,0.580849,0.649435,0.471487,0.451425,0.601048,0.329507,0.055633,-0.212978,-0.299523,0.0332998,-0.0950661,-0.0311008},{-0.229534,0.0567917,0.0254694,0.107591,0.123415,-0.0102293,-0.0357908,-0.228027,-0.346549,-0.898371,-1.93228,-1.67936,-0.247427,0.954584,1.11847,0.89254,0.683228,0.736645,0.641558,0.39699,0.121308,-0.28939,-0.504273,-0.219901,0.0703651,0.00357216},{0.668927,-0.230011,-0.508847,-1.05997,-1.7609,-0.903547,0.225349,-0.89432,-0.779555,-0.704429,-1.245,-1.80997,-1.92259,-1.50101,-1.38619,-1.16054,-0.945763,-0.935497,-1.01859,-1.09972,-0.913854,-0.909133,-0.709142,-0.51314,-0.179245,0.733725},{0.323439,-0.00296353,-0.0327259,-0.119944,-0.0226838,0.0303714,0.146512,0.0297679,0.110998,0.30738,0.215142,0.176897,0.131,0.0515599,0.153036,0.232704,0.273027,0.211268,0.110912,0.0981897,-0.0258331,-0.15116,-0.0229879,0.0176431,0.0106177,0.0879919},{-0.42064,-0.0265306,0.017294,0.00200679,0.0060863,-0.0846283,-0.0839101,0.118711,0.0848061,0.1108,-0.0747723,0.0150669,-0.0622566,-0.000680797,-0.0777404,0.0330177,0.105837,0.0969595,-0.0484199,-0.105405,0.0387081,0.0459872,0.145976,0.013842,0.0356327,-0.00483892},{0.584031,0.193316,0.189406,0.0957005,0.026752,-0.0194484,-0.107524,-0.148787,0.0140983,0.0374811,-0.0940059,-0.0224627,0.086013,0.300729,0.19729,0.174498,-0.0809945,-0.441207,-0.678463,-0.663492,-0.369976,-0.341907,-0.204017,-0.0485493,-0.00437585,0.0585492},{-0.0372674,-0.0270803,0.0362697,0.0224316,0.0328379,0.0811165,0.0447218,-0.0167452,0.142278,0.206199,-0.128425,-0.189973,-0.120294,-0.0168001,-0.401953,-0.791255,-0.149701,0.331249,0.092057,0.156154,-0.217276,0.507458,0.596904,0.0287344,-0.0529465,0.0488813},{-0.269291,-0.049035,-0.0563049,0.0682225,0.0785618,-0.0333133,-0.187871,-0.560092,0.155908,0.398295,0.128199,0.213129,0.192271,0.0910482,-0.456179,-0.760449,-0.0974597,0.771771,0.702527,0.275512,-0.200211,-0.102045,0.0460321,-0.049762,0.00471813,-0.0278055},{-0.0430067,0.0968546,-0.0108353,0.00682628,-0.182464,-0.273703,-0.279898,-0.39509,-0.149732,0.17815,0.266887,0.26848,0.272997,0.283271,0.288425,0.438531,0.414919,0.270083,0.180924,0.0904592,0.0111739,-0.281711,-0.444371,-0.155847,-0.152752,0.0500882},{0.721148,0.0185084,0.0919233,0.0160311,0.109058,-0.129202,-0.16271,-0.10141,0.101992,0.0101955,-0.124961,-0.177767,-0.0880149,0.335359,0.457027,0.213805,-0.173889,-0.106238,-0.0164502,-0.0680412,-0.183599,-0.853508,-0.899603,-0.403112,0.177776,-0.100726},{-0.199516,0.110049,0.102994,0.104928,0.14717,-0.0105645,-0.207437,-0.344451,-0.233042,-0.155198,0.0125663,0.289079,0.845723,0.72977,0.222257,-0.0240127,-0.402743,-0.817409,-1.13289,-1.14222,-0.582582,0.171818,-0.0555188,-0.0748659,0.110292,0.04547},{0.313926,-0.00511353,0.0299988,0.0124178,-0.109366,0.0227066,0.133138,0.0779971,0.490749,0.0408579,-0.419945,-0.409236,-0.64023,-0.507854,0.0457191,0.257707,0.551319,0.347099,-0.158911,-0.329275,-0.434196,-0.147314,0.0116167,-0.0763368,0.140406,-0.0593239},{-0.0879754,-0.0454874,-0.000759109,-0.0527505,-0.0135187,0.02106,0.037523,-0.152385,-0.540042,-0.719035,-0.926667,-0.980756,-0.666168,0.233804,0.555632,0.215357,-0.292058,-0.161639,0.0451167,0.137601,-0.0634893,-0.102691,0.0330649,0.0269086,0.0890841,0.0256409},{2.32611,-0.269066,-0.693132,-1.57471,-2.33233,-0.850782,1.45842,-0.208781,-0.622111,-1.20607,-1.49107,-1.86901,-1.82814,-1.83751,-1.77585,-1.85686,-1.81087,-1.7012,-1.58916,-1.36256,-1.12469,-0.814781,-0.714789,-0.187788,-1.3487,-0.747531},{-4.83238,0.858699,2.29834,5.42098,7.37936,3.36337,0.795626,1.90863,2.64901,3.948,5.1699,6.19995,6.09041,5.22832,4.78186,4.99571,5.31151,6.55397,7.17314,6.14762,4.18629,2.43263,2.0544,1.95562,1.12839,-2.18933},{-0.553517,-0.0240946,-0.0552826,0.0602049,0.19103,0.035303,-0.0353906,-0.0972027,0.0733665,0.121818,-0.0511635,-0.163425,-0.105418,0.116289,0.0776012,-0.0757511,0.0282847,0.124816,0.192267,0.0818612,0.111223,-0.00701743,-0.107034,0.0252287,0.111878,0.0978828},{1.56171,-0.27404,-0.470189,-0.921661,-1.74674,-1.17938,-0.96697,-0.638009,-0.5352,-0.772031,-0.880318,-1.10893,-1.13278,-1.16103,-1.37311,-1.27201,-1.11558,-1.04381,-1.24845,-1.13878,-1.02954,-0.876661,-0.861254,-1.04754,-0.109626,0.479633},{-0.14126,0.0593213,-0.0688362,-0.0193887,-0.0287313,-0.0473193,-0.136414,-0.276559,-0.29368,0.5933,0.943134,0.0316356,-1.02962,-0.789777,-0.0978697,0.159684,0.346313,0.0971589,-0.178139,0.0629482,-0.0377898,-0.0352306,0.0870966,-0.0731413,0.0361652,-0.0276305},{-0.39576,-0.0145138,-0.118759,-0.179701,0.091733,0.0598872,0.128015,0.183864,-0.0114673,-0.18834,-0.36667,-0.628615,-0.7433,-0.312862,-0.138818,-0.315083,-0.348385,-0.205608,-0.0334078,0.138269,0.156603,0.11407,0.193412,0.0852177,-0.0689945,-0.0488341},{-0.390095,0.153629,0.0521085,0.0317885,0.0984672,0.305695,0.255416,0.125746,0.103183,0.0546074,0.150171,0.0382936,0.158209,0.224032,0.148477,-0.000240488,-0.078936,0.116354,0.0641302,0.124305,0.0360513,0.0639715,-0.102328,0.0323391,-0.0321063,0.0618109},{-0.153627,0.0355319,0.0707785,-0.137402,-0.0884052,0.0308568,0.0372468,0.00511811,-0.356997,-0.235495,0.236786,0.194932,0.252467,0.0645587,0.117786,-0.0318894,-0.0747824,0.0946166,0.105801,-0.0377128,0.0617165,0.183653,0.105904,0.0852016,-0.00317273,-0.0830649},{-2.65587,0.553543,0.785451,1.78266,2.91233,1.73481,-0.809876,-0.125321,0.156421,0.782316,1.331,1.52995,1.43296,1.45154,1.32729,1.4418,1.76718,2.06037,2.29611,2.04437,1.80083,1.07909,0.392354,0.186519,0.461713,-0.14652},{0.618913,0.0738664,-0.0473112,0.178377,0.0723794,-0.0612344,0.0783966,-0.00936013,0.0731207,-0.0204787,-0.0606265,-0.16234,-0.117447,-0.188449,-0.201387,-0.0933226,-0.0186955,-0.214442,-0.110275,0.0372351,0.243519,-0.177022,-0.296839,-0.0983992,-0.12503,-0.0187155},{-2.09566,0.394583,0.69799,1.59071,3.07297,2.17912,0.836304,0.793393,0.968426,1.4597,1.98788,2.2819,2.15589,2.19404,2.24333,2.21915,1.97755,2.00545,2.16296,1.96743,1.82027,1.52648,1.4274,1.73702,1.53664,-0.0667448},{0.00292255,-0.0644048,0.0447393,-0.041527,0.102387,0.328762,0.494615,0.430652,0.36592,-0.363293,-0.806593,-0.766962,-0.602432,0.0289302,0.690256,0.498785,0.328108,0.388968,0.0115531,-0.576748,-0.250856,-0.0328004,-0.348786,-0.479142,-0.0987279,-0.0199722},{-0.341673,0.0849047,0.0161228,-0.0648609,-0.114926,0.144901,0.102794,-0.0487391,0.00144293,0.168831,0.0129313,-0.0827499,-0.0570882,-0.261095,-0.231699,-0.218193,-0.386947,-0.643246,-0.543061,-0.0490338,0.424262,1.21273,0.573895,0.155277,-0.139488,-0.211196},{-0.291736,0.0503719,0.36735,0.601841,0.959126,0.72896,0.536154,0.186878,0.141113,0.0162841,0.555507,1.33873,1.89279,1.68791,1.27961,1.06488,0.780404,-0.154257,-0.550059,-0.566466,-0.0870238,0.394518,0.671122,0.77138,1.01702,-0.113462},{-0.306656,-0.248213,-0.615739,-0.115051,-0.200437,-0.318946,-0.328923,-0.248975,-0.440362,-0.492182,-0.658764,-0.423362,0.0116874,-0.0375552,-0.246161,-0.256092,-0.275192,-0.115806,-0.174928,-0.085518,-0.0384733,0.116116,-0.312923,-0.280321,-0.336866,-0.219726},{0.153136,0.0242779,-0.0287855,-0.00852901,0.0633901,-0.277903,-0.616033,-1.0449,-0.996914,-0.658723,-0.380967,-0.326991,-0.348421,-0.0470295,0.237375,0.441461,0.731545,0.166137,-0.524941,-0.350487,-0.283469,0.0328892,0.300833,0.093915,0.243808,0.0602523},{-0.231431,-0.0456486,-0.0316035,-0.0963777,-0.0476088,0.216169,0.182205,0.146475,0.0842726,0.183022,0.192295,-0.0201367,0.0521077,0.0302587,-0.00677921,0.0233192,0.155047,0.101164,-0.0442801,0.147161,0.0792338,0.299557,0.181831,-0.392092,-0.298647,0.076911},{-1.1504,0.106418,0.320912,0.697601,1.03936,0.456683,-0.0426205,0.0300504,0.301228,0.920376,1.03614,1.11727,0.881333,0.388981,0.315181,0.592823,0.735799,1.07425,1.06633,0.845745,0.154409,0.313826,0.599234,0.529263,0.21367,-0.340609},{0.385484,-0.0771528,-0.0923221,-0.408116,-0.823559,-0.268818,0.821753,-0.0111997,0.150176,0.215465,-0.270581,-0.403436,-0.15122,-0.492825,-0.953198,-0.963214,-0.70257,-0.50639,-0.277792,-0.339095,-0.324068,-0.308522,-0.0889079,-0.0391113,-0.382356,-0.12862},{-0.642549,-0.0186846,0.0638237,-0.0297661,-0.0235879,0.00364294,0.0353648,0.119956,0.314499,0.0955356,-0.168896,-0.277102,-0.0260146,0.0305371,-0.0329171,0.00810208,0.193223,0.112653,0.233372,0.292077,0.0714776,-0.428072,-0.309893,-0.0253475,0.0966909,0.0537275},{1.01309,0.0164707,0.0770354,0.210981,-0.221146,-0.198404,0.203852,0.232191,0.333466,0.37232,0.160766,0.142237,0.0362083,-0.28783,-0.486394,-0.286887,-0.0680979,0.158053,0.328687,0.231329,0.138977,-0.120763,-0.386619,-0.254699,-0.0779554,0.129991},{0.681188,-0.0361618,0.0590389,-0.00510623,-0.228376,-0.128876,-0.351568,-0.111764,-0.288883,-0.834386,-0.996936,-0.784835,-0.299409,0.146858,0.146747,-0.156255,0.0225893,-0.0496249,-0.279894,-0.302723,-0.175512,-0.379196,-0.5928,-0.424186,0.14749,0.214889},{-0.286474,0.0719492,-0.0085758,-0.137639,-0.00799893,0.27536,0.621987,0.617953,0.708019,0.155606,-0.202005,-0.475325,0.227923,0.564777,-0.288484,-0.688969,-0.563223,0.123075,0.579886,0.826207,0.79354,0.187548,-0.136513,-0.317395,-0.241912,0.011946},{0.612729,-0.0208543,-0.102268,-0.335327,-0.402167,-0.411736,-0.161716,-0.098104,-0.0898792,-0.254942,-0.292158,-0.357385,-0.239365,-0.281096,-0.211536,-0.247851,-0.282858,-0.279792,-0.355617,-0.283338,-0.222229,-0.240774,-0.126019,-0.356691,-0.2035,-0.120277},{-0.20546,-0.00352876,-0.0432104,-0.0218601,0.0937146,0.102633,-0.0451977,-0.0969421,-0.0472087,-0.0569137,0.0229534,0.230947,0.563103,0.589857,0.430599,0.289353,0.0761252,0.236763,0.221225,0.248911,0.255536,0.0903833,-0.0247774,-0.00488502,-0.119199,0.0151584},{0.210949,0.126286,0.0635941,-0.000294891,0.0793654,0.205399,0.160659,0.0992054,0.00354277,0.195003,0.446303,0.450096,0.158139,-0.0715843,-0.265893,-0.544321,-0.85706,-0.618938,-0.431924,-0.319746,0.128061,0.0210493,-0.419185,-0.255482,0.0323233,0.0246135},{0.407879,-0.0174068,0.0960453,0.0693166,0.262184,-0.0619561,-0.216234,-0.125144,-0.556662,-0.989542,-0.415991,-0.0884475,0.0276915,-0.151276,-0.539773,-0.899468,-0.602475,0.424107,0.805156,0.287788,0.107432,0.141484,-0.0274147,0.151459,0.0842655,0.145585},{-0.668366,0.0849839,0.329374,0.537389,0.933898,0.486968,0.423768,0.635522,0.88133,1.01125,1.25814,1.34356,1.04293,0.945538,1.05822,1.25575,1.13158,1.02084,0.995035,0.844492,0.457895,0.452247,0.608,0.583782,0.531038,-0.193107},{-0.117474,0.0488082,0.0758725,-0.164624,0.0471501,0.148064,0.18897,0.28927,-0.141939,-0.200488,0.0877666,0.111457,0.188994,0.033594,-0.0850241,0.0359895,0.507363,0.747474,0.504139,0.41318,0.408464,0.0162676,-0.175694,-0.0096687,-0.0885538,0.100339},{-0.0886227,-0.00686475,0.206065,-0.00710217,0.00101239,-0.226989,-0.475863,-0.426994,-0.459052,-0.797951,-0.953385,-0.928987,-0.58235,0.111716,0.335883,0.277153,0.469815,0.399402,-0.242638,-0.717497,-0.631004,-0.13307,0.0738961,-0.163229,0.12589,0.0123331},{0.647694,-0.07348,0.097292,0.0213662,-0.0391757,-0.256859,-0.27107,-0.188055,0.0171006,-0.340643,-0.425213,-0.440094,-0.316779,-0.60155,-0.547756,-0.309902,-0.529395,-0.334869,-0.191554,-0.108243,-0.163656,-0.292424,0.18112,0.411363,0.0771872,0.023931},{0.133315,-0.132933,0.105121,-0.0146725,-0.0937747,0.123135,0.131232,0.158719,0.213518,-0.179349,-0.528948,-0.662844,-0.894716,-0.716625,-0.503414,-0.139836,-0.0161613,0.339385,0.583843,0.421757,0.242632,0.137386,0.131081,-0.0153782,-0.0466298,0.0667922},{0.71721,-0.0660939,0.246523,0.525497,0.621564,0.182726,0.108079,0.546366,0.412472,0.53109,0.670709,0.886313,0.942613,0.959434,0.938058,0.694998,0.315739,0.173996,0.13851,-0.071524,0.076491,0.533793,0.279668,0.112212,0.167076,-0.000954236},{0.0256466,-0.0835519,-0.140843,0.0476159,-0.376685,-0.0243002,0.17105,0.140058,0.144563,0.332645,0.375525,0.141786,0.152039,-0.139322,-0.311104,-0.287801,-0.0125929,0.296994,0.37766,0.426324,0.240906,-0.02721,0.117857,0.265169,-0.0777072,0.0450255},{-0.470447,0.168909,-0.350521,-0.00618776,-0.364886,0.0017543,-0.0272433,-0.213068,-0.464516,-0.275153,0.120749,0.225497,-0.183669,-0.323824,-0.456989,-0.226658,0.0815005,-0.110339,-0.325115,-0.27575,0.163624,0.228562,-0.328785,-0.897087,-0.91188,0.50444},{0.170571,0.099844,0.0404938,-0.140022,-0.103544,0.00149888,-0.0183552,-0.267239,-0.138441,0.722747,1.03419,1.41426,1.29538,-0.755025,-1.8664,-1.13688,0.0233694,0.456124,0.280091,0.432269,0.516488,-0.0807373,-0.0428044,0.0446184,-0.16781,0.0152097},{-0.102047,-0.0575284,-0.00727461,-0.236862,0.0487867,-0.0732618,-0.101755,-0.454428,-1.00009,-1.29208,-0.674612,0.149196,0.722102,0.952395,1.408,1.33256,0.317982,0.0400869,0.0948057,-0.0681786,-0.092918,-0.0615605,-0.0694935,-0.0462637,0.144971,0.0732306},{0.42493,-0.0999503,0.012443,0.0794146,0.0810945,-0.10576,-0.347311,-0.380599,-0.15211,-0.0276272,-0.58192,-0.275631,-0.347098,-0.346611,0.00901321,0.412165,0.204208,-0.272819,-0.504453,-0.328057,-0.0368285,0.318056,-0.0255069,-0.164233,-0.0975698,0.19206},{-0.113625,-0.0624932,0.0667577,-0.0539615,0.002862,0.0898401,0.264038,0.244748,0.291084,0.157953,0.150194,0.263426,0.279219,0.313437,0.417191,0.449388,0.531881,0.447825,0.49705,0.386271,0.0391255,-0.150189,-0.0862123,-0.166212,-0.176637,-0.1419},{-0.0638576,-0.344382,-0.16171,0.0453078,-0.00789892,0.128362,0.258926,0.242748,0.369334,0.283582,-0.0904734,-0.50566,-0.137623,-0.505362,-0.913931,-0.567012,-0.0580215,-0.0642194,-0.235852,-0.241245,-0.00657282,0.0774593,0.0781215,0.213878,0.114342,0.235571},{0.252092,0.0152734,-0.0241393,0.598382,0.801523,0.0310101,-0.121474,-0.223586,-0.211136,-0.00579671,-0.0489451,-0.226072,-0.264176,0.0910335,0.0850453,0.071924,-0.0578551,-0.145616,-0.137437,-0.00739925,0.0302009,-0.357234,-0.366839,0.0323953,0.713729,1.23229},{-0.237561,0.0454478,-0.0567888,0.00642675,-0.017282,-0.132713,-0.0596802,-0.0921197,0.111978,0.301044,0.347136,0.38507,-0.142678,-0.243019,0.315421,0.359608,0.166012,0.2346,0.310133,0.121033,-0.0222047,0.244754,0.0822056,0.264343,0.0955181,0.0234382},{-0.825707,-0.626227,-0.14092,0.0965448,0.277038,0.309979,0.229323,0.388896,0.423342,0.348288,0.572331,0.71713,0.605235,0.733162,0.61991,0.517494,0.375169,0.70022,0.853992,0.485134,0.338997,-0.179274,-0.354523,-0.301453,-0.333812,-0.157335},{-1.75643,0.325061,0.878338,1.81869,2.89977,1.14408,-0.483823,1.38551,1.54523,1.47859,1.74836,2.6044,2.54537,2.3437,1.96691,1.8439,1.96871,2.02942,2.09122,1.39283,0.717341,1.20414,1.32548,0.584397,1.73688,0.494875},{0.277516,-0.242618,-0.221765,0.0953955,0.108395,0.315013,-0.105278,-0.209836,-0.00456564,-0.0216699,-0.637348,-0.585734,-0.00866568,0.621558,0.784044,0.641721,0.143101,-0.375183,-0.80906,-0.622142,-0.0403173,0.232399,0.114052,0.0279567,0.287423,0.200467},{-0.399312,0.109582,0.0399752,-0.430582,-0.14832,0.124253,0.235506,0.248837,0.418899,0.250611,-0.294824,-0.539191,-0.551064,-0.374503,-0.262404,-0.185347,-0.390987,-0.418404,-0.366033,-0.101047,0.0623535,-0.165377,-0.507885,-0.707182,-0.300085,-0.117595},{0.0314842,0.0719988,0.0643665,0.0205489,-0.0295927,-0.15984,-0.0164149,0.0864069,-0.146415,-0.118242,0.274583,0.470668,0.7109,0.624958,0.35322,0.427257,0.61225,0.500101,0.440612,0.478829,0.101046,-0.322424,-0.157078,0.0126107,-0.0386611,-0.0024651},{-0.0276994,-0.147386,-0.0780163,-0.270888,-0.0550161,0.101812,-0.0324256,-0.0117738,0.11156,0.0978846,-0.00895042,-0.097151,-0.272273,-0.248763,-0.107714,0.0845124,0.176492,0.0603024,0.0838179,-0.00781957,0.283165,0.297394,0.158758,0.0288864,0.018639,-0.128197},{-0.495189,-0.0566036,0.163004,0.210563,0.0573888,0.278802,0.385335,0.393103,0.338892,0.29155,0.25541,0.49147,0.328119,0.331614,0.285364,0.28074,0.690084,0.872787,0.989182,1.0381,0.686657,-0.441381,-0.729099,-0.261177,0.173669,0.0365957},{0.329356,0.25236,0.051762,0.163528,-0.0475711,-0.21009,0.0932032,0.0121237,0.442149,0.90459,0.359671,-0.376252,-0.675482,-0.423532,0.0599957,0.17907,-0.234174,-0.55757,-0.41142,0.0372167,-0.096822,-0.109655,0.0529776,0.20622,0.195698,-0.0974562},{-0.0742908,0.102987,0.0536246,0.0254154,-0.0397286,0.38696,0.311909,0.612813,0.631148,-0.231723,-0.704765,-0.523002,-0.926092,-0.364294,0.611872,1.06264,1.04182,-0.366656,-1.13625,-0.614173,-0.412081,-0.129931,-0.0861586,-0.133828,0.0825257,0.0394788},{1.30591,-0.218165,-0.373788,-0.778718,-1.27843,-0.712368,0.122226,-0.358535,-0.692725,-0.867956,-1.08672,-1.18277,-1.06443,-0.951964,-0.846108,-1.11921,-1.23891,-1.08024,-0.908714,-0.727729,-0.565717,-0.458385,-0.410785,-0.305168,-0.652226,-0.278421},{-0.0730994,-0.176707,0.382091,0.0705445,0.116638,0.973402,1.42868,1.43738,1.1288,0.95123,0.834856,0.254217,0.400415,0.523104,0.237168,-0.0815152,-0.559643,0.0799474,0.427882,0.0948335,0.0838438,-0.184387,-0.0927401,0.119827,-0.0741885,0.209543},{-0.321128,-0.0124518,0.0643847,-0.0324404,0.0609381,-0.074171,-0.232346,-0.255899,-0.226984,-0.236676,-0.12611,-0.181146,-0.116715,0.201704,0.423511,0.279669,0.0637486,-0.330649,-0.431022,-0.151505,-0.108433,-0.0235953,-0.00257327,0.0272861,0.00815064,-0.0127216},{0.046317,-0.0468483,0.217442,0.0384549,-0.128322,-0.176836,-0.0784039,-0.0416939,0.334328,0.282884,-0.263652,-0.504064,-0.47244,-0.670198,-0.946304,-0.676579,-0.189532,-0.635882,-0.769799,-0.674351,-0.336182,-0.331065,-0.178574,-0.367477,-0.295031,-0.0495633},{-0.633254,0.0892562,0.115688,0.184392,-0.136157,-0.129442,-0.0768893,-0.103069,0.0747565,0.0100799,-0.223709,-0.176057,-0.0368346,0.114449,0.0865215,0.122186,0.114029,-0.127662,-0.140294,-0.0696051,-0.243893,-0.328626,-0.107544,-0.18562,-0.14184,0.0875153},{-0.40322,0.150667,0.502659,0.657137,1.14701,1.79719,3.10901,0.992772,0.485141,1.18464,1.40688,1.52035,1.59939,1.29242,0.967206,0.896146,1.02582,1.00674,0.523602,0.426918,0.615689,0.323988,0.252931,0.739665,0.16172,-0.852435},{-0.419093,0.0918661,-0.0376281,-0.0856476,0.0313331,0.0375576,-0.0762315,0.0646989,0.129833,-0.178134,-0.258137,-0.109385,-0.152094,0.236296,0.459198,0.593481,0.493538,0.394784,0.229175,-0.047921,-0.0994143,-0.224359,-0.104786,0.0122062,0.00206244,-0.0362228},{-0.0796488,0.246972,-0.1513,0.0866751,0.292403,0.237236,0.520715,0.609576,0.305464,0.0198235,0.340197,0.62007,0.282873,-0.115105,-0.221029,-0.423566,-0.224968,0.296833,0.576224,0.634349,0.485331,0.396535,0.412516,0.222454,-0.155164,-0.106947},{0.226564,-0.00811983,0.0552153,0.146195,-0.0194698,0.0805617,0.16853,0.00958936,-0.0711519,-0.235573,-0.24149,-0.206862,-0.179181,-0.00492761,0.0443653,-0.108083,0.0435552,7.88716e-05,0.0566518,0.104498,0.0834287,0.039614,-0.0877541,-0.0864807,-0.0981232,-0.0417436},{-0.471234,0.00705026,-0.090255,-0.0528099,-0.00575467,0.245884,0.284493,0.101406,-0.0521186,-0.0547545,-0.115779,-0.134723,-0.343097,-0.386363,0.0269741,0.198441,0.382502,-0.0808822,-0.0951464,0.0162688,0.222333,0.273359,0.376447,0.422987,-0.045791,-0.0391785},{0.668626,-0.0193864,0.124462,0.00415253,0.101625,0.112545,0.16091,0.0312052,-0.199524,0.313677,0.81512,0.80055,1.00915,0.759395,1.04992,0.762232,-0.556994,-1.30195,-1.07256,-0.963105,-0.573546,-0.101673,0.117687,-0.0221946,0.0352934,-0.129951},{-0.081383,0.298282,0.461886,1.06347,1.63853,2.19387,3.48257,1.21418,1.15392,1.04035,1.00207,1.20993,1.60908,1.51281,1.41392,1.29343,1.13301,1.17933,1.50376,1.47827,1.23747,0.241797,0.291469,1.19407,-0.813732,-2.03345},{0.470495,0.217888,0.0986469,-0.0103238,0.0952268,0.000952616,-0.0578156,0.248023,0.491982,0.126378,-0.101126,-0.0548579,0.197612,0.4065,0.225019,-0.200717,-0.467427,-0.173329,0.100824,-0.148173,-0.536048,-0.887148,-0.555596,0.270076,0.388249,0.0331694},{-0.29193,0.288318,0.507734,0.864266,1.29464,1.03211,0.938811,0.554344,0.5285,0.866461,0.809251,0.804669,0.958122,1.16163,1.06355,0.980514,1.14493,1.24381,1.3205,0.999771,0.775062,0.470758,0.638674,0.820556,0.313468,-0.265507},{0.125411,-0.0241562,0.0979131,-0.0466336,-0.169016,-0.140036,-0.0249528,-0.142615,-0.214399,0.00198771,-0.339731,-0.49344,-0.567945,-0.0715168,0.110314,-0.0456972,-0.296952,-0.246255,-0.448111,-0.529568,-0.479579,-0.274811,-0.104744,-0.0303259,0.262425,0.0511023},{0.575711,-0.248641,-0.0786892,-0.0721152,-0.427946,-0.544722,-0.237109,-0.100103,-0.153241,-0.188298,-0.502535,-0.715979,-0.756082,-0.621143,-0.385837,-0.160843,-0.446893,-0.513859,0.280175,0.367677,0.147659,-0.14189,-0.0277187,-0.10838,-0.24808,-0.0582798},{-0.16996,0.100637,0.169953,0.335894,0.304699,0.145019,0.146667,0.0551059,-0.0478314,0.147874,0.499941,0.578789,0.576568,0.395562,0.423468,0.459009,0.625267,0.550881,0.320959,0.158317,-0.0923647,0.142058,0.410139,0.436919,0.120706,-0.0284188},{-0.0102876,-0.084764,-0.0525204,-0.212736,0.0934913,0.146092,0.267282,0.248268,-0.0242571,-0.157926,0.0824685,0.268989,0.0545326,0.304717,0.692163,0.529978,0.00744836,0.0370474,0.280827,0.187868,-0.190905,0.0584518,0.263727,0.156316,-0.218684,-0.0875954},{-0.0109561,0.254655,0.148738,0.131831,0.156288,0.206498,0.14993,0.125364,0.328291,0.43068,-0.00114057,-0.283971,-0.103509,0.323785,0.511391,0.1974,-0.082694,-8.98273e-05,0.120237,-0.0150182,-0.0973752,0.00203194,0.0612121,0.0533759,0.0646935,-0.0937813},{0.168703,-0.138719,-0.110649,-0.180482,-0.309136,0.411221,0.686353,0.490167,0.370801,-0.26892,-0.760255,-0.687044,-0.0739223,0.191855,0.139141,-0.188586,-0.632773,-0.724116,-0.471131,-0.0410448,-0.103506,-0.16754,-0.120074,0.0613969,-0.0997685,-0.0249777},{-1.14466,0.240193,0.685336,1.58934,2.17137,2.46309,2.9721,1.21225,0.736507,1.37028,1.62696,1.69352,1.65678,1.39675,0.99977,1.0865,1.68475,2.09422,2.04591,1.69897,1.25229,0.129601,0.25769,1.22055,1.05639,-0.613905},{-0.155253,0.0174866,-0.0281046,0.0369964,-0.0687476,-0.26356,-0.469377,-0.650122,-0.365813,0.474627,0.911581,1.34147,1.5113,0.17195,-0.723018,-0.49833,-0.178341,-0.506123,-0.388366,-0.232064,0.00699344,0.168351,0.127483,0.184921,0.0967025,-0.0393826},{1.0521,-0.25773,-0.676674,-1.10186,-1.89123,-1.45674,-1.02897,-0.750513,-0.860168,-0.885094,-1.03588,-1.29701,-1.13534,-1.12872,-1.12744,-0.893004,-0.419084,-0.288266,-0.632056,-0.980127,-0.788634,-0.843152,-1.02496,-1.38386,-1.04284,0.270246},{0.232919,-0.0108198,0.0344586,-0.0515419,-0.112418,-0.0438922,-0.00182035,-0.0709244,-0.0101844,0.572276,1.25664,1.06594,1.04914,0.617571,0.242401,-0.0438814,-0.170343,-0.177843,-0.149127,-0.0706494,0.0941314,0.00919862,-0.158319,0.0611845,-0.138891,-0.134125}};
+
+// backward network input weights
+static DTYPE_WEIGHTS_WGI_bw WGI_bw_in[NUMBER_OF_NEURONS][NUMBER_OF_INPUTS_NONRECURRENT] = {{0.219455,-0.0738073,-0.0518353,0.00936297,0.107171,0.242979,-0.00263946,0.231455,0.265028,0.0452221,-0.210062,-0.213753,-0.361452,-0.208594,-0.256519,-0.295004,-0.145568,0.000942726,0.0885675,0.006423,0.151165,0.0553456,-0.135319,-0.0596358,-0.143365,0.0698076},{0.137402,0.0602693,0.00243199,0.0945816,-0.139214,-0.16244,-0.0571181,-0.14686,-0.00499688,0.126229,0.229743,0.244604,0.221573,0.194461,0.233279,0.237126,0.355656,0.298428,0.162984,0.0115214,0.108376,-0.061198,-0.136443,-0.17204,-0.0608571,0.0661565},{0.117356,-0.0254621,0.0817392,-0.0557071,0.082496,0.0214098,0.0471182,-0.138217,-0.111822,-0.0287204,0.0038044,-0.0249678,-0.147947,0.0993311,0.16744,0.234023,0.145435,0.148213,0.113022,0.166321,0.0934476,0.0293177,-0.0327521,0.083785,-0.106314,0.021032},{0.117564,0.0270805,-0.084412,0.0478286,-0.0818327,-0.0486459,-0.0178706,0.0583243,-0.0914955,0.149109,0.0679939,0.0217067,-0.0475203,-0.0261778,0.105919,-0.00933169,-0.190331,-0.146412,-0.243885,-0.317365,-0.179558,-0.0500173,-0.00650505,-0.161416,-0.088712,0.00617649},{0.0577262,-0.0642277,-0.0393708,-0.0639114,-0.0306339,0.0950483,0.107569,0.159883,0.0687388,0.0476137,0.0255874,0.089215,0.188669,0.318296,0.0379764,0.0436108,0.197631,0.110379,0.00516388,-0.0402845,0.0658242,0.100679,-0.11299,-0.0544018,-0.0282869,-0.153396},{0.258286,-0.0281029,0.0234646,-0.0643735,-0.042997,-0.18635,-0.127131,-0.0735674,0.0426851,0.224607,0.279412,0.0608835,-0.168026,-0.0512098,-0.114504,-0.161978,-0.193048,0.0418267,0.145846,0.303537,0.0280412,0.117795,0.0314266,-0.0877043,-0.0284221,-0.0219079},{0.228166,-0.052546,0.0042231,0.0270349,-0.0662394,0.00529235,0.0459723,0.0997171,0.272605,0.171909,0.238416,0.0549301,0.0687733,-0.060797,0.141448,0.0121404,0.116227,-0.0457831,0.0018779,0.166996,0.191522,0.122567,0.0447702,-0.0478824,-0.087797,-0.0358426},{0.0653312,0.00876008,0.010913,-0.0735624,-0.0161668,0.124849,0.0424592,-0.00520725,-0.120068,-0.00523636,0.0429771,0.0160648,-0.0468725,-0.198034,-0.115092,-0.099956,-0.0829053,-0.103854,-0.0304095,0.00864502,-0.0762172,-0.230961,-0.114598,-0.0461867,-0.0347847,0.061801},{0.0944348,-0.0888183,0.0405192,-0.0843918,-0.0661766,0.0186452,0.0961961,0.0567129,0.105284,-0.0814208,-0.0871945,-0.0589332,0.012492,0.0123828,-0.0965614,-0.100162,-0.0565475,-0.0227965,0.0756943,0.040152,0.0646775,-0.0597647,0.0700784,-0.00460724,0.00968488,0.0617432},{0.240727,-0.0168885,0.0288787,-0.0563067,-0.0196271,0.0112765,-0.00542654,0.155792,0.175884,0.236983,0.117239,0.174232,0.158252,0.0135312,0.0856715,0.173469,-0.0329602,0.0290983,-0.001461,-0.0173475,0.105309,0.0988243,0.0734909,0.047177,-0.0362866,-0.0653184},{0.131797,0.0466217,0.0123093,-0.0252323,-0.0350194,-0.0275415,0.143687,0.287246,0.489959,0.26543,-0.189337,0.00502063,-0.047077,-0.586532,-0.753479,-0.667568,-0.526918,-0.383321,-0.0828496,0.0660828,0.155217,0.111807,0.0311294,0.0748632,0.0343519,0.0787778},{0.302168,-0.0395216,0.013664,-0.0339359,-0.0863356,-0.0604177,0.151501,0.141914,0.0816761,0.0585603,0.0325067,0.193031,0.222545,0.312026,0.309647,0.278877,0.186555,0.0363087,0.0476024,-0.00434202,-0.0909286,-0.191153,-0.191537,-0.269206,-0.0682623,0.00565922},{0.169025,0.0594874,0.0525498,-0.0698053,-0.164596,-0.125033,-0.0339092,0.109604,0.332123,0.170407,0.075342,-0.0167645,0.00769684,0.0711318,0.0373277,0.0302005,0.038881,0.0261395,0.0547713,0.210827,0.223979,-0.0101462,-0.0741373,0.0421837,0.0630161,0.0692743},{0.0972343,0.00883832,-0.024139,0.0714963,-0.00377639,0.0485255,0.0814482,-0.0528673,-0.145676,-0.0242459,0.134712,0.181977,0.156545,0.156288,0.323131,-0.0412705,-0.165059,-0.029851,-0.136482,-0.143882,-0.0047777,0.277744,0.0310616,-0.0553649,-0.139531,-0.00390902},{0.0745306,0.0260786,0.00350666,-0.0380153,-0.027753,0.051443,-0.0858068,-0.0741509,0.047286,0.013444,-0.102397,0.0609557,0.0256766,0.0661824,0.0504257,-0.0270962,-0.0977067,-0.0547783,-0.026881,0.131139,0.290962,0.209559,0.234246,0.0118643,-0.0423338,-0.0696144},{0.499018,-0.0235209,-0.084855,0.0249994,-0.137504,0.0722465,0.265197,0.351254,0.0803934,-0.299857,-0.2514,-0.226849,0.0574284,-0.0167929,-0.228064,-0.39421,-0.42266,-0.171985,-0.168058,-0.206055,-0.261114,0.045159,0.120659,0.0179686,0.092965,-0.0109463},{0.234876,-0.00617429,0.0359958,-0.00262683,0.0371568,0.034363,-0.00920845,0.143261,-0.0311436,-0.072161,-0.0552318,-0.206085,-0.0558322,-0.0275767,-0.157392,-0.164684,-0.206652,-0.0792595,0.0113264,0.017383,-0.0055301,-0.283085,-0.221911,-0.307949,-0.12953,-0.0627937},{0.151192,0.0621117,-0.0501433,-0.0405402,-0.144663,-0.0752618,0.00680741,-0.0290989,-0.00791813,0.155539,0.158184,0.103631,0.0813353,0.00354854,0.233215,0.340963,0.334187,0.202837,0.145728,0.186966,0.054705,0.025496,0.11044,0.140753,0.114844,-0.00742005},{0.133502,-0.0590184,-0.0531239,-0.102086,-0.154047,-0.0742992,0.00518129,0.0190343,0.0920272,0.111782,0.0643748,0.117355,0.0747579,0.095549,0.151796,0.296344,0.256894,0.115735,0.123259,0.0209065,0.000992638,0.0702558,-0.0237838,-0.0721046,-0.0363545,-0.00362219},{0.091229,0.0419308,0.0471456,-0.0683339,-0.0810005,-0.00958097,-0.0371966,-0.0419543,0.0707826,-0.0670276,-0.0265548,-0.142574,0.00410636,-0.0792581,-0.00950204,-0.121768,-0.0552931,-0.0986347,-0.0966831,-0.00688218,-0.0227148,-0.118216,-0.0333838,-0.112244,-0.0751889,-0.0840794},{0.270831,0.0435145,-0.0181899,0.00379221,0.0809012,0.06179,0.0815809,-0.0195646,-0.0368112,-0.0119047,0.0972587,-0.091637,-0.212052,-0.0721071,0.0128222,0.0387825,0.0773805,0.0535958,-0.0183478,0.0842716,0.034576,0.186447,0.0291448,0.110364,-0.021016,0.0426892},{0.0753261,0.0417589,-0.0579899,0.00196686,0.023508,-0.00836445,-0.029607,0.0328697,-0.0281115,0.07129,-0.0931177,0.055751,0.018773,-0.0632286,-0.0525601,-0.0965003,-0.087673,-0.0482238,0.0821348,0.0695347,0.0218686,0.0232735,-0.11546,-0.166213,-0.011785,-0.0801827},{0.192276,-0.0743551,-0.0867041,0.0532236,-0.0229567,-0.0470708,0.0405312,-0.0803352,-0.210356,-0.486654,-0.313455,-0.134836,0.11316,0.347852,0.391554,0.340504,0.15989,0.0416409,0.136107,-0.0750905,-0.109951,-0.0364391,0.0555107,0.09655,-0.116687,-0.0446561},{0.0800007,-0.0139472,-0.0585308,0.0570496,0.169624,0.0271564,-0.247395,-0.294678,-0.0503369,-0.078523,-0.0467525,0.0789156,0.212347,0.396581,0.335574,0.354133,0.267769,0.115445,0.0120787,0.105467,0.158674,0.0674777,-0.0529819,-0.0982806,-0.00687155,0.0675041},{0.017767,0.061432,-0.0554875,0.0620643,0.0685871,0.346398,0.208372,0.343325,0.174602,-0.00387468,-0.0713017,0.0695491,-0.0609717,0.0509549,-0.0278646,-0.0113063,-0.158431,0.0720365,0.278376,0.363378,0.297453,0.158128,-0.117963,-0.00731761,-0.0440989,-0.0171146},{-0.034532,-0.00337628,0.00179441,-0.0448525,-0.101667,-0.128386,-0.0334711,0.116423,0.000564383,-0.0705469,-0.171299,-0.201905,-0.320416,-0.153627,-0.0160201,-0.0412588,-0.10735,-0.130179,-0.0698541,-0.0525695,-0.0978051,0.0714952,0.141167,0.0293679,0.00880931,-0.048915},{0.133422,0.0516531,-0.00917933,-0.0796113,-0.0949212,0.154121,0.272332,0.217878,-0.0704083,0.0440094,0.246389,0.36908,0.332132,0.17478,0.0454502,0.157123,0.0296412,0.342635,0.490406,0.641131,0.31462,0.0467618,0.137799,0.118832,-0.000416772,-0.14433},{0.0323301,-0.0971536,0.0892993,0.018459,0.15036,0.169411,0.20554,0.129174,0.068999,-0.15228,-0.0963457,0.207282,0.109529,0.0422599,-0.0182435,0.0365014,0.158995,0.185188,0.0383783,-0.312066,-0.412889,-0.1664,-0.0413095,0.0536828,0.0366516,0.069193},{0.199234,0.0591097,0.0485578,-0.0424047,-0.0473781,-0.048965,0.0608483,0.1085,0.198941,0.305526,0.270077,0.224205,0.209466,0.106262,0.169091,0.0747859,0.14722,0.241264,0.220943,0.0322022,-0.0320834,-0.194084,-0.0229184,0.033925,0.0612246,-0.0716807},{0.181845,0.0266405,-0.0681645,-0.0650977,-0.0735469,-0.0556098,-0.100396,-0.0699081,-0.0319141,0.0101799,0.0348099,0.0407586,0.0742614,0.0400725,0.129717,0.104742,0.158057,0.0268126,0.0506332,-0.0569648,-0.0271348,-0.00606386,-0.101699,-0.11595,-0.125843,-0.0537774},{-0.00382462,0.0785784,-0.032332,-0.0513581,-0.0795391,-0.00649017,0.133069,0.248126,0.179172,0.450642,0.377845,0.268499,0.20004,0.203493,0.261877,0.292446,0.362737,0.197607,0.122903,0.0211779,-0.134632,-0.0156346,0.0480463,-0.0285363,-0.119336,0.0142393},{0.435976,-0.021078,0.0717261,-0.0942723,-0.0747744,0.00991065,-0.0240702,-0.00406597,-0.0923128,-0.0205993,-0.11204,-0.116177,-0.0847318,-0.0860147,-0.217654,-0.13001,-0.0259001,0.0400368,0.0160555,-0.0305438,-0.0615279,0.037249,-0.0598021,-0.00464536,-0.0338497,-0.179165},{0.256513,-0.0309289,0.0706412,-0.0933143,-0.115361,0.142905,0.207425,0.247204,0.157941,0.00542045,0.0989985,0.277212,0.105809,0.11951,0.234627,0.159138,0.0974203,0.209638,0.330864,0.338965,0.209631,-0.0335729,-0.0685139,-0.0547373,-0.176105,-0.0798417},{0.167565,-0.00469599,0.00846303,0.100213,0.0216139,-0.0176981,-0.0048355,0.0428011,0.141899,0.125279,-0.0634282,-0.00962807,0.0805729,0.212058,0.0296892,0.133559,0.0634914,-0.0734304,-0.00955742,0.0473819,-0.0824635,0.0575845,0.0656005,-0.0703511,-0.0481662,-0.00886572},{0.00393407,-0.00836409,-0.00529573,-0.032711,-0.119878,-0.124239,-0.0475919,-0.060467,-0.0506646,0.192193,0.227357,0.114343,0.155241,0.12924,0.150178,0.119817,0.112719,0.117503,0.0946463,0.0615352,0.0536246,0.212987,-0.0161245,-0.0146215,-0.133242,0.0179113},{0.180572,-0.00225069,0.0363262,0.0290902,-0.0797757,0.00625732,-0.0526171,-0.0743643,-0.135997,-0.257739,-0.202796,-0.030565,0.0505988,-0.206279,-0.14005,-0.183077,-0.194958,-0.355293,-0.159503,-0.0722156,-0.182178,-0.256992,-0.0378365,-0.0248032,0.0770301,-0.0983673},{-0.0418244,0.0701434,0.00437848,-0.015828,0.0851069,0.0380483,-0.147008,-0.0971047,0.182724,0.377113,0.348632,0.123028,0.116235,0.146456,-0.194299,-0.22978,-0.294089,0.0487043,0.0737168,-0.176211,-0.0909515,-0.160083,-0.00481618,-0.121263,-0.124796,0.0561195},{0.259523,-0.0202863,-0.0374837,0.0590846,-0.00424883,0.129062,0.202881,0.407066,0.0961297,0.122865,-0.0103979,-0.000261305,-0.320948,-0.412184,-0.268324,-0.169428,-0.18108,-0.0849165,0.086077,0.0137044,-0.149956,-0.0509636,-0.185908,-0.182611,-0.0663289,0.00890119},{0.525196,-0.0329576,-0.0689375,-0.0259199,-0.0282915,-0.0613487,-0.00519445,0.120836,0.0224275,0.106443,0.252706,0.224173,0.32275,0.250038,0.170283,0.0651352,0.0836517,0.244707,0.191476,0.285127,-0.00695543,-0.159531,-0.0818696,0.0141975,-0.0744159,-0.159982},{0.184457,0.0153554,0.0536397,-0.0442694,0.0149788,0.197926,0.0934537,0.225545,-0.154185,-0.388869,-0.273408,-0.210769,-0.087513,-0.233179,-0.0674779,-0.16307,0.0671819,-0.0242241,0.00106052,0.133235,-0.00529648,0.0953443,0.118528,0.115914,0.00619902,-0.125296},{0.0587409,0.0722066,-0.0619295,-0.160621,0.0689532,0.0442697,-0.0481124,-0.117227,-0.251692,-0.0712501,0.19731,0.248976,0.271385,0.345399,0.243999,0.152948,-0.149785,-0.196039,-0.00731804,0.100557,-0.0488435,0.0355552,-0.0621754,0.0805556,-0.0590969,0.128892},{0.0149225,-0.0364226,-0.0247804,-0.0260853,-0.0252527,-0.119769,0.0237949,-0.0218541,0.204062,0.0219655,-0.180631,-0.148297,-0.0723744,0.079453,0.154646,-0.0638162,0.157999,0.370481,0.354361,0.107729,-0.113199,-0.161165,-0.229496,-0.220185,-0.248578,0.15051},{0.15153,0.0200085,-0.0724571,-0.0808033,0.0237027,-0.0516487,-0.0997591,-0.0882809,0.105483,-0.0399998,-0.154946,-0.0710047,-0.194479,-0.185192,-0.0564336,-0.126374,-0.139473,-0.243341,-0.223219,-0.103359,0.0398725,0.0714873,0.126198,0.0623946,0.0636237,-0.0376537},{0.0463948,0.0536944,-0.00295885,0.0285162,-0.0779025,-0.264558,-0.283638,-0.217171,-0.0148984,-0.0713487,0.0107906,0.142745,0.288565,0.238339,0.0800868,0.0234455,-0.00871804,-0.186773,-0.10301,-0.0462214,0.0698806,-0.0510384,-0.00876338,0.0448442,-0.0898307,0.0462613},{0.151146,-0.0523236,0.0301553,-0.0463459,0.0413508,0.202763,0.0837056,0.066728,0.101226,0.0228526,0.163631,-0.00542896,-0.112905,-0.252663,-0.000965012,0.0325802,-0.128852,-0.021443,0.0670769,0.266979,0.239512,0.110486,0.233863,0.0401985,-0.0101231,-0.0464094},{0.105931,0.00138761,0.0030173,-0.046525,-0.16181,-0.045291,-0.0291942,0.0456392,-0.117853,0.0366247,-0.0918371,0.0202648,0.0958212,0.106645,0.04071,0.0336781,-0.128728,0.00989193,-0.0987408,-0.0127033,0.110035,0.228358,0.194554,0.0986274,-0.0672204,-0.0126459},{0.338982,0.00591778,0.0274907,-0.0616481,-0.278702,-0.349601,-0.266014,-0.217556,-0.119599,-0.0446428,0.0368288,0.217605,0.144108,0.339021,0.331134,0.4478,0.270373,0.183864,0.211144,0.282179,0.297374,0.120775,-0.107472,-0.113796,-0.0957823,0.0699266},{0.316444,-0.0154519,0.0485257,0.0526384,0.172732,0.0685219,0.125621,-0.167006,-0.415494,-0.418934,-0.372585,-0.249562,-0.0591967,-0.277717,-0.169194,-0.0577873,-0.137401,-0.35359,-0.421056,-0.237562,-0.12605,-0.213344,-0.114089,-0.118374,0.154236,-0.0612197},{0.0912214,-0.0309881,0.02758,-0.0152059,-0.166567,-0.113714,-0.031924,-0.0137171,-0.218251,-0.208253,-0.0822347,-0.0831952,-0.0439588,0.00489714,0.0305034,0.0158527,0.101428,0.0321218,-0.116024,0.0947494,0.100588,0.0935167,0.0751843,0.0920632,-0.0183619,-0.0133089},{0.0951265,0.0658835,-0.0446874,-0.0718153,-0.0493379,-0.171092,-0.0620096,-0.0644066,0.0344544,0.197873,0.308156,0.237502,0.0344535,0.0397976,0.051252,-0.122504,0.0100741,-0.028209,-0.00981306,-0.181426,-0.121119,0.0868993,0.250772,0.174244,0.078624,-0.0952444},{0.225597,-0.00681459,-0.00409235,-0.00822159,-0.0244122,-0.0489596,-0.197528,-0.0430226,-0.0324292,0.114401,0.135767,0.179195,0.266862,0.32644,0.17079,0.0436935,0.0419488,0.0204356,-0.0175087,-0.0906285,0.146967,-0.00155226,0.0363041,-0.0583465,-0.153996,-0.0611317},{0.0193773,-0.0272932,-0.024941,0.0433407,-0.0529731,-0.181066,0.0205006,0.00487941,0.0845726,0.064995,0.11194,-0.00694357,-0.0888502,-0.226734,-0.124813,-0.168818,-0.0426225,0.128568,0.276687,0.031539,-0.111463,-0.0522397,-0.0902579,-0.128633,-0.0125837,-0.000885561},{0.313663,0.0296682,0.0180462,-0.0501046,-0.104814,0.031705,0.0608431,-0.0506049,0.052965,-0.0521656,0.0321247,-0.0490605,0.0345039,-0.0356539,0.0171163,-0.0866728,-0.112383,0.0306587,0.0234397,0.0743333,-0.121466,0.0880671,-0.0646001,0.0739799,-0.134075,-0.0982532},{0.141307,0.023911,0.10674,0.0557756,-0.0690782,-0.0934204,-0.147724,-0.199077,-0.111476,-0.0973987,-0.185557,-0.236839,-0.228684,0.0362692,0.033287,0.0466629,-0.0523013,-0.0905795,-0.366684,-0.386749,-0.064368,0.10269,0.0885181,-0.0568936,-0.107193,0.0623413},{0.115077,-0.0227198,-0.0229232,-0.0291653,0.0399171,0.0561874,0.12373,-0.0774998,-0.176461,0.108613,0.183436,0.205471,0.150213,-0.0736499,-0.00747042,0.105733,0.129602,0.176989,0.233063,0.0611912,0.021945,-0.0765266,-0.0611679,0.0708612,0.0865972,-0.0377835},{0.0872057,0.0710432,0.0245248,-0.0297133,0.00652547,0.0325623,-0.0195905,0.0592554,-0.0215391,0.0882738,-0.0338814,-0.0706321,0.0216993,0.041309,-0.0577639,-0.0198659,0.0660868,0.12,-0.110146,-0.210215,-0.140517,-0.0123623,-0.0610139,0.0705007,0.0166627,-0.132216},{0.283346,-0.0136876,-0.01872,-0.0482318,0.0203428,0.0749302,0.0453741,0.0220305,-0.169732,0.0559652,0.160913,0.234803,-0.228371,-0.786607,-0.567927,-0.257268,-0.182212,-0.0205546,0.124652,-0.173337,-0.16281,-0.0951684,0.0251749,0.0253975,0.045473,0.00116626},{0.172699,-0.00378737,0.0485378,-0.0620809,-0.165575,0.0289608,0.00391225,0.0310208,0.120539,0.318471,0.381232,0.31167,0.161871,0.0119902,0.0582424,-0.00584071,-0.016497,0.0473021,0.155571,0.145183,0.0670916,0.0873652,0.0156649,-0.0282688,-0.0326384,0.00417078},{0.0113514,0.056831,-0.0305178,-0.0607223,0.0759182,0.099758,0.0109023,0.0848706,-0.0671991,0.0638687,0.1132,-0.0155371,0.108681,0.0442107,-0.0944866,-0.100966,-0.0090204,0.0229359,-0.000238904,0.04764,0.0329677,0.0399927,0.189829,0.0847159,-0.0185139,0.102515},{-0.0673274,0.0160885,0.0573432,-0.0255936,-0.118867,-0.0814979,0.0300368,0.0957079,0.197616,0.149818,0.0853977,-0.00427185,0.0175698,0.295879,0.351746,0.329441,0.0972198,0.127576,0.294633,0.083319,-0.104856,-0.190263,-0.124774,-0.274785,-0.220264,-0.0375615},{0.177451,0.0654107,-0.0329771,0.058237,0.0740775,0.0471577,0.0452083,0.0967113,0.111661,0.132193,0.0568898,0.116429,0.268247,0.133245,0.0312208,0.0695816,0.177973,0.214033,0.0637608,0.0165353,0.0247409,-6.60801e-05,-0.0560261,-0.16044,-0.146282,0.0739537},{0.19784,-0.0499864,0.0329976,0.0299378,-0.0144357,0.0521501,0.207598,0.298904,0.0851587,-0.0336431,-0.427783,-0.470137,-0.342908,-0.0715838,0.0437334,0.2166,0.0346702,-0.215206,-0.0755547,-0.00182747,-0.00326311,-0.111571,-0.243367,-0.27292,-0.176236,-0.0499033},{0.253398,-0.0116924,-0.0251516,0.0221243,-0.26642,-0.385869,-0.260986,-0.394623,-0.11392,0.133079,0.182697,0.192172,0.0684792,0.175495,0.0516835,0.206243,0.0887462,0.177311,-0.00884644,-0.0992043,-0.167354,-0.0549196,-0.00572679,0.0458135,0.0307703,0.0823292},{0.436223,0.0163559,0.0170558,0.0211507,-0.011464,0.0350386,-0.0376696,-0.020904,0.0599223,-0.0764176,-0.156093,-0.296607,-0.139806,-0.0608833,-0.088525,0.0420039,-0.0611312,-0.239504,-0.255975,-0.235872,-0.118089,-0.0380358,0.108453,0.0187385,0.115556,-0.0713406},{0.299553,0.0301819,0.0157836,0.0293388,-0.0875675,-0.0271418,-0.12129,-0.10221,-0.0569119,-0.253814,-0.203651,-0.139275,-0.00384162,0.21214,0.217632,-0.0537758,-0.191457,-0.418227,-0.276895,-0.17825,-0.106491,-0.0302592,-0.0103078,-0.0427901,-0.0527896,-0.00283941},{0.142119,-0.100273,0.016424,-0.0335017,-0.115944,-0.0886052,-0.0622986,0.0203101,0.074386,-0.00200688,-0.00135084,-0.0422466,-0.0834992,-0.145402,-0.084543,-0.000406271,0.0456072,0.00292402,0.162815,0.0887011,-0.0503689,-0.129498,-0.032746,-0.0509058,0.0761515,-0.0443037},{0.0455793,0.0442633,0.0455346,-0.112761,0.0929189,-0.0631132,-0.137641,-0.0896615,0.00592108,-0.00827167,-0.0353124,0.0251248,-0.158439,-0.24728,-0.13899,0.00354257,-0.0780214,-0.299862,-0.326812,0.133024,0.239256,0.158648,0.0789946,-0.0987215,0.0513327,0.0350354},{0.202213,-0.0397653,-0.00694379,0.0324327,-0.0293019,0.045132,-0.00936308,-0.0176067,-0.0177127,-0.0410507,0.00597006,0.0601038,-0.0114387,-0.0726302,-0.0228285,-0.0311831,-0.0862561,0.000848969,-0.0473275,0.00617159,0.0325675,0.0669835,0.0283783,0.0922838,-0.0429301,-0.0436335},{0.289037,-0.0616871,-0.0411926,-0.0792019,0.0063883,0.1152,0.162086,0.112502,0.128012,0.219701,-0.151226,-0.103383,-0.00981681,0.183814,0.273452,0.0108175,-0.223894,-0.199754,-0.0620457,-0.177855,-0.242563,0.283666,0.437284,0.182757,-0.136368,-0.0912215},{0.191928,-0.0038341,0.0383628,0.0153539,-0.163355,-0.00907066,-0.0480276,0.0505784,0.140679,0.0386561,-0.0381878,0.014148,0.0135512,0.0160869,-0.0985018,-0.377688,-0.915375,-0.611471,-0.0949936,0.28803,0.429111,0.153758,-0.0213055,0.115179,0.00442945,-0.0906093},{0.185874,-0.00788291,0.0627579,0.0269779,-0.0924072,-0.0340659,0.0989943,0.215014,0.111801,0.0621747,0.426452,0.181189,0.0555713,0.0702648,-0.0246208,0.0251215,0.0767142,0.178812,0.059426,0.180998,0.118706,-0.0158478,-0.0742776,-0.0808291,-0.0443448,-0.0546568},{0.191228,-0.0725511,0.00810285,-0.128924,-0.0588752,-0.118582,0.0410143,0.0995188,0.095116,-0.120545,-0.136166,-0.092644,-0.045899,-0.0774852,-0.035154,-0.0622898,0.073419,-0.00797184,0.0689515,0.0195118,-0.0912751,-0.118064,0.0134342,0.0165954,-0.0603639,0.0695709},{0.139936,0.0239232,0.0698322,0.0580781,-0.0471078,-0.0400784,-0.0384805,0.159057,0.0761236,0.169139,-0.219782,-0.451221,-0.168042,-0.0266936,-0.0667942,-0.0234421,0.0603847,0.0301963,-0.234915,-0.189865,-0.011962,0.0584283,-0.0489289,-0.0891727,-0.0734679,-0.0178358},{0.0851375,0.0477932,0.0256679,0.0341844,-0.0646143,-0.0134989,-0.110989,0.0710957,0.0870162,-0.0103537,0.0965101,-0.0488902,-0.172954,-0.235441,-0.0552533,-0.0785823,-0.171987,-0.140853,-0.103027,-0.26486,-0.290376,-0.202451,0.040803,0.0892825,0.101619,-0.0185934},{0.154276,-0.0018007,0.0211831,-0.0477584,0.0146049,0.146966,0.104128,-0.0546102,0.0360718,-0.136453,-0.330984,-0.222177,0.0400128,0.145693,0.225164,0.180984,0.0460858,-0.122684,-0.378248,-0.435322,0.000237247,0.147282,0.211748,0.0333634,0.0268189,-0.0748889},{0.00259886,-0.0810621,0.103684,-0.0264648,-0.0898644,0.0235175,-0.0183039,0.0537446,-0.0140938,0.0838104,0.0360986,0.112993,0.186812,0.183217,0.265608,0.260261,0.202723,0.0727551,-0.0913711,0.0448239,-0.0188879,-0.0729256,0.084246,0.11083,-0.121507,-0.0553235},{-0.00356378,0.0376805,-0.0405432,0.0129155,-0.0127116,-0.0624178,-0.0677636,-0.0295629,0.140785,0.0676515,0.0943893,0.051918,-0.144795,-0.0655717,-0.144878,0.0983077,0.0542305,0.108189,0.302107,0.423077,0.368379,0.20317,0.166721,-0.0352243,-0.05825,-0.168582},{0.0621644,0.00221369,-0.0594788,-0.115413,0.0461433,-0.0957647,-0.233524,-0.247215,-0.562623,-0.365928,0.000924701,0.0847943,0.170203,0.3279,0.230515,0.092845,-0.147294,-0.131351,0.0223371,0.198198,0.0129605,-0.126329,0.0114084,0.0249798,-0.0410192,0.12407},{0.16225,0.0826816,-0.0460384,-0.0310139,0.0103082,0.126272,0.087384,0.0637331,-0.0601266,-0.0106925,0.152611,-0.0531506,-0.0713789,0.053711,-0.112338,-0.09289,0.00670978,0.00749847,0.0237144,0.0146919,0.096666,0.111399,-0.084251,-0.00464508,-0.083152,0.0526919},{0.102349,-0.0334437,0.0117568,-0.0560375,0.153491,0.59644,0.520114,0.0896904,-0.558684,-0.409435,-0.196602,-0.126547,0.135369,0.285936,0.185913,0.129908,0.125375,-0.0347229,-0.252663,-0.206177,-0.061858,-0.146983,-0.141355,-0.123124,0.11173,-0.0612315},{0.00099676,0.0361795,-0.0277283,0.00721038,-0.23429,-0.264108,-0.101689,0.0500868,0.144642,0.0151539,-0.133032,-0.0702133,-0.14413,0.00600662,-0.0744845,0.0171388,0.11505,0.22212,0.174547,0.116224,0.0495657,0.101412,0.0177253,0.0240844,-0.0377352,0.00871645},{0.309102,-0.0242591,-0.0108883,-0.0521885,-0.0684824,0.0578245,0.126279,0.0700487,-0.213378,-0.100541,0.0488369,0.136036,-0.0288284,-0.209538,-0.0907343,-0.185542,-0.23355,-0.145219,0.099466,0.230428,0.127518,0.0284981,-0.0817158,-0.10799,-0.0840216,0.111968},{0.342991,-0.0604632,0.0281531,-0.0501879,0.142524,0.125036,0.246974,0.0374293,0.0299546,0.0161713,0.109591,0.151257,0.198064,-0.0349859,-0.0529382,0.0446595,0.0713605,0.153031,0.176617,0.220694,-0.000631683,-0.0233098,-0.0281843,0.0636847,-0.0599061,-0.0486584},{0.0865436,-0.0247153,-0.0218165,-0.0593625,0.0239189,-0.0993825,-0.0775407,-0.0213225,-0.106324,-0.0690986,-0.195177,-0.0126089,-0.00247839,0.0148448,0.0964534,0.132487,0.0321193,0.089347,0.0314142,0.185711,0.20615,0.154289,0.103844,-0.0767193,-0.00810265,0.0480058},{0.116553,0.00239368,-0.0664058,-0.0777582,0.0999172,0.154535,0.180706,0.0748157,-0.0141358,-0.181296,-0.179381,-0.066998,-0.0866869,0.207006,0.300986,0.11852,0.0635091,-0.090467,-0.236874,-0.159558,-0.0483832,0.00199209,0.0282815,0.0158727,0.0551679,-0.0790651},{0.149473,-0.0647734,-0.0139198,-0.0748957,0.0748374,0.0697462,0.0975029,-0.0340922,0.120974,0.0329047,0.0621999,0.123593,-0.0620932,-0.12203,0.043807,-0.0184454,-0.02506,-0.0438894,-0.0380687,-0.23943,-0.0813019,-0.0394709,-0.110048,-0.132824,-0.101563,0.00511739},{0.0689358,-0.0458385,-0.0547521,-0.10124,-0.0125561,0.161601,0.199591,0.103839,-0.0875312,-0.356464,-0.26131,-0.176185,-0.190394,-0.0220753,0.213263,0.15558,0.281267,0.334755,0.234289,0.142061,-0.0197472,0.0595406,0.194555,0.129201,-0.0684685,-0.0624779},{0.191645,0.0782181,-0.00338991,-0.128923,0.000565002,-0.0168353,0.22957,0.175445,0.113144,0.205765,0.117337,-0.0512705,0.152856,0.202505,0.163713,-0.0446785,0.0435525,0.178696,0.207451,0.192919,0.204279,-0.052933,-0.0678728,-0.144927,-0.137651,-0.0217413},{0.238508,0.0515817,-0.0471657,-0.0462398,-0.237454,-0.258101,-0.387813,-0.182827,0.203643,0.416794,0.0140738,-0.0912519,-0.122811,-0.0525192,-0.0947817,-0.262675,-0.233616,-0.0731456,0.12687,0.0578743,0.0300053,-0.0897447,0.074069,0.182457,0.115485,0.021997},{0.0386045,0.0559786,-0.0249376,0.0372418,-0.0134933,-0.124207,-0.214554,-0.0158615,-0.068005,-0.0456563,-0.130007,-0.0396328,-0.178908,-0.165192,-0.108057,-0.0674132,-0.00274171,-0.0506129,0.00302379,-0.0169704,-0.167833,0.0288901,-0.0551018,-0.0445006,0.01971,-0.0892167},{-0.0828092,0.0436073,-0.0153846,-0.0556935,0.165314,0.429285,0.500007,0.436717,0.388559,-0.0473812,-0.396501,-0.311115,-0.236445,0.124917,-0.00924438,-0.217182,-0.205051,-0.235105,-0.156398,-0.0251321,0.0141397,-0.112613,-0.100451,-0.0186299,0.0245511,-0.0799191},{0.165825,-0.106456,0.00483439,-0.00302061,0.113318,-0.0159876,-0.15027,-0.0730347,-0.147643,-0.103517,0.078873,-0.0642908,-0.0131889,-0.230331,-0.271971,-0.223853,-0.185908,-0.155561,-0.103178,-0.0569284,0.0416296,0.0235344,0.111559,0.135581,0.0359623,-0.035663},{0.233939,0.0596095,0.0186244,0.0108189,0.00649755,-0.202315,-0.345267,-0.434358,-0.324216,-0.0605557,0.124377,0.287111,0.167793,0.190395,0.267024,0.178351,0.240601,0.296503,0.330999,0.282955,0.156858,-0.21767,-0.0792758,-0.209174,-0.154219,0.0089824},{0.0914868,0.0629755,0.0560258,-0.0354957,-0.0237609,0.0572397,-0.0406011,-0.0769235,0.0620333,0.0391925,0.0786974,0.06541,-0.00997311,-0.0352094,0.0804182,0.0273266,-0.0652295,-0.0862683,-0.09726,-0.0570949,-0.067621,0.0501727,0.0161945,0.0142272,-0.118982,-0.121551},{0.416407,-0.0125622,-0.00530631,0.0290321,0.0271186,-0.0340038,-0.0306789,-0.0534643,0.0398109,0.0978017,0.147492,0.053434,-0.0228188,-0.0243632,0.0788877,0.135412,0.137731,0.135848,0.0100109,-0.157238,-0.434008,-0.265297,0.190307,0.22113,-0.0871056,-0.0104838},{-0.0107161,-0.013658,-0.0409443,-0.0193722,-0.114404,0.112984,0.158991,0.284752,0.06553,0.320772,0.451355,0.43587,0.188613,-0.0509208,-0.222498,-0.394614,-0.261311,0.109721,0.421876,0.530913,0.325423,0.0374273,-0.0624789,-0.115511,-0.0889032,-0.0735372},{0.210227,0.0392838,0.0554065,0.0418645,0.130472,0.106712,0.146894,0.0584891,0.0321629,-0.151828,-0.334774,-0.375462,-0.406777,-0.195465,-0.057188,-0.0818389,-0.0278485,-0.143758,-0.151227,-0.193091,-0.145754,0.0125319,-0.0790767,0.100317,0.0742691,-0.0147838},{0.207794,0.0110558,-0.0718197,-0.0357218,0.0342234,-0.0490265,0.195472,0.179476,-0.00527268,-0.0970657,0.0494574,0.0792348,0.0826036,-0.0526917,-0.00454368,-0.129075,0.00646815,0.0704124,0.0679032,0.0120431,0.139411,0.0584693,-0.0402608,0.0182952,0.137505,-0.0232129},{-0.00901535,-0.0164862,-0.0547587,-0.125103,-0.0650555,-0.0138302,-0.00173711,-0.129681,-0.0457599,0.226666,0.3892,0.367961,0.246931,0.212224,0.430623,0.365622,0.383164,0.238179,0.142707,-0.0251344,0.102411,0.320274,0.129578,0.0494304,-0.130017,-0.00668724},{0.221041,0.130536,0.153268,-0.0502957,0.0735376,0.0171118,0.0170779,0.175545,0.223487,0.354078,0.406269,0.114482,-0.0349901,-0.117053,0.0433393,-0.168061,-0.135031,-0.175717,-0.0926523,0.11128,-0.0535414,0.108629,0.169123,0.194405,0.0949747,-0.0653629}};
+static DTYPE_WEIGHTS_WGF_bw WGF_bw_in[NUMBER_OF_NEURONS][NUMBER_OF_INPUTS_NONRECURRENT] = {{-0.04928,0.00805525,-0.0301834,-0.0385814,0.0330821,0.191903,0.0361994,0.121704,0.0291066,-0.12128,-0.326945,-0.223368,-0.090096,0.0473597,-0.00522712,-0.120603,0.0137078,-0.0775056,0.131516,0.161221,0.268359,0.186773,0.0984225,0.126439,-0.184185,0.045637},{-0.128734,0.0190351,0.0182774,-0.020744,-0.0169944,0.00955613,0.0591806,0.144743,0.25265,0.0752704,-0.269321,-0.252991,-0.334087,-0.182329,-0.219561,-0.194225,-0.066541,0.245019,0.0480122,0.0247848,0.0433378,-0.02487,-0.106963,-0.215632,0.0274923,0.015717},{-0.00218757,0.0608969,0.100626,-0.0393064,-0.0507355,-0.0727,-0.0959526,0.110112,0.637461,0.566326,0.0982708,-0.0501977,0.0579938,-0.309013,-0.441806,-0.321845,-0.0885162,-0.160517,0.0426977,0.190177,0.069465,-0.088762,-0.00703049,0.0509736,-0.0120613,-0.0283774},{-0.155364,0.00590614,-0.0390338,-0.0275103,-0.00839559,0.149877,0.224942,0.313429,0.443755,0.349963,0.0725398,0.117619,-0.0532868,-0.186792,-0.331314,-0.315086,-0.310742,0.0546757,0.335031,0.471756,0.271422,0.21969,-0.0157519,-0.0414923,-0.00646653,-0.10334},{-0.108784,0.0581627,-0.046131,-0.0234809,0.0227002,0.126235,-0.0148451,-0.0176188,-0.0977201,-0.212406,-0.11769,0.192614,0.260336,0.166729,0.0423658,-0.22255,-0.372665,-0.326534,0.0797241,0.280325,0.32921,0.420959,0.217214,-0.0245057,-0.0333955,-0.0158289},{-0.143507,0.0261511,0.0396024,-0.0233471,0.0566754,0.0953379,0.106926,0.191878,0.425467,0.121464,-0.221532,-0.217458,-0.101609,0.104154,0.166866,0.177212,-0.0984596,-0.222285,-0.040404,-0.0922045,0.156906,-0.00907625,-0.127915,-0.243262,-0.0110251,0.0440333},{0.0493436,0.0135322,-0.0709528,-0.0268769,0.00985297,0.0875671,-0.00122758,0.0876999,0.106952,0.152885,0.167177,0.238869,0.225883,-0.0734825,-0.0448738,0.00505675,0.0813415,0.144567,0.294009,0.20022,0.150997,0.00911198,-0.0542629,-0.00210541,-0.0541958,-0.0399809},{0.0804812,-0.0577278,0.0392785,-0.0427599,-0.0730856,-0.0142051,-0.0128407,-0.0988545,-0.0396891,-0.0183053,-0.0181657,0.147902,0.209209,0.186479,0.145086,0.257044,0.175935,-0.0436953,-0.353205,-0.155719,-0.0650159,0.174409,0.0556544,-0.0464961,0.0427994,-0.0377611},{0.152314,0.0125363,0.0428077,0.0790234,-0.040011,-0.00599974,0.078142,0.0280877,-0.000172542,0.0591466,-0.069043,-0.111046,-0.123763,0.0311058,0.0396578,-0.0122247,-0.0811843,-0.0106719,-0.0691124,-0.0827465,0.0248366,-0.118181,-0.100649,-0.011557,-0.0581304,-0.0322174},{-0.0646788,-0.00112497,-0.00806454,0.0427448,0.0617881,0.011355,-0.013327,0.0433553,-0.0562744,-0.0659019,-0.201648,-0.266055,0.0654955,0.0184697,-0.0914689,-0.0787617,0.0381874,0.25999,0.267696,0.0649078,-0.114282,-0.275953,-0.113497,0.0168719,0.120518,-0.00487718},{-0.0566267,-0.0104931,-0.0470811,0.00696363,-0.0362463,0.0352687,-0.054589,-0.0587268,-0.11599,-0.338706,-0.157395,0.262469,0.209969,0.218653,0.33818,0.60957,0.537031,0.489293,0.464813,0.291728,0.0811874,0.0398161,0.0370459,0.145207,-0.0341309,-0.0473743},{-0.1117,-0.0079726,0.0151352,0.0231912,0.0160919,0.0444265,-0.0772583,0.0248462,0.215266,0.317041,0.0192545,-0.150929,-0.16134,0.0513878,-0.00687682,-0.154643,0.00867123,0.0811279,0.072735,-0.00857452,0.000533135,-0.010274,-0.219802,-0.160939,0.0132838,0.080264},{0.0160228,-0.065102,-0.0178287,-0.0420302,-0.0877207,-0.013717,-0.0809884,0.147069,0.119833,-0.145115,-0.14718,-0.00837352,0.159683,0.329876,0.230649,0.150584,0.00835239,0.120973,0.163518,0.220662,0.234517,-0.0207061,-0.0346936,-0.0192139,-0.0397546,-0.0403145},{-0.0244877,-0.0837111,-0.0151494,0.0683901,-0.000136072,-0.072998,-0.0312778,0.000903132,-0.0753845,0.0202288,-0.0308669,0.196347,0.0828702,0.211684,0.517026,0.249645,0.259368,0.385129,0.387473,0.00807395,-0.331225,-0.183036,-0.126519,0.0962872,0.0488513,0.025076},{0.000170521,-0.00899311,0.000467457,0.00960083,-0.100272,0.0774298,0.0313693,-0.00982082,-0.214198,0.0235461,0.298025,0.44856,0.540747,0.294516,0.159333,-0.0573245,0.105808,0.333168,0.24306,0.287053,0.283904,-0.0174179,-0.236655,-0.0710034,-0.168396,-0.00197061},{-0.0952457,0.018954,0.0837334,0.0152939,0.0314633,-0.0548573,-0.131268,-0.280935,-0.127133,0.0906339,-0.0131976,-0.141275,-0.422776,-0.296134,0.234976,0.581057,0.399259,0.0135218,0.27685,0.226865,0.0248434,-0.0803242,-0.333028,0.0260187,0.0497624,0.0627165},{-0.0515908,0.0110947,0.00150499,-0.0803322,-0.0421704,-0.122692,-0.00500667,-0.131676,-0.33548,-0.364659,-0.0128577,0.0184989,-0.032045,0.073722,0.0285747,0.23169,0.175734,0.0764485,0.141014,0.210272,0.204354,0.0232837,0.0361105,0.12584,0.0169092,0.00220774},{-0.0940805,0.066965,0.023954,0.0337627,0.00491111,-0.0328571,-0.0434661,0.0740068,0.310544,0.299797,0.13102,0.0696644,0.148558,0.0136419,-0.127953,-0.413383,0.0113664,0.117588,-0.292297,-0.359406,-0.315531,-0.104856,0.11703,0.165664,0.0642159,-0.00783868},{0.221123,0.0601209,0.018553,0.0853181,-0.00429203,-0.000470717,-0.0241658,0.0642771,0.033529,0.123266,-0.0951077,-0.239658,-0.112643,-0.0768089,0.0311809,-0.0784663,-0.0319529,-0.121944,-0.0780962,0.0476792,0.0663482,-0.0938234,-0.214104,-0.00142931,0.124715,-0.0288011},{0.170199,0.0777178,-0.0103441,-0.078162,0.0896329,0.0906943,0.129836,0.166005,0.177386,0.121053,-0.00545418,-0.128617,-0.0906547,-0.0124984,-0.0179568,0.019187,-0.0503102,-0.107585,-0.060891,0.0513323,-0.0175496,-0.153883,-0.0671542,-0.048718,0.0384534,0.0213751},{-0.0852163,-0.0567896,-0.055655,-0.0486478,0.0485597,0.348864,0.376457,0.14271,-0.0636984,-0.128319,-0.0844833,0.0735602,0.159937,-0.0779168,-0.113426,-0.235468,-0.138458,-0.155669,-0.371248,-0.359606,-0.24713,-0.0282363,0.0996708,-0.0211665,0.00157009,-0.0187837},{0.211606,0.0126323,-0.0469284,-0.0785081,-0.13017,-0.00835484,-0.00946236,0.0608569,0.0420632,-0.113348,0.0026481,0.0181332,-0.0163203,-0.0266946,-0.00370098,0.0862482,0.00315442,-0.0542646,0.002972,-0.0538387,-0.0036296,-0.122037,0.0174033,-0.12458,0.0325282,-0.0390316},{-0.195196,-0.00546094,0.0414894,-0.0880099,0.0117869,-0.061397,-0.0280713,-0.117855,0.129863,0.1806,0.145491,0.0350346,0.139871,0.166128,-0.0588234,-0.0217468,-0.0846157,-0.12952,-0.234646,-0.0757999,0.0209807,-0.140374,-0.193161,-0.0694978,0.046031,-0.0147107},{0.0145591,0.0333155,0.0194943,-0.0437759,-0.130071,-0.156634,0.00832391,-0.1613,-0.0546143,0.0790908,0.0984347,0.278984,0.181052,-0.178291,-0.279971,-0.334834,-0.262434,-0.0439667,0.123167,0.199532,0.165871,0.0773232,0.0234708,0.0942731,0.0737076,0.0242197},{0.0223116,0.0839218,-0.0231717,-0.0676543,0.00422554,0.195818,-0.0852477,-0.125852,-0.190387,-0.0404287,-0.0835644,-0.0891357,-0.0560592,0.0124086,-0.124873,-0.108518,0.00507178,0.0277959,-0.024799,0.11142,0.221341,0.153707,0.0102508,0.0940774,-0.0502402,-0.16446},{0.389635,0.0166168,0.0732894,0.138786,-0.0172754,-0.0354122,-0.0400587,0.0366678,0.263443,0.0654356,-0.0278632,-0.154317,-0.0528791,0.094581,0.0974464,0.102083,-0.0642323,-0.123756,-0.082087,-0.0189207,0.0121502,-0.00773251,-0.0509286,-0.0361654,-0.137263,-0.0755008},{-0.199586,0.0579265,0.0175993,0.0202268,0.0147546,-0.00986135,0.069252,0.0119905,-0.00482279,0.0965986,0.327927,0.267929,-0.0304882,-0.325852,-0.602571,-0.467888,-0.107138,0.246702,0.315963,0.289169,0.0258663,-0.298395,-0.217105,0.0432763,0.0661868,-0.0122238},{0.172542,0.0617468,0.0493643,0.0623287,-0.078091,-0.0294061,0.0330095,0.0536412,0.0760917,-0.0358865,-0.0722388,-0.10387,-0.13776,-0.00247679,0.0149182,0.0528948,-0.195556,-0.132318,-0.104218,0.0555271,0.0952283,-0.107256,0.0036566,0.0169124,0.0406737,0.0186154},{-0.0215694,-0.0439902,-0.129031,0.0429083,0.105737,-0.00420979,0.0218723,0.22345,-0.0859508,-0.270229,0.199218,0.0852118,-0.1307,-0.402605,-0.456315,-0.360437,-0.108545,0.186476,0.510819,0.567013,0.173332,-0.0723964,-0.16284,-0.148022,-0.025791,0.0647979},{0.359149,0.0197545,-0.0459438,-0.0516821,0.0711624,0.0825481,-0.0969381,0.076465,0.0274482,-0.000470312,0.0997391,-0.0449424,-0.127968,0.0106729,0.0220329,-0.183495,-0.102891,-0.176317,-0.384094,-0.187771,-0.0962334,0.107969,0.0085794,-0.0992341,-0.0259452,0.10288},{0.116795,-0.0821374,0.0685715,0.0216804,0.106046,0.218485,-0.0022683,-0.00407778,-0.13234,-0.141841,-0.0949273,-0.0685988,-0.0678566,-0.0748886,-0.0864173,0.0424377,0.0478071,-0.16155,-0.063881,0.0654439,0.119228,0.008319,-0.240338,-0.115439,0.00976086,0.0325566},{-0.0816791,-0.0115161,0.0551988,0.0989585,0.192832,0.038517,-0.261441,-0.274064,-0.14524,0.0522371,-0.0290472,-0.342299,-0.318659,-0.14102,-0.0706627,0.228642,0.162992,-0.189527,-0.305879,-0.20193,-0.0737336,0.114197,0.092723,0.216305,0.0823919,-0.00298989},{-0.288253,-0.0252992,-0.0388934,-0.0593862,0.0111632,0.164017,0.143425,0.100202,0.163634,0.166354,0.255904,0.0259845,0.00255139,0.248659,0.297794,0.352343,0.130965,0.0258574,0.0345748,0.2014,0.357431,0.097766,0.18166,0.148671,-0.12058,0.00480775},{0.146247,-0.00811043,-0.0798896,-0.060615,0.228451,0.1471,-0.119088,-0.212086,-0.296843,-0.181139,0.135584,0.175223,0.184465,0.24229,0.0867833,0.0228524,-0.108388,-0.261743,-0.350499,-0.143008,0.0412033,0.188159,0.00574786,-0.0584421,0.0462216,-0.0312598},{-0.0343324,0.0448467,-0.00873127,-0.0277747,-0.0815151,-0.00514274,0.171163,0.23156,0.344918,0.268658,0.236538,0.119485,0.118755,0.0334789,-0.0877852,-0.0170116,0.243091,0.26171,0.167247,0.0892847,-0.172398,-0.0727927,0.0440609,-0.0649376,-0.0670204,0.0259877},{0.199131,-0.0127268,0.00590825,-0.113786,-0.0704838,0.0249342,0.141231,0.0972816,0.274927,0.21333,0.025324,-0.0244712,0.0115175,0.236941,0.101017,-0.0196784,0.0126792,0.0601588,0.155055,0.239389,0.0474594,-0.128003,0.0169428,0.00281035,0.0235323,0.00065739},{0.136509,0.0838379,0.0526928,-0.0780964,-0.0413802,-0.0674909,-0.056288,-0.0471012,0.084433,0.423708,0.398221,0.514399,0.354913,0.0957943,0.0398927,0.00667339,-0.0646418,-0.310189,0.0362109,0.231068,0.0828082,-0.0878451,-0.0400243,0.0107323,0.115683,-0.0492477},{0.0756958,-0.0323448,0.0135748,-0.0482737,-0.0234345,0.113459,0.0788203,0.0492044,0.113045,-0.417426,-0.493921,-0.238468,0.505406,0.529102,0.1791,0.0400998,-0.223145,-0.0959622,-0.000753529,0.140207,0.23753,0.054207,0.0153114,-0.0203592,-0.0860592,-0.048278},{-0.260778,-0.0297939,0.0257829,0.0583739,0.0566389,-0.0431737,-0.067303,0.10708,0.297106,0.509883,0.232119,-0.188586,-0.205086,-0.283686,-0.247288,-0.483918,-0.372978,-0.483857,-0.323793,-0.214852,-0.260991,-0.185801,-0.207986,-0.0339451,0.114142,-0.00466209},{-0.211671,0.0979569,0.00396931,-0.0745872,0.029508,-0.0200744,-0.099604,0.00313462,0.030506,0.111133,0.0430677,0.149837,0.227262,0.156911,0.269357,0.233759,0.27718,0.20015,0.170015,0.0753541,0.223997,0.0563314,-0.00597505,0.0502927,-0.0773147,0.0855406},{-0.00309061,0.0358638,0.141519,-0.00513917,0.0791579,0.0725951,-0.0688013,-0.241055,-0.255266,-0.0869347,0.0272803,-0.113152,0.115774,0.122913,0.328819,0.0665741,-0.121755,-0.168052,0.0623088,0.152452,0.0659827,0.077878,0.051379,-0.0584058,0.0246712,-0.0369628},{-0.0492355,-0.0580324,-0.0300307,-0.074632,0.0274298,0.131616,0.34996,0.330578,0.317306,0.322943,0.17694,0.0249995,0.0280227,0.102346,-0.0129955,-0.0750822,-0.108234,-0.145764,-0.0509144,-0.203435,-0.0237128,0.141883,0.269526,0.088114,-0.129347,0.00171638},{-0.0123838,0.0970711,0.0678031,-0.0218675,0.0544096,0.0261324,0.0605405,-0.0210368,-0.0330438,0.0677565,0.0460231,0.111269,-0.0374031,0.229228,0.214418,-0.0262553,-0.162812,0.0457505,0.258822,0.114954,-0.068138,-0.0884864,-0.103726,0.0636079,0.104676,-0.0104339},{-0.032708,0.0275903,0.0240698,-0.00817306,0.0831881,0.0611018,-0.0178276,-0.0170129,0.0180266,-0.0879329,-0.0604442,-0.0688716,-0.0516693,-0.136783,-0.02356,-0.0737202,-0.214488,-0.198208,0.0233907,0.10587,0.170381,0.200203,0.0487373,0.0556549,0.0865671,-0.0263276},{0.00236577,-0.0137276,0.0760527,0.000197137,-0.0203964,-0.0632714,-0.142429,-0.119352,0.000935954,0.0523303,0.236215,0.246175,0.215971,0.204089,0.338421,0.218729,0.0270189,0.247765,0.28625,0.226635,0.178318,-0.162388,-0.103548,-0.0284022,-0.170126,0.0188778},{0.00347776,0.0294522,0.0391303,-0.0509896,-0.000923272,0.156556,-0.054447,-0.0339005,0.0702917,-0.021575,-0.0310203,-0.0271658,-0.04774,0.063664,-0.207068,-0.259809,-0.169239,-0.0694494,0.0580087,0.228768,0.196882,0.0548362,-0.0115809,-0.0706959,-0.0836374,0.0484188},{-0.0760043,-0.0212708,-0.0818397,-0.104711,-0.00964625,0.252043,0.284733,0.367596,0.136683,0.0808553,0.253727,0.401668,0.263406,-0.320808,-0.595891,-0.588188,-0.407707,0.0977955,-0.0634906,-0.0589376,0.0834314,-0.0227601,0.196675,0.295837,0.185755,-0.0408777},{-0.238045,0.0277627,-0.0368271,-0.0616392,-0.0722794,0.141653,0.288721,0.493053,0.558275,0.257645,-0.205621,-0.519645,-0.636273,-0.780912,-0.482545,-0.297169,-0.069982,-0.0517533,0.208626,0.373012,0.489883,0.165708,-0.0331412,-0.0172363,0.106061,-0.097901},{0.117497,-0.0650386,-0.00921248,0.113131,0.0989943,0.0336575,-0.158117,-0.235255,-0.185431,-0.12076,-0.152291,-0.102369,-0.0634277,-0.0379724,0.00600578,0.0598261,0.0907645,0.211497,0.129301,-0.0988167,-0.0863949,-0.218726,-0.140828,0.104186,0.0808849,0.103352},{-0.101633,0.0313749,-0.0240035,-0.049608,0.0777863,0.0992412,0.0460619,0.082656,0.0600439,0.334187,0.270899,0.182279,0.30105,0.262192,-0.0843076,-0.250687,-0.248616,-0.0524993,0.242377,0.357693,0.163302,-0.100543,-0.246132,-0.0440366,-0.0280368,0.00846355},{-0.0163125,-0.0244752,-0.021778,0.026746,0.0127633,-0.176886,-0.208068,-0.368037,-0.23398,-0.015011,0.168239,0.348697,0.2025,0.0885267,-0.0808837,-0.211606,-0.102532,-0.00595142,-0.208073,-0.289649,-0.111419,-0.0556425,0.10278,0.108408,0.191916,0.00395418},{0.169468,0.0371849,0.0102441,-0.0151904,0.0835201,0.126673,0.0311477,-0.0236844,-0.202349,-0.278658,-0.161264,-0.291505,-0.112349,0.0358108,-0.0238369,0.0426241,-0.0646864,-0.016939,0.158225,0.13571,0.2186,0.28594,-0.00519137,-0.0520205,0.0102018,-0.0796448},{0.0436048,0.0473172,0.0384981,-0.0650542,0.0292495,-0.0809681,0.0366189,0.218358,0.313549,0.385348,0.0649093,0.0359456,0.0378759,0.128185,0.212124,0.0487535,-0.138288,-0.124127,-0.225082,-0.260931,-0.167555,-0.030998,0.110751,0.00648812,-0.0769639,0.0661904},{0.0313524,0.0263182,-0.0260566,-0.0322858,0.0574068,0.12648,0.120081,0.145645,0.030289,0.128391,0.064756,0.0479012,-0.0107723,-0.165388,-0.421465,-0.38871,-0.198318,0.0699604,0.168063,0.131745,-0.2024,-0.212456,0.0556524,0.0248788,0.0862927,0.0581685},{-0.18423,-0.0153691,0.0687108,0.0997132,0.0266669,-0.158129,-0.0246198,0.0110507,0.0871756,0.356583,0.090094,-0.106463,-0.267729,-0.140863,-0.237713,-0.253919,-0.173196,-0.216276,-0.164197,-0.0944269,0.045902,0.0579622,-0.14008,-0.0991883,-0.0578389,-0.0230339},{0.329902,0.0705517,0.0994037,0.109884,0.0659132,0.0711691,-0.0991181,-0.0472367,0.120754,0.10188,0.0754509,0.0230081,0.0323802,-0.00308331,-0.216631,-0.064247,0.141398,0.0420201,0.0629211,0.115656,0.205049,0.171023,0.112851,0.0809051,-0.0155956,-0.0877658},{0.0156308,0.130405,0.0143066,-0.0374094,0.0314928,-0.0496692,0.0138602,0.14334,0.0473127,-0.0259451,0.0853599,0.102347,-0.0583296,-0.0584363,0.115677,0.195818,-0.0665513,-0.0128049,0.166312,0.274695,0.192428,-0.0171976,0.00351894,-0.0357813,0.0678973,0.00359222},{0.0375016,0.012281,0.0178781,0.0785817,-0.056239,0.0501357,0.127216,0.0566218,0.128519,0.0881318,0.0348606,0.0417973,0.09109,-0.0244761,-0.0600297,-0.058588,-0.0381305,-0.138261,-0.150921,-0.0247495,0.00265058,-0.00560623,-0.064434,-0.0401234,-0.00386641,-0.0454828},{0.10498,0.022442,-0.0269892,-0.00911311,-0.041719,0.0660874,-0.0227126,-0.0223632,0.0417026,0.0594457,0.0811579,0.0703539,0.107762,0.144154,0.162571,0.0929575,0.0792739,0.213469,0.172,0.152999,0.0891769,0.0893683,0.0320944,-0.0512858,-0.16747,-0.06745},{-0.089703,0.0119975,-0.0241114,-0.115927,-0.107645,-0.0126441,-0.0622898,0.0552912,-0.0152578,0.170089,0.171183,0.147119,-0.143308,-0.174871,0.0269628,0.159211,-0.0361891,-0.0102534,0.230165,0.0939789,0.0946807,-0.0450233,0.182632,0.0713026,-0.0405284,0.00669932},{0.126157,0.0355165,-0.0383696,-0.0273247,-0.0242115,0.0142077,-0.106239,-0.211104,-0.0679088,0.00844141,0.078678,0.0562648,0.0624974,0.0589841,0.0614206,-0.0535131,-0.110831,-0.322054,-0.0326571,-0.0228444,-0.134211,-0.12028,-0.049428,0.129615,-0.0199472,0.0230393},{0.171877,-0.0681936,-0.0479021,-0.000951412,0.190586,0.119689,-0.0958558,-0.0950668,-0.153225,0.00308826,0.0360773,0.129615,0.0568805,-0.272198,-0.499288,-0.0314688,0.108819,0.0431089,-0.129917,0.310598,0.393124,0.266079,0.0921219,-0.114846,-0.0656255,0.0632455},{-0.111117,0.0320024,-0.00125083,-0.037252,0.0952244,0.0891998,-0.03476,-0.0130101,0.0729081,0.101452,0.21622,0.381136,0.209363,-0.188596,-0.236686,-0.196395,-0.020092,-0.0797562,0.0133992,0.151621,0.20086,0.313558,0.0252829,-0.0684934,-0.0885077,0.00638644},{-0.32393,-0.0330294,-0.0550487,-0.0995659,0.0840294,0.185978,0.0339476,0.179334,0.183594,0.0174074,-0.342557,-0.389816,-0.255752,0.0365429,0.309323,0.32515,0.0774439,-0.32276,-0.19525,0.0546843,0.0727676,-0.0523671,-0.214799,0.0150281,0.0133643,-0.0285323},{0.147305,-0.00049612,0.0138704,-0.00360184,0.126544,0.180295,0.0739894,0.28169,0.188401,0.0277859,0.103677,0.320411,0.137293,-0.275407,-0.473772,-0.503492,-0.208727,0.445224,0.621123,0.522495,0.312582,-0.0711679,-0.195872,-0.168436,-0.0732316,0.0263264},{0.202249,-0.00104414,-0.0147654,0.0685604,-0.0422921,-0.000912401,0.0525235,0.0473088,-0.0683844,0.0560695,0.0289939,-0.0194327,0.0901599,0.0322201,0.102425,0.171673,0.139851,0.106692,-0.0826137,-0.0836147,0.0109178,-0.109365,-0.178969,0.0169798,0.0372749,-0.0111637},{-0.0292337,-0.0343834,0.0279459,0.0473412,-0.379986,-0.339443,0.0199271,0.448592,0.597612,0.423756,0.00519457,-0.298371,-0.202018,0.103495,0.12315,0.0119045,0.0235898,-0.0543378,0.13385,0.131038,0.172141,-0.00928599,-0.018849,0.112378,0.0810848,-0.0295246},{0.206757,0.127799,0.104893,-0.00647601,-0.0320428,0.00791165,-0.126743,-0.218335,-0.160773,-0.215888,-0.0107612,-0.0449779,-0.232133,-0.0503585,-0.180722,-0.190118,-0.124774,-0.207165,-0.21423,-0.00554118,-0.153891,-0.0558016,-0.13342,-0.0369675,0.0340317,0.0359728},{0.0322024,0.00490867,0.0581766,-0.0607429,-0.0939764,-0.0622536,-0.0326296,-0.207077,-0.163548,0.0243584,0.245266,0.367211,0.364559,0.168997,-0.172334,-0.422144,0.064637,0.616681,0.706707,0.264532,0.0320613,0.0790458,0.102253,0.123173,-0.0368891,0.0113009},{-0.0519527,0.0409936,0.0426434,0.0117088,0.012197,0.231001,0.219165,0.120657,0.140245,0.0845762,0.174327,0.317973,0.258014,0.340842,0.472015,0.318896,0.123481,0.248094,0.198019,0.159622,0.112642,-0.0155307,-0.0568125,-0.18634,-0.102725,-0.0132993},{-0.0376192,0.00177107,-0.0160418,0.0661906,0.0513564,-0.049225,-0.100561,-0.257235,-0.165274,0.0781968,0.00289452,-0.115255,-0.180222,-0.0842527,0.00278501,0.0848138,-0.0929218,-0.245277,-0.252132,-0.0964796,0.0172421,-0.0923778,-0.148481,0.0904311,0.017594,0.0195264},{0.168695,-0.0921785,0.0295943,-0.0574223,-0.0709942,0.135708,0.160039,0.135657,0.0839452,-0.0341166,0.0270397,-0.0837538,-0.120176,0.0521101,0.0222476,0.105278,-0.0252813,-0.134741,0.0264278,0.0295585,0.0519498,0.0925774,-0.0708543,-0.00207465,-0.0347371,0.0175102},{0.111946,-0.00318405,-0.0021754,0.0690468,0.00191553,-0.175767,-0.157961,-0.157963,-0.0106902,0.125988,-0.410252,-0.549951,0.163795,0.36365,0.366765,0.447487,0.310184,0.0605381,-0.298264,-0.0882971,0.0568927,0.125035,0.0580568,-0.0756495,-0.0574109,0.0223675},{-0.0691639,-0.0130613,0.00692217,0.147935,0.0618009,-0.083782,-0.0649773,0.119228,0.0609278,-0.0196892,-0.395659,-0.265052,-0.0133049,0.142427,0.156998,0.0685905,-0.0627119,-0.181993,-0.293407,-0.162347,0.0179372,-0.111059,-0.142994,0.00291229,0.0610552,0.0417843},{0.0154838,-0.0576638,-0.0541535,-0.000238552,-0.118665,-0.246905,-0.352844,0.0174577,0.175563,0.421502,0.220413,0.139387,0.237765,0.240385,0.0877741,0.113511,0.199273,0.191597,0.0776531,0.0892594,-0.0252191,-0.0685754,-0.0522593,0.0110221,0.0285831,-0.0461707},{0.39731,-0.0250542,0.0749871,0.046159,-0.0128116,0.0562447,-0.00539308,0.071273,-0.0107412,-0.0333959,-0.00893754,-0.0553304,-0.074315,-0.105722,-0.0325249,-0.119656,-0.0859143,-0.0591182,-0.0896915,0.041727,0.0249043,-0.120063,-0.10347,0.0325375,-0.0728079,0.0165455},{-0.0321,0.0625091,-0.0598632,-0.111952,-0.0992263,-0.0835722,-0.108387,-0.0554826,-0.149795,-0.0924939,0.00990489,0.11011,0.172035,0.294834,0.108735,0.102557,0.0999309,-0.200421,-0.365308,-0.152365,-0.0394316,0.198183,0.330702,0.310654,0.0720485,-0.0590694},{0.0346884,-0.0249202,-0.117199,-0.00056119,0.0540934,-0.0076036,-0.0659107,0.103073,0.400223,0.267295,-0.173009,-0.090719,-0.014031,0.193624,0.115744,-0.0714616,0.0123599,0.0255736,-0.137322,-0.234622,-0.136864,0.132387,0.0355005,0.0588257,-0.0423596,0.0521067},{0.0291056,0.0228079,0.0198292,-0.13976,0.0322923,0.206738,0.0809963,0.203978,0.0663456,0.0905278,-0.0503801,-0.0323077,0.00231479,-0.0574403,-0.0292086,-0.0642058,-0.00453337,-0.0802198,0.101063,0.326836,0.154665,-0.0211611,0.0170169,0.026565,-0.00631495,0.0581296},{-0.0785203,0.0588316,-0.00468672,-0.113218,-0.243316,0.3265,0.527406,0.597755,0.284158,-0.0561204,-0.123803,0.0126754,0.302088,0.393369,0.270346,-0.061254,-0.126251,0.0576823,-0.0148612,0.0111933,0.122169,-0.0986812,-0.102127,-0.0604896,-0.0476066,-0.110258},{0.0567562,0.02331,0.0404462,0.0130286,-0.0341745,-0.0502633,0.0232208,-0.0234383,0.104892,0.112882,-0.230208,-0.207072,-0.0586705,0.180294,0.103834,0.000806343,0.0852029,-0.0967106,-0.25909,-0.175488,0.0301749,0.0371218,-0.0413458,0.0275376,0.052359,-0.0129545},{-0.0114942,0.00436546,0.012172,0.00830014,-0.0474715,-0.0481112,-0.0402994,-0.0461989,0.0302093,0.318739,0.229711,0.243661,0.0970917,0.16214,0.148938,0.206249,0.302301,0.144099,0.16392,0.113793,0.0235887,-0.13988,-0.0250896,0.0444461,-0.0138291,-0.0522865},{-0.181349,-0.0924704,-0.0257397,0.0121551,0.0584012,0.0422346,-0.0449621,0.102057,0.123094,0.149166,0.060798,-0.0588921,-0.022201,0.0456927,0.237583,0.263571,0.0208464,-0.105607,0.0992083,0.385879,0.293042,0.107804,0.125698,0.15676,-0.0395337,-0.0360374},{0.0317535,0.0176572,-0.00600429,-0.0228303,-0.0945876,0.153359,0.0192152,0.0408488,0.0880845,0.193609,0.314708,0.245931,0.189213,0.396329,0.520199,0.491337,0.302163,0.170991,0.0597532,0.0333235,0.078244,0.00291717,-0.0179022,-0.0587125,-0.173272,-0.0491972},{0.0403683,0.0566308,0.0526913,-0.0212006,-0.113519,-0.0710252,-0.0318268,-0.0102901,0.233194,0.391649,0.178292,0.00267921,-0.220149,-0.241829,-0.349364,-0.08884,-0.0232195,0.0369133,0.00996242,-0.0368147,-0.0636184,-0.279789,-0.132694,0.114471,0.141204,-0.00625846},{0.0806361,0.100057,0.0849149,-0.0563508,0.0266281,-0.0322554,0.0211952,0.075853,0.159735,0.142282,-0.027951,-0.208046,-0.173922,-0.255706,-0.116769,-0.0897424,-0.231698,-0.0617754,0.175819,0.0697543,0.101111,0.123986,-0.0183886,-0.0325364,-0.0351014,0.0473629},{0.101771,0.0747225,0.0132972,-0.0577833,-0.0196927,0.0724025,-0.061196,-0.0470659,0.0193757,-0.0400288,-0.12677,0.0647218,0.206851,0.406104,0.546408,0.383119,0.293666,-0.00868048,0.0526435,0.0970512,0.276199,0.089508,-0.0941749,-0.0730157,-0.0389056,-0.00550543},{0.024648,-0.0338633,-0.108824,-0.0281564,-0.0370447,0.20496,0.188561,0.190366,0.0546359,-0.0988224,-0.129376,0.0595065,-0.0295457,0.135647,0.292103,0.106458,0.0893148,0.0938594,0.0827213,0.119078,0.0809511,0.0332653,0.125875,0.00343377,-0.0750586,0.0574371},{0.175014,-0.0509329,0.0203106,-0.0113903,-0.0523215,-0.0431111,0.0190463,-0.270175,-0.515301,-0.0494001,0.449756,0.285542,0.0799782,-0.0427216,-0.0930122,0.10318,0.247121,0.287066,0.1595,0.14865,0.133014,0.198994,0.0135862,0.0468177,0.0486179,-0.00772923},{0.39513,-0.00425347,0.0462934,0.0639959,0.0197562,-0.0059097,0.0954438,0.0510739,0.0914599,-0.0295625,-0.0380299,-0.127321,-0.0239383,-0.0258941,-0.01757,-0.0724967,-0.0257567,-0.195184,-0.152449,-0.0655599,-0.0389371,-0.0157802,-0.0487352,-0.0214455,-0.024744,-0.00769145},{-0.00843382,-0.0361138,-0.0536873,-0.00257187,-0.0195146,0.155507,0.194757,0.109974,0.101028,-0.0307156,-0.142003,-0.266651,0.035099,0.0839637,0.112178,-0.0393607,-0.0926377,-0.135301,0.0849808,0.149966,0.154023,0.184189,0.00165362,-0.00710569,-0.0581149,-0.0302822},{0.0397629,0.018695,0.0655898,0.0332768,-0.196778,-0.179997,0.00648271,0.113824,0.30449,0.359214,0.160834,0.0980741,-0.107208,-0.0387936,0.106692,0.206985,0.28301,0.360734,0.349872,0.259034,0.226306,0.0916844,-0.103348,0.00946494,-0.113108,-0.0284852},{0.0730948,0.0732201,0.0303563,-0.0376808,-0.0584271,0.184558,0.342974,0.593684,0.397092,0.10867,-0.0219268,-0.00486952,0.07291,0.133832,-0.196261,-0.405078,-0.29294,-0.525811,-0.771354,-0.524055,-0.255527,0.224069,0.158861,0.0334919,0.05606,-0.0853789},{0.134107,0.0070617,-0.0631879,-0.132754,0.0104416,0.077248,0.0526398,0.0362686,-0.00172812,0.064383,0.0408923,-0.0795335,-0.0300458,-0.155022,-0.167108,-0.0589648,-0.0863957,-0.0176618,0.027493,-0.0109836,-0.0451704,0.0398947,0.0251919,0.0733739,-0.132619,-0.111092},{0.128442,-0.00703635,-0.0360735,-0.108023,0.0478465,0.138412,0.081097,0.0562859,0.136804,0.298268,0.216399,0.107884,0.0767584,-0.127471,-0.38508,-0.598518,-0.368918,0.0915278,0.57945,0.513798,0.368658,-0.00118405,-0.42338,-0.0810891,0.168626,-0.0478676},{-0.0221513,0.0452498,-0.0438218,0.038266,0.152267,0.165618,0.0837664,0.154639,0.0577292,-0.0590825,-0.122237,0.0306267,-0.0349366,0.100634,0.224115,0.442081,0.217138,0.122558,0.196394,0.193883,0.0537074,-0.103046,0.0471005,0.0595992,-0.117863,-0.0526359},{0.12472,-0.0289207,0.0540766,-0.0409816,0.0398722,-0.0462319,0.0947369,-0.036342,-0.0784089,-0.133844,-0.0737617,-0.195655,-0.270047,-0.00561137,0.189482,0.262461,0.130673,0.481995,0.847673,0.699856,0.307431,0.108031,-0.0175784,-0.0361717,-0.144217,0.0406083},{0.0349852,-0.0831427,0.111548,0.084707,-0.0970443,0.0427518,0.197715,0.309383,0.228391,0.425262,0.344877,0.108711,0.019692,-0.0637894,0.0452561,0.188987,0.0898744,0.0461555,0.318895,0.19673,-0.119225,-0.130461,-0.0979589,-0.024267,-0.00437036,-0.0970322},{-0.0162142,0.128008,0.0111282,-0.108098,-0.0112234,0.184186,0.0939108,0.0610482,-0.0291055,-0.174718,0.0602614,0.160542,0.0778972,-0.0497294,-0.274851,-0.256482,-0.250247,-0.131206,0.012667,-0.0664027,-0.0854359,-0.0866803,-0.109664,0.119927,0.10461,0.0628344},{0.0393685,0.0519299,-0.0382904,0.128066,0.000949124,-0.0826938,-0.1109,-0.110325,-0.0108593,0.206532,0.26614,0.109702,0.144919,0.165048,0.368464,0.342783,0.241005,0.337083,0.271812,0.0694941,-0.0537337,-0.104436,-0.200831,0.0517225,0.119482,0.00853079}};
+static DTYPE_WEIGHTS_WGO_bw WGO_bw_in[NUMBER_OF_NEURONS][NUMBER_OF_INPUTS_NONRECURRENT] = {{0.273751,-0.00887541,0.085416,-0.0189005,-0.0269769,0.190638,0.216837,0.239982,0.177059,0.010563,-0.00352355,-0.0419128,-0.128456,-0.142973,-0.117634,0.0389826,0.0948049,0.128521,0.165337,0.358449,0.20899,-0.0220508,-0.00430243,0.0249197,-0.153651,0.0196926},{0.261562,0.0127446,0.0752398,0.0236209,-0.0743816,0.0521899,-0.0286579,0.155529,0.275633,0.150398,0.0146787,0.0337243,-0.180851,-0.188545,-0.192458,-0.0431229,0.0617161,0.0974551,0.140628,-0.0209902,-0.0626661,0.0208984,0.0768282,0.0110767,-0.0525466,-0.0807824},{0.342674,0.00928469,0.0216684,-0.118406,-0.0638476,0.147824,0.0873268,0.118488,0.300112,0.360224,0.388308,0.239658,0.357808,0.213932,0.066626,0.125124,0.104752,0.220924,0.233373,0.286094,0.119614,0.149104,0.141563,0.115579,0.0426068,-0.06229},{0.273414,0.00318213,-0.0446289,-0.0191161,0.00567719,0.263131,0.392429,0.434015,0.263448,0.250501,0.0162599,0.173623,0.118416,0.240335,0.201134,0.0508873,0.0446009,0.218157,0.0824311,0.0776354,0.00346996,-0.0532548,0.0670929,-0.0626165,-0.0810134,-0.0398297},{0.138478,0.144102,0.0590967,-0.0504018,-0.128964,0.047246,0.0448601,0.230486,0.125649,-0.0419436,0.102317,0.173826,0.425876,0.186074,0.0700059,0.054182,0.0890894,0.0950415,0.14228,0.180763,0.310773,0.21693,0.129472,0.0848895,-0.0401146,-0.11438},{0.26722,-0.00592856,0.00531705,0.015313,-0.0723476,0.0566748,0.156451,0.261283,0.230694,0.011974,0.0562326,-0.134425,-0.0329607,0.0343328,0.00185092,-0.0449375,-0.116927,-0.0532753,0.00784259,-0.0219814,0.00431343,0.20771,0.036941,-0.0516948,-0.223039,-0.0213207},{0.220833,0.0750872,0.0118057,-0.0301779,-0.0531753,0.0510398,0.290212,0.364233,0.35554,0.372777,0.199572,0.0591046,0.0906717,0.00630416,-0.00142459,0.0673992,-0.0664209,0.0831298,0.114189,0.164694,0.122392,-0.153602,-0.0136194,-0.0269127,-0.101543,-0.0591793},{0.170999,0.0523064,0.0618399,-0.126543,-0.0511993,0.094369,0.12196,0.226653,0.101989,0.168575,0.149494,0.0682481,0.169866,0.035984,0.174843,0.00254551,-0.0173039,-0.0994531,0.0193845,-0.181165,-0.146112,0.058835,-0.0153008,0.000132249,-0.0221424,-0.0214775},{0.152952,-0.0388586,-0.0288953,0.0679404,0.0194843,0.0617413,0.00880373,0.0304784,0.129654,-0.00494416,-0.00313121,0.0467625,-0.127318,-0.0925026,-0.10308,0.0193697,-0.0838263,-0.0708247,-0.118102,0.0243882,0.0453962,-0.096406,-0.00889732,-0.0550836,-0.070357,-0.0887531},{0.327799,0.115393,-0.112234,-0.0228967,-0.0577339,0.0387467,0.0817911,0.0140462,0.166345,0.283733,0.2976,0.165963,0.189013,0.203228,0.100848,0.0496715,0.0958269,0.183236,0.178939,0.128461,0.11044,0.0553009,-0.0315058,0.0288616,-0.100447,0.0265324},{0.287217,0.0931253,0.00956502,-0.108022,-0.152467,0.0728294,0.207161,0.27774,0.211671,0.168696,0.0786504,0.152595,0.0452381,-0.218578,-0.0583152,-0.0632899,0.061913,0.323187,0.483625,0.556873,0.153331,0.0211377,-0.0134914,0.0763928,-0.0489233,-0.0363711},{0.325635,0.0597658,-0.00337187,-0.0601768,-0.0102016,0.200385,0.415089,0.218548,0.0135824,0.173921,0.366835,0.404275,0.412212,0.214243,0.205031,-0.00401704,-0.0250891,0.111089,0.209385,0.288129,0.217895,0.0520075,0.0314787,-0.00572455,-0.0687271,-0.0598339},{0.131932,-0.0147818,0.00259452,-0.180456,-0.191259,-0.23092,-0.187349,0.0344221,0.219796,-0.101135,-0.248855,0.0385256,0.031934,0.0222423,0.0934279,0.0305146,-0.0857557,0.0725165,0.123782,0.367585,0.379328,0.196344,0.0716427,-0.0240714,0.0347766,-0.0182928},{0.330215,0.0385463,0.039358,0.0361342,0.025764,0.0898659,0.145231,-0.0459608,-0.0386229,0.0423001,0.18032,0.0994613,-0.0507878,0.0544691,0.280722,0.262455,-0.0304915,-0.0550224,-0.0969128,-0.186407,-0.14321,-0.0958887,0.0512027,-0.0774369,-0.0833598,-0.0799321},{0.406686,0.106771,0.0954695,-0.0326818,-0.154729,-0.0696594,-0.000522031,0.134447,0.151454,0.25511,0.540995,0.546838,0.210492,0.0812143,-0.041488,0.0233461,0.315346,0.403029,0.334384,0.164904,0.184482,0.102304,-0.0603855,-0.0623454,-0.100211,-0.1337},{0.113137,-0.0413356,-0.0645326,-0.040844,-0.115554,0.266214,0.35217,0.264498,0.0673373,-0.0290389,0.397235,0.748605,0.763787,0.407529,0.0703408,-0.197996,0.0437924,0.495126,0.772293,0.405338,0.0964342,-0.0362939,-0.10948,0.01382,-0.0216579,-0.00859881},{0.291303,0.0712143,0.105228,0.0518869,0.0643821,0.185878,0.16851,0.123315,0.0423535,0.00678891,-0.0577836,-0.020847,-0.11064,0.0817551,-0.0354964,-0.152376,-0.151862,-0.0573132,0.0497813,0.0261429,0.0270252,-0.0284093,-0.154333,0.0872667,-0.0992387,-0.000762744},{0.201288,-0.023538,-0.0392287,-0.00363106,-0.0585421,0.0952212,0.245492,0.175887,0.185349,0.196116,0.150538,0.236257,0.157229,0.134495,0.229062,0.271704,0.175585,0.207889,0.0313445,-0.116679,-0.0282422,0.0248935,0.0570022,0.107033,0.0120432,-0.0812072},{0.429714,0.0517828,0.0698996,-0.0586947,-0.0863325,0.0943484,0.157204,0.116289,0.0344083,0.151252,-0.000110529,-0.187069,-0.0535973,0.023955,-0.0142042,0.0449343,0.090843,-0.0423547,0.0598599,-0.0229498,-0.00340335,0.0747397,0.11357,0.133051,-0.0663831,0.021798},{0.224387,0.0206831,0.00322804,-0.112412,-0.0295294,0.0177691,0.0702473,0.114629,0.225582,0.145867,0.115102,0.115233,-0.0673409,-0.05855,-0.0116965,0.0548266,-0.0184096,0.0515442,-0.0289779,0.00318702,0.0502253,-0.0641257,-0.0179075,-0.0266058,-0.0399175,0.0461425},{0.269127,0.00654369,0.00870443,-0.0110604,0.060552,0.15057,0.151772,-0.0765456,-0.430715,-0.415914,-0.129845,0.0382033,-0.168009,-0.177772,0.0145457,0.0160277,-0.124877,-0.17323,-0.213275,-0.169573,-0.00423226,0.0939546,0.148356,0.158995,0.00732901,0.0120018},{0.109323,0.0761028,-0.089745,-0.0783233,0.0353676,0.00941831,0.0424129,0.178871,0.128653,-0.0114708,-0.0547769,-0.048384,0.0772993,0.0156411,-0.00107124,-0.0223475,0.10347,-0.0900122,0.0867192,-0.0506977,-0.0797037,-0.0745685,0.0472743,-0.120808,-0.139446,0.0254214},{0.302914,-0.0488556,-0.0100416,-0.0634855,-0.0682908,-0.022095,0.0238819,0.00708701,0.0490491,0.0594,-0.0386304,0.164696,0.0450787,0.234821,0.274537,0.26358,0.218201,0.220338,0.326695,0.210138,0.0574262,-0.0242107,0.0874601,0.118028,-0.0412493,-0.0417711},{0.17371,-0.0741994,-0.0633158,0.097111,0.210389,0.322739,0.00655501,-0.303716,-0.212434,-0.0197982,0.138501,0.0814555,-0.163336,-0.30339,-0.51276,-0.286008,-0.213785,-0.0357469,-0.163594,-0.240098,-0.384377,-0.0576239,-0.0565193,0.0207701,0.0700521,-0.0137805},{0.3164,-0.018756,0.0795637,-0.0911835,0.0916528,0.217618,0.264138,0.224638,0.0808052,0.0799481,0.0872988,0.0811184,0.0362884,0.109134,0.0878676,0.0777241,-0.00872982,0.0715445,0.201811,0.15073,0.071126,0.069263,0.0762341,0.0407645,-0.0940725,-0.00845615},{0.202083,-0.0140833,-0.00355892,-0.103594,-0.0159542,0.121977,0.0691992,0.284654,0.254234,0.189373,0.0887508,0.00248504,0.0552309,-0.0491221,0.0840133,0.0845333,-0.0302248,-0.153406,-0.0210581,0.0425102,0.186238,0.151594,0.0592059,-0.079931,0.0384562,-0.0386074},{0.236379,-0.0189899,-0.0109544,-0.0930733,-0.0852763,0.186979,0.204556,0.151775,0.14153,0.105814,0.25634,0.346152,0.326793,0.133488,0.158578,-0.000659848,0.253245,0.235701,0.401717,0.385337,0.127609,-0.0532238,0.00760957,0.0124262,-0.0324014,-0.0827886},{0.114428,-0.0187092,-0.04331,-0.0553937,0.11212,0.133344,0.313536,0.209404,0.227039,-0.0178249,-0.0408592,-0.137188,-0.031121,-0.00147488,0.07087,0.224058,0.159785,0.134101,-0.131313,-0.164425,-0.209387,-0.137965,-0.124217,-0.0231718,-0.0866725,0.0138116},{0.393965,0.0698497,0.0123864,-0.0272799,0.0680862,0.130236,0.171477,0.105469,0.019233,0.000974982,0.0354361,0.194334,0.128461,-0.062427,-0.10017,-0.0721082,-0.138931,0.0625611,0.156083,0.159544,-0.038832,-0.0490987,0.00258638,-0.0714042,0.00968996,-0.00155254},{0.181048,-0.000943391,-0.0446429,-0.0535953,0.0542326,-0.187009,-0.20413,-0.186701,-0.15196,-0.164114,-0.136951,-0.156049,-0.13043,-0.133194,-0.0204997,-0.0542421,-0.110576,-0.102933,-0.18811,-0.255529,-0.218701,-0.00721303,0.0383294,0.0078002,-0.0438573,-0.0713638},{0.421897,-0.0142143,0.0995087,0.01985,0.0549385,0.0197586,0.138064,-0.0336191,-0.0324209,0.139076,0.136217,0.119365,0.0259869,0.0885853,0.0640522,0.0994671,0.148843,-0.055086,0.0190478,-0.0194259,0.0158564,0.0925699,0.116576,0.020836,0.0519466,-0.108187},{0.290466,-0.0414029,0.0389537,-0.0200247,0.0497034,0.0600294,-0.0535687,-0.253906,-0.0721041,-0.1049,-0.172605,-0.329304,-0.36267,-0.460414,-0.355455,-0.235806,-0.158757,-0.0863054,0.181852,-0.0133386,-0.0349211,0.00269458,0.00186522,0.000697216,0.0284936,-0.0610815},{0.188554,0.0261195,-0.0319793,-0.0279496,-0.123262,0.241193,0.188021,0.144162,0.050658,0.0504525,0.274771,0.406793,0.315767,0.262083,0.371964,0.564448,0.576068,0.384205,0.49975,0.473588,0.172952,-0.0290511,-0.0652435,-0.0881453,-0.235911,-0.0350534},{0.165727,-0.0236219,-0.0117964,-0.112157,-0.201148,-0.170657,-0.115215,0.137457,0.144039,-0.0116655,0.126646,0.087074,0.172571,0.247528,0.169667,0.0931504,0.0908979,-0.150398,-0.282338,-0.0279998,0.144969,0.154027,-0.048265,0.0262106,0.132248,0.106612},{0.165675,0.0771257,0.0320089,-0.00838271,0.0936571,0.169296,0.0293616,0.143827,0.0968084,0.321266,0.377083,0.208844,0.202006,-0.00356113,-0.0128891,0.162201,0.303881,0.412568,0.0633793,-0.204456,-0.276454,-0.0942427,0.104348,-0.0107387,-0.159592,-0.10864},{0.364642,0.0880949,-0.00158139,-0.029556,-0.0681317,0.105292,0.0771106,0.0592573,0.00708537,0.0856572,0.119065,0.111763,0.0348503,-0.0209697,0.132865,0.0434693,0.118743,0.159519,0.0937225,-0.0469602,-0.0308166,-0.158076,-0.0530143,-0.0221758,0.0540753,-0.0397644},{0.161716,0.0413069,0.0404624,-0.035138,-0.282283,-0.289054,-0.152976,0.00966313,0.0697568,0.294781,0.218561,0.195769,0.189632,0.0507538,-0.248892,-0.293887,-0.280555,0.0138156,0.284517,0.263071,0.346654,0.0606283,-0.153644,0.0401162,0.055724,0.118693},{0.121747,-0.0173958,-0.032072,0.0222723,0.0419412,0.152029,0.222509,0.279794,0.282276,0.0250947,-0.0589098,-0.324203,-0.209562,-0.240404,-0.0701255,0.0501769,0.0306576,-0.00562384,0.163999,0.228054,0.154056,0.152424,0.0261657,-0.0629702,-0.197553,-0.0404141},{0.333528,-0.011356,-0.00146953,0.00692661,-0.15558,-0.153897,0.0521662,0.0541711,-0.0128945,0.03054,0.258327,0.391319,0.436537,0.3725,0.305565,0.300318,0.13566,0.504435,0.485591,0.475339,0.077813,-0.0935497,0.0217988,-0.0337781,-0.184537,-0.0480164},{0.149497,0.0979434,0.0657576,0.0108307,0.094688,0.193635,0.193395,0.266096,0.00929123,0.0382141,0.0741616,-0.020975,0.0697101,-0.0200896,0.0711726,0.0391769,0.226298,0.0288631,0.0944254,0.189669,0.198422,0.101212,0.164851,0.0305266,0.069427,-0.0265052},{0.22101,0.0571612,0.124172,-0.0775615,-0.123041,-0.0190856,-0.0352478,-0.0462648,-0.104604,-0.163178,-0.000885382,0.21903,0.126879,0.200289,0.245038,0.0304648,-0.157316,-0.0316944,0.0991295,0.0964837,0.182152,0.0686907,0.0821425,0.161239,0.0305053,0.0157371},{0.266653,-0.0274058,-0.00282455,-0.111351,-0.0517294,0.167098,0.377272,0.32184,0.2675,0.21869,-0.0726429,0.101953,0.240366,0.19729,0.246089,0.15069,0.108529,0.324582,0.132545,0.170858,0.0837889,0.120294,0.0130927,-0.0702929,-0.0948494,-0.0655607},{0.36557,0.0119008,0.0431346,-0.0508056,-0.0227555,0.203363,0.23717,0.18394,0.0215348,-0.0850074,0.1525,0.232086,0.291343,0.0866848,0.176268,0.196444,0.128705,0.229677,0.309639,0.155841,-0.00218292,-0.0686491,0.080285,0.128484,-0.107777,-0.0427228},{0.246626,0.0672136,-0.00341907,0.00291073,-0.10591,-0.154077,-0.171908,-0.0595398,-0.108378,-0.171226,-0.131404,0.0167143,0.224919,-0.0491527,-0.0321104,-0.194687,-0.209475,-0.200594,-0.0875695,-0.00901841,0.154665,0.250912,0.202458,0.0180682,0.116833,-0.0371736},{0.342682,0.000931092,-0.0472689,0.0586157,-0.0400674,0.115058,0.142141,0.194321,0.0855017,0.0590133,0.142165,0.106137,0.084457,0.0697286,0.125251,0.169539,0.0934779,0.0940553,0.268645,0.399373,0.17097,0.103685,0.0930555,0.0772137,-0.0821233,-0.0250975},{0.164805,0.00654603,0.0900772,0.0478289,0.193727,0.034005,0.132822,0.148372,0.0336748,-0.0114003,-0.111611,-0.0838195,0.0840272,0.0935518,0.0599593,-0.0604811,0.0583908,0.0186431,-0.0220076,0.00501857,0.154604,0.281559,0.0957195,0.149218,0.0199143,-0.0462873},{0.234031,-0.00217301,-0.0571951,-0.0326527,0.0435762,0.0114828,0.0265088,0.0254924,-0.150186,-0.09207,0.247536,0.590448,0.583098,0.246054,0.0241955,0.140556,0.213215,0.401555,0.200876,0.0123836,-0.152528,0.0509787,0.12241,0.198293,-0.0707954,0.0719578},{0.461687,-0.00575573,-0.0138145,0.0869915,0.0760872,-0.177302,-0.144364,-0.0937891,-0.105215,-0.120919,-0.0667409,-0.0986541,-0.238804,-0.258022,-0.09719,-0.10951,-0.222977,-0.306762,-0.21832,-0.0894787,0.0942331,0.086461,0.120994,0.141753,-0.000277589,0.0363796},{0.233732,-0.0225799,-0.0526461,0.0911195,0.0324324,0.0091305,0.0110258,0.026036,-0.239319,-0.256154,-0.239962,-0.205305,-0.00877504,0.0183868,0.0273752,0.0921105,0.113385,0.244215,-0.0183038,-0.0182454,-0.0139557,0.0683539,0.0505473,0.0770233,0.00456118,0.0732581},{0.23652,-0.0926639,-0.0587461,-0.0203377,0.0287541,0.0105696,0.167302,0.148674,0.191934,0.413629,0.497025,0.523282,0.365915,0.183701,0.0257964,-0.11102,-0.222715,-0.265513,-0.0434289,-0.0663614,-0.0852345,-0.0379273,0.146124,0.00955363,0.113137,0.0076573},{0.335217,0.0321936,0.040406,-0.0423064,-0.158149,-0.181719,-0.146939,-0.0617418,0.0715778,0.332547,0.452102,0.210562,0.0491421,-0.146013,-0.271996,-0.161425,-0.071952,0.0251562,0.010171,0.186512,0.157649,0.00903709,0.0431076,-0.00479213,-0.0748119,0.0362398},{0.415694,0.00422626,0.00305855,-0.0693662,-0.0909285,0.0519961,0.23223,0.158465,0.0901322,0.110954,0.0912375,0.0294812,0.0691781,0.106726,-0.0228403,0.00942018,-0.0367332,0.106508,0.152054,0.158926,0.22517,0.0579078,-0.112241,-0.236141,-0.328994,-0.115691},{0.355786,0.00124556,0.0119725,-0.014202,0.109042,0.0868636,0.058417,-0.0705278,-0.16783,-0.0528674,-0.097098,-0.0206233,-0.0221064,0.0534949,0.124702,-0.0711148,-0.185377,-0.115974,0.0263818,-0.00827079,0.0321314,0.0542881,0.0892309,-0.0552694,-0.074326,-0.128653},{0.373891,0.0134508,0.111808,0.0119206,0.0327037,0.0721251,0.133288,0.195433,0.0385128,0.0868887,0.13898,0.157972,0.0360876,0.0627147,0.0844187,0.0201911,-0.0123616,-0.051236,-0.141128,-0.147738,-0.0682962,0.107936,-0.00698225,0.11787,0.045711,0.0348193},{0.293936,-0.0495804,-0.0381233,-0.0351438,-0.0796568,0.0604748,0.166592,0.143862,0.126586,0.260579,0.517856,0.599036,0.368563,0.0207189,-0.0947582,-0.0305582,0.0613064,0.0774993,0.143124,0.206165,0.0869663,-0.0366796,-0.0760711,0.0704073,-0.0266642,0.0408302},{0.230881,0.0157564,-0.0553119,-0.00147578,0.0138556,-0.101735,-0.242406,-0.18197,-0.0981936,-0.0936717,-0.183774,-0.189294,-0.104509,-0.170515,-0.401696,-0.42807,-0.143777,-0.273318,-0.244946,-0.075152,0.0855767,0.210019,0.155703,0.153368,0.0769647,0.0718013},{0.371556,0.119542,0.0760079,0.0298663,0.176939,0.19443,0.0204218,0.0586235,-0.234413,-0.0875982,-0.0137557,-0.129467,-0.257056,-0.246682,-0.142933,-0.0238452,0.17458,0.261022,0.496123,0.455381,0.398206,0.186476,0.0637925,0.11536,0.171228,0.0329585},{0.163641,0.03234,0.0699311,0.023024,-0.0335554,-0.129769,0.0209266,0.00946362,0.111133,0.203695,0.259147,0.178518,0.22678,-0.0060855,0.0552643,0.238017,0.14933,0.0582551,0.113152,0.147434,0.119704,0.01967,0.0559138,0.0169763,-0.0915571,-0.0676663},{0.016543,-0.0617503,-0.0491125,0.00928752,-0.0696113,0.314156,0.427199,0.384157,0.295995,0.348969,0.322375,0.18846,0.14643,0.0161151,-0.0257081,-0.23718,-0.234284,0.0953295,0.0914975,0.0809913,0.0668821,0.0666132,0.0816588,-0.0676739,-0.123178,-0.0597522},{0.293601,0.0560955,-0.0675122,-0.157394,-0.075633,0.0568932,0.24474,0.0753639,0.058981,-0.126471,0.122207,0.194953,0.0827694,0.260358,0.177423,0.188367,0.122469,0.273154,0.352696,0.186437,0.11487,-0.029569,0.0646812,0.109867,-0.00563291,-0.0524484},{0.40838,0.0667552,0.0163165,0.00667274,0.0628915,0.174317,0.0764367,0.0570943,0.130014,0.155769,0.15036,0.0707769,0.140052,0.108895,0.0538859,-0.00157187,-0.0649257,0.0298555,0.0186024,-0.119114,0.0794251,0.0244386,-0.0439796,-0.10558,-0.0784966,0.0557444},{0.418331,0.017117,-0.0243246,-0.0383175,0.0764424,0.0692538,0.115393,0.133815,-0.177637,-0.421654,-0.331131,-0.235709,-0.0339366,0.233085,0.196266,0.146807,-0.256514,-0.108336,0.374881,0.493146,0.397618,0.121077,-0.279359,-0.227289,-0.0371937,0.0340086},{0.313129,0.0762786,-0.0804396,0.0979224,-0.0315436,-0.169716,-0.1382,-0.335711,-0.00192933,0.0722244,0.216255,0.191507,0.192306,0.135452,0.0369665,0.032978,0.0158665,0.110572,0.103136,0.0665659,0.106566,-0.0334342,0.120164,0.0320908,0.0521175,-0.0492333},{0.475983,-0.0261262,-0.0333938,0.0563562,0.0622816,-0.0453519,-0.0414741,-0.193748,-0.165241,-0.214577,0.0221314,0.0763382,0.0715188,0.00119267,0.128077,0.13227,0.224677,0.116225,0.0488742,-0.0374956,-0.0218948,-0.28083,-0.209793,-0.130606,0.052595,0.0465158},{0.442393,0.0452254,0.0601398,0.0865996,0.146387,0.135255,0.159374,0.202675,0.198637,0.0507848,-0.0652525,-0.070967,0.252393,0.472559,0.356429,0.204327,-0.0708363,-0.125481,-0.170275,0.0139511,0.147733,0.0039824,-0.194603,-0.124855,-0.116765,-0.0540852},{0.341839,0.0771793,-0.0588875,-0.0320416,0.117829,0.14306,0.15506,-0.0910115,-0.0938047,0.202382,0.193357,0.0920596,0.0433085,0.0184476,-0.104803,-0.0621621,-0.0285779,-0.119816,-0.0714184,-0.0929998,-0.293916,-0.243603,-0.171154,-0.173355,-0.0666486,-0.0436467},{0.329771,0.0845684,-0.0564714,-0.161287,-0.316113,-0.0977166,0.118198,0.283998,0.295215,0.186657,-0.00220153,0.00429839,0.0249186,-0.00209033,0.165848,0.0505344,-0.023978,0.0910454,0.142341,0.118694,0.13132,-0.0641267,-0.257018,-0.158592,-0.0627613,6.45246e-05},{0.266778,0.0501177,0.0377221,-0.0880426,-0.031042,-0.0665331,-0.105836,-0.108868,-0.00622384,0.012424,-0.113096,-0.205148,-0.0718877,0.208649,0.295308,0.176297,0.00499817,-0.0830502,-0.0697327,0.149221,0.110748,0.0382251,0.0494246,0.0388142,0.0549651,-0.0464783},{0.306205,0.122039,0.008523,-0.024189,-0.156282,-0.00237992,-0.0670879,-0.0293679,-0.0211462,0.0287238,0.302923,0.290137,0.195765,0.241169,0.0152396,-0.0847118,-0.147645,0.113433,0.249562,0.423674,0.36224,0.165569,0.0510917,0.0225429,-0.0388946,-0.194336},{0.347518,0.0833656,-0.0213028,-0.0348553,-0.0740797,0.102234,0.334316,0.335145,0.22629,0.336532,0.316512,0.332798,0.133483,0.229988,-0.0145239,-0.106224,-0.0965133,0.214248,0.381537,0.318668,0.268334,-0.0714095,-0.0326323,-0.100949,-0.0547778,-0.0520679},{0.216528,0.10734,-0.0221895,0.0602555,0.0481507,0.123772,0.010925,-0.0501084,-0.25871,-0.0463695,0.130666,0.0843613,-0.0459924,-0.154475,-0.17991,-0.129261,-0.129148,0.047145,0.0259001,-0.0681172,-0.126089,-0.171662,-0.114039,-0.0316431,-0.0660059,-0.105829},{0.221386,-0.015599,-0.07904,-0.149113,-0.100471,0.14643,0.357964,0.2863,0.254437,0.160094,-0.0121318,-0.028132,0.242533,0.162817,-0.00311035,0.0656877,0.0483474,0.136172,0.101224,0.144036,0.0282122,-0.151685,-0.10584,-0.0359498,-0.0500819,-0.0861194},{0.240809,-0.0395856,0.00293978,0.10629,-0.128676,-0.123216,-0.060008,0.120752,0.341612,0.536253,0.41169,-0.169493,-0.473171,-0.290628,-0.0694571,0.288058,0.492205,0.309791,-0.471295,-0.699415,-0.284649,0.0260153,0.186803,0.015243,0.00651028,-0.0208293},{0.159204,0.11288,0.0750272,-0.00982194,0.0200838,-0.0676864,-0.119616,-0.0987408,0.0822526,0.208313,-0.0107045,-0.103191,-0.0285275,-0.00499486,0.0517757,0.13543,-0.117581,-0.189757,-0.111223,-0.18923,-0.0842526,-0.182851,-0.19786,-0.140202,-0.223437,0.0257322},{0.371492,-0.0579596,0.0906987,-0.0230742,0.00583107,-0.0956372,-0.186011,-0.196564,-0.178387,-0.0713495,0.00621609,-0.0377697,0.0744063,0.123537,0.05068,-0.0110127,0.0115216,-0.0365771,-0.0617328,0.00228253,0.0457748,0.0870828,0.204191,0.154125,0.0817533,-0.0419441},{0.244957,-0.0291409,-0.047137,-0.0111316,-0.0688541,-0.0877669,-0.0639684,0.0840343,0.131284,0.123806,0.165236,0.2093,0.218395,0.213303,0.0651282,0.0947543,0.0892604,-0.0218558,0.00473013,0.0558552,0.16756,0.119646,-0.0189765,0.0585474,0.00689157,0.0116103},{0.442397,-0.000775334,0.0244726,-0.0733753,-0.0605712,0.138967,0.0508676,0.0112674,-0.0338689,0.137271,0.203617,0.106798,0.175057,0.0222892,0.0902949,0.026227,0.147323,-0.055636,-0.067465,-0.048352,-0.0129644,0.0722167,0.161288,0.0243787,0.0335315,0.01797},{0.401169,0.0234315,0.057507,-0.0279473,0.00524527,-0.0173107,0.0112515,-0.0568849,-0.043996,-0.0253174,-0.00592096,0.126076,0.0445225,0.0114965,0.0611526,-0.0805854,0.0280337,-0.0615578,0.119228,0.15632,0.101376,-0.0123702,-0.0820231,0.105186,-0.0182037,-0.0620279},{0.384037,0.0462116,-0.120368,-0.0121978,0.0327557,-0.0374855,0.0325219,-0.0671476,-0.0352202,0.0646366,-0.0635691,0.0286345,-0.195753,-0.0373434,-0.0330064,-0.141862,-0.0213634,-0.150031,0.0966268,0.026923,-0.166967,0.00853149,-0.0246019,0.0345425,-0.0247249,-0.0635297},{0.261588,0.0659396,0.0117449,0.0805722,0.0260287,0.192399,0.272083,0.215688,-0.0698897,0.0401695,-0.0301378,0.0296974,0.00407634,0.0884173,0.0117748,0.0629018,0.069732,0.136968,0.084923,0.0341497,-0.0428088,-0.241874,-0.313858,-0.264565,-0.0712056,-0.0413825},{0.249208,-0.0350757,0.067277,0.101242,0.0592909,0.00850635,-0.166405,-0.0725338,0.413208,0.561552,0.131856,-0.0835827,-0.245127,-0.118469,-0.194089,-0.0457483,-0.0972236,-0.155625,-0.246913,-0.264156,-0.211709,-0.100089,-0.103091,-0.095568,0.0540373,-0.0495126},{0.22588,0.0919864,0.0416754,0.0328093,-0.0998073,0.174153,0.338681,0.440324,0.370297,0.311552,0.305845,0.183044,0.229698,0.0936028,0.112982,0.113313,0.23746,0.433872,0.532902,0.418043,0.151641,-0.0123518,-0.0446989,-0.232953,-0.209366,-0.0481025},{0.202067,0.0562507,-0.0189278,-0.00685983,0.0456155,0.212363,0.353205,0.33083,0.304576,0.309887,0.205753,0.0725193,0.176776,0.264406,0.144087,0.0956061,0.192496,0.319481,0.249664,0.140971,0.0626818,-0.0925932,-0.137212,-0.149036,-0.104924,0.0346005},{0.182994,0.103311,0.0024492,-0.0548293,-0.150977,0.1343,0.057095,0.0414302,-0.0584626,0.0649538,0.110992,0.138245,0.297362,0.261,0.203403,0.140521,0.196337,0.341472,0.372706,0.325641,0.186825,-0.0496519,-0.106169,-0.0115814,-0.094116,-0.00681439},{0.36289,0.0227298,0.0635106,-0.034582,-0.0192936,0.20556,0.157213,0.102839,0.107057,0.116406,0.205395,0.313652,0.239068,0.0734041,-0.0675952,0.0562172,-0.00739979,0.18418,0.0603191,-0.135788,-0.353134,-0.273171,-0.212084,-0.0471283,0.015395,0.073752},{0.160032,-0.000569866,0.124742,-0.0539879,0.126104,0.203187,0.0764741,0.0801576,-0.136508,-0.274955,-0.111762,-0.152513,-0.231756,-0.421049,-0.439699,-0.258649,-0.113403,-0.177454,-0.218643,-0.0827172,-0.161826,-0.0894481,-0.118496,-0.0745947,-0.0573894,0.0150605},{0.355089,0.0754418,0.0104326,-0.095609,-0.0501341,0.179754,0.229245,0.190124,0.19425,0.186156,0.227653,0.364833,0.282204,0.0327863,-0.0346584,0.0523571,0.00806278,0.126521,0.399185,0.43078,0.332787,0.105964,0.0928741,0.118187,-0.133244,-0.118969},{0.241388,-0.0437482,-0.0559262,-0.0662809,0.00462611,0.172572,0.280006,0.344545,0.36778,0.139388,0.0456148,0.114383,0.133809,0.156471,0.0177546,0.0032501,0.118594,0.300687,0.38295,0.288808,0.150492,-0.108778,-0.0929355,-0.056696,-0.255603,-0.0995351},{0.367969,0.0835429,0.0366616,-0.00667086,0.176645,0.124119,0.0876156,0.167436,0.4584,0.444775,0.0916525,-0.0924521,0.0206465,0.117607,-0.0443871,-0.291852,-0.194429,-0.0314055,0.0415242,0.193958,0.106548,-0.0212714,-0.280791,-0.236065,0.0432417,0.0759162},{0.281901,0.0158708,-0.0442046,0.0644933,-0.0418131,-0.090341,-0.0890356,-0.121439,0.0935425,0.32674,0.424742,0.344717,0.267837,-0.143977,-0.187928,-0.0816876,0.0545382,0.079482,0.0788302,0.0748478,-0.117176,0.00184275,0.106657,0.00815635,0.058826,-0.0134426},{0.126191,-0.115271,-0.0440355,-0.0244442,0.0822793,0.322611,0.305903,0.43437,0.303361,0.249241,-0.15298,-0.0856644,-0.172978,0.0476449,0.0302587,-0.089529,-0.0324081,-0.118028,0.0630077,0.0944964,0.132086,0.0457215,-0.100894,-0.0105597,-0.0708483,0.0031155},{0.273075,0.106957,-0.0131422,0.100842,-0.0290853,0.125234,0.0260244,0.173384,0.104255,0.224769,0.149817,0.230873,0.0381197,-0.00872154,-0.0174883,-0.018102,0.0477796,0.135299,0.15462,0.034216,-0.133733,-0.176677,-0.180441,-0.197572,-0.0174821,-0.0297612},{0.370227,0.0209884,0.0323281,0.0666162,-0.0273364,-0.00498402,-0.0685966,-0.0130047,-0.210714,-0.031917,0.1433,0.201288,0.108765,0.0494664,-0.112132,-0.086427,-0.00217358,0.0487029,0.0285142,-0.0615646,-0.051384,0.104778,0.0405023,0.145918,0.071797,-0.0532181},{0.0522296,-0.02854,-0.0719443,-0.078096,-0.0779619,0.0410499,-0.0235645,-0.00165277,0.000570816,0.0531763,0.0718638,-0.0764454,0.0038885,0.0627177,0.0994286,0.0985961,0.015984,0.0288779,-0.0941472,-0.109406,-0.0254743,0.121544,0.0213973,0.0836062,-0.0134905,0.0263024},{0.45117,-0.0423088,0.0506306,-0.12632,0.0119617,0.0324373,0.165171,0.0958005,0.0741609,-0.122943,-0.220923,-0.191633,-0.234911,-0.0323145,0.0715289,0.310989,0.378262,0.330025,0.522291,0.434444,0.290404,0.0183172,-0.210352,-0.269562,-0.179631,-0.0336599},{0.244821,0.0279076,-0.0509951,-0.0254915,0.0930921,0.198441,0.337813,0.184732,0.074024,0.000218097,0.183276,0.120267,0.163886,0.0906551,0.0383147,0.0955176,0.0839591,0.162351,0.179317,0.216847,0.195891,0.0926987,-0.0206577,0.00607144,-0.113177,-0.0160891},{0.223569,-0.0208777,0.0205081,0.0439546,0.0533166,0.0997535,0.0801053,0.0136967,0.0766226,0.021807,-0.0348377,-0.0894573,-0.0937895,0.0848375,0.31411,0.511558,0.498596,0.830506,0.872268,0.691858,0.457917,0.0373698,-0.250099,-0.254679,-0.209262,-0.115575},{0.252912,-0.0223966,0.0409104,-0.0154302,0.123807,0.127208,-0.140406,-0.225717,-0.289753,-0.0443195,0.0315928,-0.0312367,0.147931,0.134595,0.0351766,0.157149,0.181975,0.237083,0.319154,0.137439,0.065161,0.0184197,0.0581791,-0.00401973,-0.0526308,0.0638549},{0.192225,0.0746958,-0.00190692,-0.0433494,0.0328694,0.0485157,0.172108,0.0536315,-0.0414389,0.00565729,0.220962,0.144574,0.169376,0.225704,0.229798,0.164686,0.0897017,0.0944903,0.122357,0.120721,0.0403299,0.0774283,0.128539,0.016276,-0.0413406,0.0465335},{0.154049,0.0562911,0.0438313,0.0191145,-0.155996,0.0564082,0.00213009,-0.0178492,-0.113601,0.0346294,0.31857,0.260591,0.140893,0.159952,0.262581,0.265612,0.0553294,0.202367,0.163441,0.256643,0.074609,0.0320139,0.0968068,0.0473036,-0.17179,-0.116826}};
+static DTYPE_WEIGHTS_WCI_bw WCI_bw_in[NUMBER_OF_NEURONS][NUMBER_OF_INPUTS_NONRECURRENT] = {{0.404856,0.0257534,-0.0013937,0.0199903,-0.0408319,-0.167155,-0.155696,-0.0745574,-0.0436031,0.173045,0.642907,0.8794,0.890473,0.523976,-0.121778,-0.131914,0.259179,0.239713,0.349565,0.0818841,0.0212233,-0.0697419,-0.224856,-0.193818,0.110051,0.0346995},{-0.254312,0.00297438,-0.0385595,0.0538995,0.202617,0.302559,0.235905,0.234882,0.161121,-0.0861945,-0.252962,-0.216792,-0.307912,-0.410774,-0.575258,-0.625454,-0.571294,-0.215304,-0.0231066,-0.170343,-0.176617,-0.029652,0.0675221,0.0747399,-0.00417945,0.000930749},{-0.308904,-0.0509295,-0.0544507,-0.0172249,-0.0119342,0.0575981,-0.0345141,-0.298241,-0.687786,-0.260617,0.351423,0.390644,0.404782,0.607513,0.703397,0.31263,0.306915,0.0801664,-0.194247,-0.249149,-0.103304,0.146016,0.212986,-0.0572663,0.0861008,-0.0279113},{-0.124788,0.0459699,-0.0376334,-0.00327692,-0.168065,0.0187236,0.0732418,0.0190856,0.148121,0.119822,0.116437,0.283894,0.31413,0.548653,0.467742,0.573777,0.424966,0.128739,-0.0851201,-0.169374,-0.0045133,0.0150582,-0.0230954,-0.0365198,0.0346254,-0.0744785},{0.146165,0.0904733,0.118841,0.0564825,-0.0613544,-0.111161,-0.244948,-0.19981,0.0445422,0.0953417,0.455992,0.362309,-0.0680457,-0.353597,-0.193869,-0.680818,-0.969351,-0.145545,0.303956,0.319731,0.294935,0.0584022,-0.0580584,0.0607308,-0.021566,0.0105337},{-0.329378,-0.0314095,0.0908515,-0.0784979,-0.0864759,-0.130235,-0.00317078,0.0216485,0.229141,0.364088,0.00191607,-0.261202,-0.146657,-0.123783,0.182021,0.340729,0.428493,0.0363817,-0.369443,-0.19053,-0.0513633,-0.0508304,0.053543,0.0711648,-0.0922334,-0.0631116},{-0.300406,0.0801876,-0.0418427,-0.0698652,-0.0785052,0.0389752,0.0740707,-0.0310823,-0.137883,-0.0355174,-0.210806,-0.308162,-0.422813,-0.154916,0.444983,0.5485,0.208961,-0.170856,0.123983,0.186663,0.160437,0.41869,0.398382,0.0695128,-0.0937829,0.0235989},{-0.114647,0.0392049,-0.0670826,0.0519418,-0.0642196,-0.0319263,-0.140515,-0.0379182,0.150694,0.181471,-0.0383288,-0.322838,-0.179065,-0.0956014,0.226062,0.517979,0.616,0.34438,0.0288891,0.163675,0.0647143,-0.0432472,-0.154822,-0.0583064,0.112719,0.0795636},{-0.374302,0.0453468,-0.0107528,0.115167,0.121141,-0.0834123,-0.0166131,-0.043749,-0.0130885,-0.0169909,0.110793,-0.0576092,0.0363642,0.111596,0.121204,0.0615945,-0.00326031,-0.0250106,-0.0680843,0.00930578,-0.132021,0.000960866,-0.0506521,0.0782934,0.0496856,0.0081923},{-0.0829125,0.0515953,-0.0868994,-0.0155078,-0.0309533,0.0857622,0.0460264,0.028659,-0.0662956,-0.00178672,-0.019405,-0.130737,-0.10455,-0.0917306,0.415918,0.484189,-0.213826,-1.04214,-0.561948,-0.239419,-0.0782101,0.321291,0.276317,-0.0202566,0.0073131,-0.0518055},{0.39885,0.121065,0.00727367,-0.0163652,-0.0559307,0.0117987,-0.252828,0.0132741,0.0559043,0.275891,1.365,1.31932,1.52547,0.736878,-0.518619,-0.735465,-0.182262,-0.329109,-0.469304,-0.342041,-0.151702,-0.222213,-0.069251,0.0525132,0.12531,0.0368332},{-0.389062,0.0236566,-0.0356978,-0.0351849,-0.0770607,0.0431371,0.165505,0.0591611,0.0847928,0.14935,0.494002,0.664888,0.657974,0.282973,-0.0700523,0.0700347,0.0889669,0.198641,0.460142,0.326809,0.0829117,-0.0618296,0.0424569,-0.119555,-0.106304,0.0361907},{0.422208,-0.0461805,-0.0537375,-0.0138832,0.0770631,0.0716689,-0.141452,-0.140556,-0.147977,-0.924171,-0.575267,0.199354,0.56812,0.430795,0.312173,0.294787,0.0184353,-0.129976,-0.0353637,0.0441242,-0.0371542,0.055865,0.028125,0.0618247,-0.0544889,-0.0258229},{0.128077,-0.00653336,0.0262896,-0.106088,-0.101805,-0.0120151,-0.00204876,0.110993,0.199866,0.155562,0.138107,0.00556228,-0.0652712,-0.175263,-0.159299,0.0752022,0.542025,0.730912,0.798267,0.809989,0.422688,0.101257,-0.0359476,-0.144347,-0.114899,0.0463893},{-0.105489,-0.0332408,0.0145188,0.00491777,0.144268,0.0383101,0.0947341,-0.0225524,-0.135159,-0.347818,-0.804236,-0.790277,-0.543848,0.63293,1.18965,0.946081,0.346345,0.137263,0.283653,0.0841536,-0.0521048,-0.0367443,-0.160535,-0.117454,-0.0506029,-0.0313496},{-0.610937,-0.00965301,-0.0423494,-0.0868431,-0.107179,0.126823,0.0402615,-0.0307787,-0.343085,-0.182101,0.719198,1.04946,0.913458,0.701598,-0.0573402,-0.232504,0.169303,0.635119,0.472097,0.391441,0.225052,-0.0682333,0.0409673,-0.0509496,-0.0848894,0.00653586},{0.0154133,-0.0259621,0.0640694,-0.233398,-0.104907,-0.00487622,0.102054,0.111535,0.140797,0.219579,0.0709423,-0.0303988,-0.000552722,0.169786,0.246985,0.341524,0.448598,0.722023,0.722299,0.532431,0.298557,0.012045,-0.0821659,-0.0425246,-0.0858845,0.0166354},{0.504736,-0.0526271,0.00169149,-0.0156273,0.0963241,0.0233071,-0.0636712,0.14941,0.06472,-0.077959,-0.0801813,-0.132687,-0.0673717,-0.261183,-0.400714,-0.453554,-0.28,0.00747745,-0.244679,-0.214943,0.122787,-0.19626,-0.0572504,0.0385869,-0.0410707,0.0456844},{0.603273,0.0417815,0.0559154,-0.00796118,-0.0869827,0.090745,0.220485,0.110319,-0.0304649,-0.247452,-0.13441,0.0674869,0.20238,0.210534,0.345101,0.162634,-0.197266,-0.184218,0.142531,0.0931537,0.303958,0.191769,0.162907,-0.031757,0.0312687,-0.0983194},{-0.345888,-0.156992,-0.106078,-0.0804092,-0.085525,-0.106502,0.0399233,-0.0870977,-0.187356,-0.0252814,-0.0768544,0.0706618,0.112912,0.0109106,0.150916,0.0906977,0.11399,0.0716174,0.00982199,0.0286451,0.0516821,0.181765,0.162452,0.122894,-0.057073,-0.0405893},{0.431432,-0.0849409,-0.0219475,-0.0281387,0.0961718,0.278571,0.313755,0.136393,-0.271219,-0.45735,-0.449761,-0.563256,-0.637741,-0.48357,-0.161333,-0.0977738,0.0554734,-0.152532,-0.349578,-0.241612,-0.0852138,0.121692,0.162514,0.134899,0.077142,0.0527269},{0.345903,0.00373421,-0.0353215,0.0402357,-0.0551343,0.0611951,0.102144,0.0945218,0.0868608,-0.0729217,-0.0820249,-0.0188975,0.0239323,-0.114139,0.00893864,0.0366539,-0.0628217,-0.0798071,-0.0677298,0.0536558,-0.0208491,0.0416994,-0.0626913,-0.130187,-0.0568494,-0.0819507},{0.0881772,0.0341491,0.00460322,0.101221,-0.0416046,-0.049851,-0.143656,-0.178058,-0.178644,-0.381451,-0.457722,-0.356411,-0.0625407,0.249495,0.539561,0.489568,0.0625228,-0.3074,-0.300712,-0.25257,-0.0874334,0.0366843,0.00892548,-0.166111,-0.000418024,0.0159141},{-0.197252,0.000281936,-0.0370723,-0.00249735,0.0973302,0.331798,0.0719877,-0.578797,-0.936758,-0.40095,0.0147698,0.139883,0.566944,0.472272,-0.152778,-0.485326,0.142211,0.662669,0.277042,-0.044833,-0.168991,0.13095,0.167998,-0.241718,-0.157586,0.116013},{-0.222679,0.0561231,0.163136,0.0800651,-0.00701474,-0.13664,0.0302402,0.171572,0.200336,-0.0374164,-0.228924,-0.203955,-0.255712,-0.332667,-0.165784,-0.0153825,0.0438221,0.00202496,0.135666,-0.0727452,-0.167432,-0.184034,-0.0866342,-0.151496,-0.131271,0.00556787},{0.107452,-0.0711205,0.083724,-0.00364916,-0.155553,-0.073096,-0.0238619,0.0318343,-0.0658096,-0.274319,-0.0817878,0.0617362,0.118709,-0.169078,-0.084556,0.0890758,-0.00721052,-0.386921,-0.245188,0.0969126,-0.0689938,0.197919,0.212846,0.0846091,-0.00684444,-0.0131942},{0.318423,0.0189469,-0.00248717,0.0331328,0.0248489,-0.179447,-0.0322611,-0.305301,0.0287005,0.240773,-0.241494,-0.314331,-0.308087,-0.0496819,0.2084,0.312458,0.167634,0.110912,-0.0263575,-0.107497,-0.162357,0.0768804,0.0243362,-0.252817,-0.130996,0.0638129},{0.121239,0.08822,-0.0255765,-0.0694395,0.0165708,0.00672583,-0.0308365,-0.106744,0.0833414,0.488485,0.537242,0.123603,-0.185276,-0.229029,-0.202217,-0.31861,-0.590168,-0.685201,-0.236244,0.370253,0.530191,0.117859,0.0612049,-0.148925,-0.117522,0.0431392},{-0.136114,0.0330481,-0.0547051,-0.025913,-0.037488,0.0269377,0.078109,0.29873,0.0501407,-0.400055,-0.337073,-0.36076,-0.235933,-0.566768,-0.636038,-0.388839,-0.0773838,0.0737955,-0.107122,-0.0544649,-0.0612227,0.238744,0.181481,0.146836,-0.0466468,-0.0526057},{-0.755418,-0.0323119,-0.00156081,0.0853107,0.077163,-0.0658728,0.036228,0.00379899,-0.0845882,-0.1082,-0.121765,-0.024509,-0.0410775,-0.198807,-0.262171,-0.431328,-0.320552,-0.267002,-0.142604,-0.140156,-0.0791742,0.0475457,0.127447,-0.0258533,0.0624476,0.0491018},{-0.336839,0.0170271,0.00160071,-0.147438,-0.0434181,0.177545,0.289378,0.270316,0.249572,0.0676982,0.0610058,0.101032,0.159265,0.37197,0.145194,0.0140547,0.00511485,0.0180435,-0.0711819,-0.276406,-0.039115,-0.053753,-0.017397,-0.0616682,-0.113548,-0.00611533},{0.807231,-0.0605152,-0.0261758,-0.01931,-0.135174,0.13349,0.121559,0.0598757,-0.149569,-0.117642,0.122267,0.358924,0.430388,0.348017,0.313146,0.117187,0.146797,0.533752,0.604709,0.437678,0.290323,0.0733956,0.126846,-0.0539333,-0.0785533,-0.114727},{-0.295978,-0.0494719,-0.0367505,-0.0222759,-0.0762667,0.0856908,0.0447336,0.00597209,0.00976483,-0.255345,-0.119166,-0.0154796,-0.11653,0.0365057,0.295354,0.00289681,-0.141969,0.147116,0.218143,0.284388,0.284244,0.106335,-0.159222,-0.160013,0.00198788,-0.0139445},{-0.504211,0.00769502,0.0567386,0.0545465,0.0633404,0.086795,0.200391,0.105851,0.305526,-0.0700948,-0.351014,-0.369005,-0.0192333,0.0904931,0.163199,-0.183563,-0.221952,-0.0008305,0.136859,0.0987073,0.0602981,0.0910886,-0.224438,-0.132958,-0.0113766,-0.0611541},{-0.134487,-0.00134077,-0.0602286,0.0932674,0.0643498,-0.101279,-0.132409,-0.179167,-0.378895,-0.54995,-0.212433,-0.231471,-0.299452,0.208371,0.633677,0.849628,0.525558,0.303396,0.175458,0.106083,0.0609663,-0.562638,-0.50638,-0.0585221,0.153527,0.0133349},{0.0721643,-0.00777666,-0.0849404,-0.107147,-0.0429507,0.280606,0.144014,-0.0115474,0.128573,0.472501,0.427499,0.411576,0.305208,0.46469,0.262604,0.0874604,0.180213,0.161988,0.241741,0.35464,0.182949,-0.0266854,-0.267059,-0.031376,-0.0869373,0.030669},{-0.0145894,0.0075754,-0.0371843,0.0341882,0.154913,-0.288692,-0.376113,-0.434972,-0.318891,0.0634075,0.105767,0.365741,0.706332,0.957577,0.819434,0.0216329,0.0915177,-0.19797,-0.839595,-0.815979,-0.289932,0.0506288,0.00488025,0.10184,0.24623,-0.0345022},{0.311473,-0.0340632,0.0343751,0.163526,-0.00441643,-0.0679024,-0.118791,-0.16842,-0.292748,-0.407133,0.284139,0.611054,0.664524,0.301121,-0.275859,-0.448712,-0.396763,-0.184438,-0.284198,-0.433281,-0.211219,-0.149306,-0.193919,-0.217523,0.0839458,0.0187206},{-0.369983,-0.0258913,-0.0414292,-0.0619736,0.0229319,0.175705,0.197953,0.282627,0.123455,0.132972,0.0219512,0.0367822,0.08398,0.00854703,-0.0713452,0.0241926,-0.0099343,-0.108831,-0.118831,-0.0344127,-0.177564,-0.0471778,0.135335,0.192857,0.0996539,0.0315749},{-0.1987,-0.00614365,-0.0184863,0.0825037,0.0693294,-0.146846,-0.289189,-0.359381,-0.190184,0.330391,0.680715,0.519433,0.554829,0.436016,0.609117,0.450696,0.387218,0.0566487,-0.0166559,0.0415715,0.00815059,-0.0774906,-0.239336,-0.146747,-0.0460134,0.0846556},{-0.0604217,0.117588,0.0692435,-0.122897,-0.0182837,0.300694,0.367236,0.449446,0.484741,-0.0462129,0.0337611,0.106301,-0.0888598,-0.270588,-0.0550701,0.600046,0.712853,-0.129237,-0.455665,-0.328281,-0.412455,-0.322755,-0.033008,0.0220902,0.100365,-0.00194598},{0.120245,-0.0191971,0.00336026,-0.0747592,0.0732935,0.131093,0.172788,0.131596,0.119897,0.126625,0.333909,0.27673,-0.125865,-0.10787,0.294969,-0.184505,-0.752998,-0.504325,-0.129943,-0.0625085,-0.06558,-0.0643782,0.0277467,0.113545,0.00121166,-0.0296812},{0.127374,0.124262,0.0214532,-0.0553061,0.0181368,0.0279839,0.0163155,0.0814942,0.0411471,-0.117362,-0.253316,-0.29023,-0.22881,-0.164866,-0.109075,-0.13135,-0.185919,-0.0869754,-0.194093,-0.241793,-0.184089,-0.066407,-0.0307606,-0.0132148,-0.0230088,0.00111066},{-0.174139,0.00322435,-0.0236619,-0.112855,0.0168292,0.406656,0.36799,0.239944,0.161193,0.0498128,-0.0319355,-0.0899674,-0.0518189,-0.0858504,0.0413713,0.0142012,0.087873,0.186836,-0.0145924,-0.0888972,0.0289803,0.206366,0.0119304,0.0768987,-0.16559,-0.0251601},{0.310804,0.0679183,0.0582559,0.0778498,-0.0129647,-0.0386827,-0.115196,-0.189331,-0.164918,-0.246123,-0.456546,-0.497462,-0.359664,0.720649,1.08754,0.0462652,-0.219332,-0.18689,-0.338683,-0.535359,-0.17034,-0.0268609,-0.212049,-0.192015,0.0627717,0.0165424},{0.445574,0.0192412,-0.0171086,0.0330208,0.10283,-0.150365,-0.282792,-0.49388,-0.563891,-0.189878,0.0387615,-0.313307,-0.221982,-0.103704,-0.293074,-0.292253,-0.151049,-0.167741,-0.0151856,-0.0982982,0.268487,0.237708,0.128069,0.0888055,-0.0151852,0.0841832},{-0.285547,0.0120276,-0.00294896,0.0214997,0.0492691,0.030999,0.0481885,-0.260552,-0.356517,0.127888,0.0845958,0.148515,0.0512154,-0.0159817,-0.0742982,-0.0561537,0.294914,0.292637,0.3198,0.249693,0.0156837,0.186937,0.0275199,-0.0245244,-0.0715364,-0.0199673},{0.44894,0.0050096,0.077587,0.0696054,0.0477553,-0.0391215,0.184795,0.277157,0.196157,-0.404467,-0.902267,-1.03523,-1.0971,-0.668323,0.0331129,0.23654,-0.0220152,-0.589827,-0.819557,-0.555251,-0.255963,-0.0399183,0.0615262,0.128978,0.0959282,0.0034107},{0.26778,0.0145698,0.0692008,0.05911,0.111063,0.0406875,-0.169717,-0.155209,-0.250733,-0.328946,-0.192133,-0.221346,-0.100613,-0.0584446,-0.27953,-0.317507,0.0410929,-0.0771879,-0.108653,-0.253349,-0.0792091,-0.0341044,-0.314221,-0.07969,0.0761069,-0.0223532},{0.338314,-0.0117387,0.0249319,-0.184625,0.00652341,0.260274,0.119185,0.052585,-0.100672,0.0906632,-0.0955113,0.119264,0.321835,0.0700367,-0.354448,-0.410426,0.12807,0.591063,0.493233,0.438815,0.103588,-0.176528,-0.0631447,-0.12291,-0.0184285,0.0373656},{0.479995,0.0491169,0.0697605,0.168876,0.144539,-0.193351,-0.426569,-0.67665,-0.513777,-0.234131,-0.181196,-0.156586,0.0364759,0.164486,0.25006,-0.121386,0.080754,-2.93503e-05,-0.298562,-0.186391,-0.177953,-0.254692,-0.260632,-0.136551,0.138999,0.0543602},{-0.234666,0.00859268,0.0215998,-0.0991693,-0.11833,0.0943279,0.25068,0.317673,0.326918,0.194805,0.07596,0.167072,-0.0128001,-0.156632,-0.226985,-0.291643,-0.308952,0.00248844,0.434759,0.215335,0.0751792,-0.0840379,0.0959886,0.00232217,-0.0884188,-0.00644168},{-0.0708598,0.0126951,-0.0167767,-0.152337,-0.0371704,-0.240506,-0.28699,-0.243389,-0.43804,-0.291844,-0.636758,-0.565035,-0.332497,-0.113956,0.196411,0.345049,0.472733,-0.0364354,-0.218453,-0.243688,-0.122321,0.0609009,0.0176898,-0.0125084,-0.0402297,0.178019},{0.291032,-0.0889815,0.0179944,-0.0510045,0.00649905,0.144562,0.025241,0.022807,0.0922739,-0.0177297,-0.108963,-0.2517,-0.345724,-0.320405,-0.310692,-0.419192,-0.514431,-0.301452,0.106519,0.391732,0.361378,-0.208784,-0.16589,-0.0109164,0.0725829,0.0512105},{-0.205872,-0.00389413,-0.06295,0.000199152,-0.0273221,-0.144341,-0.372226,-0.488864,-0.568395,-0.108766,0.0625087,0.278426,-0.0587862,-0.42867,-0.12537,-0.0776928,-0.138749,-0.253409,-0.335693,0.0674026,0.0642048,0.189295,0.123115,0.103308,0.129285,-0.0157314},{0.31909,0.0458717,-0.0273831,-0.127104,-0.180897,0.0192791,0.00141377,0.109873,0.276044,0.251082,0.135508,0.113722,0.078348,0.10405,-0.0390353,0.0708154,-0.0443027,0.125088,0.307739,0.0752629,0.083787,-0.0495466,-0.0665825,-0.074346,0.0749639,-0.0380969},{-0.388666,-0.0456836,0.024782,-0.0536866,0.0311673,0.207154,0.226803,0.264347,0.167618,0.409273,0.729542,0.819435,0.829649,-0.20763,-1.06623,-0.877228,-0.202178,0.0590828,-0.0774096,0.0328899,-0.0577199,-0.240939,-0.0841597,-0.200725,-0.0633096,-0.0754931},{-0.246461,-0.0329549,0.10225,0.197947,0.0596304,-0.293187,-0.19286,-0.313231,-0.442461,-0.348809,-0.233323,-0.126273,0.254924,0.42569,0.0144599,-0.0911904,-0.0570333,0.117708,-0.0989476,-0.309058,-0.196317,-0.234715,-0.322496,-0.0754762,0.0760084,0.097791},{0.279452,0.0540077,0.0277173,0.0189477,0.00607236,-0.0133694,-0.0371523,-0.0852174,-0.0153982,-0.00250334,-0.00422417,-0.155426,-0.190289,-0.0716859,0.102882,-0.091568,0.094154,0.314129,0.163787,-0.0631686,-0.0594844,-0.0438886,-0.0781117,-0.0737941,0.00219326,0.0681645},{-0.257741,0.0629561,0.0353043,-0.0782373,0.0212006,0.0312007,-0.18814,-0.199539,-0.532677,-0.483378,-0.427042,-0.209711,0.934444,1.17205,0.174075,-0.348172,0.0717673,0.576281,0.145138,0.0345841,0.100665,-0.134723,-0.243983,0.0806992,0.00497297,0.0790632},{0.0257451,-0.0253355,-0.0730178,0.0103903,0.076899,0.139864,0.17581,0.318869,0.225265,-0.0195479,-0.127331,-0.185414,-0.328525,-0.188756,0.465973,0.809,0.490639,0.380379,0.511181,0.324787,0.167068,-0.471103,-0.504882,-0.227472,0.104431,-0.0285847},{-0.415088,-0.00450393,0.00543391,-0.0415559,-0.0438285,0.147212,0.164658,0.220859,0.00525725,-0.344674,-0.506082,-0.441581,-0.172195,0.471433,1.12289,0.28912,-0.510977,0.0259127,0.562524,0.460073,0.301806,0.0724045,-0.38315,-0.172545,0.0563244,-0.00112128},{-0.0411021,-0.00106412,-0.0433602,-0.0744011,-0.0307703,0.172885,-0.00169659,0.195578,0.131914,-0.00137211,-0.0712974,-0.245261,-0.345238,-0.276912,-0.111374,-0.246976,-0.398797,-0.485248,-0.323164,0.0162712,0.196379,0.362975,0.229848,0.193671,0.023458,-0.0721797},{-0.352865,-0.0120173,-0.0688551,-0.124956,-0.230877,0.121488,0.280956,0.174968,0.147655,0.555673,1.06788,1.34472,1.34541,0.837459,-0.017626,-0.442079,-0.101446,0.67807,0.832499,0.508507,0.2909,-0.100619,-0.000926226,-0.09348,-0.195642,-0.0172073},{0.267102,0.00614176,-0.0185393,0.0402084,0.0527271,-0.143718,-0.2943,-0.406612,-0.48733,-0.131433,0.300917,0.33695,0.0304942,-0.378727,-0.306614,-0.298659,-0.0503237,0.395981,0.128242,-0.156666,-0.113385,-0.0788954,-0.043425,0.00460363,0.0280587,0.0110598},{0.501589,0.0183221,-0.0410947,-0.0604277,-0.0258474,0.071764,0.125087,-0.00654965,-0.0211286,-0.0493199,-0.186072,-0.350254,-0.176239,-0.175094,-0.373351,-0.351066,-0.163208,-0.107453,0.0171286,-0.208827,-0.103701,-0.266898,-0.197293,-0.0678309,-0.032611,-0.048539},{0.27742,-0.0417491,0.0109798,0.0587426,0.127437,-0.525793,-0.606538,-0.518199,-0.182924,0.547082,0.608228,0.110837,-0.421677,-0.245109,-0.115321,0.0402515,0.165282,0.0379591,-0.102,-0.205678,-0.012669,-0.0637271,-0.0118253,0.107113,0.0945267,0.00141498},{0.368259,0.00592655,0.036628,0.0983231,-0.0499995,-0.0744398,-0.110774,-0.058612,0.00387992,0.0762135,0.000381073,-0.104584,-0.129288,-0.0260796,-0.152365,-0.0315944,-0.0715883,-0.0275522,-0.21912,-0.196162,-0.0128149,0.133029,0.0493514,0.00153622,0.036456,-0.00327623},{-0.375228,0.0188144,0.00895885,-0.0510089,-0.155644,0.218871,0.326649,0.265983,0.382705,0.339615,0.23559,0.0326416,-0.104116,-0.0948808,0.466281,1.3529,0.627721,-0.5606,-0.611049,-0.348984,-0.40583,-0.290811,-0.156707,0.0729968,0.0564538,-0.0433761},{0.0866542,0.0222379,-0.00870155,0.0155182,0.10384,0.122569,0.00550474,0.0281175,0.1044,0.169871,0.339076,0.347109,0.485332,0.7959,0.86016,0.456839,-0.322248,-0.893772,-0.927685,-0.694959,-0.594965,-0.13925,0.0486963,0.100574,0.0110346,-0.0550466},{-0.0935029,0.0590626,0.111494,0.0744749,0.173419,-0.193392,-0.273667,-0.23253,-0.144825,-0.109109,-0.0973706,-0.110786,-0.129659,-0.0731384,0.146427,0.0494138,-0.152026,-0.128568,-0.367411,-0.151462,-0.0361985,-0.0948166,0.00906279,-0.0834959,0.105069,0.103377},{0.446134,-0.0799401,-0.0351265,0.0126677,-0.0388603,-0.0475335,0.111544,-0.0987042,-0.140511,-0.18363,-0.125527,-0.0340821,0.061008,0.0282518,0.237594,0.246977,0.0456248,-0.140471,-0.08639,-0.102873,-0.154182,-0.0338797,0.0874932,0.116417,-0.0188756,0.0829104},{0.162248,0.0385597,0.0768104,0.00445783,-0.0753991,-0.0559861,-0.0432596,0.0212024,0.0922203,-0.465646,-0.819222,-0.0821675,0.902767,0.75747,0.0248941,-0.233181,-0.600888,-0.604028,-0.290253,0.278917,0.436515,-0.052453,-0.173178,0.040369,0.0724561,-0.0278918},{0.0987579,-0.0212994,0.054546,0.0227672,-0.115714,-0.0211177,-0.112918,-0.333328,-0.140605,0.0872596,0.142425,0.151772,0.22114,0.314898,0.38843,0.337995,0.364829,0.0136202,-0.350893,-0.248886,-0.144693,-0.318189,0.0786686,0.208764,0.0478944,0.0725561},{-0.016298,-0.0508177,-0.0386147,-0.0862527,-0.0641146,0.0781435,0.298976,0.447786,0.341386,0.629413,0.52553,-0.0889272,-0.45166,-0.743061,-0.539061,-0.0549821,0.513886,0.345835,-0.00284515,0.0466416,-0.0260851,-0.0493327,0.0150629,0.141962,-0.0323891,0.0235299},{-0.198866,-0.0194079,0.243766,0.140522,0.198227,0.00889318,0.0602634,-0.0679939,0.0322176,-0.0734166,-0.172983,-0.141987,-0.132178,0.0620518,0.0514362,0.0739824,0.0791605,-0.101228,-0.307329,-0.296489,-0.205383,-0.17313,-0.0969114,-0.133698,-0.0749065,-0.158691},{0.480608,-0.0526595,0.0732431,0.0756494,0.0396292,-0.0828324,-0.127694,-0.0866071,-0.17324,-0.216,-0.0850993,-0.34399,-0.349045,-0.261048,0.152613,0.604994,0.126712,-0.749476,-0.522698,-0.325017,-0.00619829,0.355535,0.150969,0.0853882,0.0412319,-0.025217},{-0.129063,0.0103334,0.12059,0.0173478,0.0253135,-0.290865,-0.608538,-0.600038,-0.826308,-0.127462,0.779734,1.09918,0.922019,0.474823,0.264896,-0.0182405,-0.176933,-0.152434,-0.242043,-0.0307723,0.0962486,0.101754,-0.133827,0.0738922,-0.0188668,0.00569892},{-0.378619,0.0990334,0.000907551,0.111711,0.0589518,-0.107764,-0.272727,-0.245959,-0.268463,-0.380175,-0.200883,-0.199686,-0.0445177,-0.153844,-0.0287913,-0.130897,-0.133492,-0.159047,-0.261751,-0.393385,-0.200283,-0.173513,-0.150523,-0.0961062,-0.00878008,0.0271562},{-0.0884801,-0.0241362,-0.000578774,-0.0882705,-0.022139,-0.268471,-0.557221,-0.801295,0.273794,0.964667,0.648242,0.658899,0.265425,-0.478128,-0.374312,-0.0421422,0.0906018,0.110938,0.248151,0.498385,0.372106,0.0673997,0.0620122,-0.0310677,-0.0522035,0.0768841},{0.126799,0.010236,-0.028773,0.0430993,-0.113176,-0.165932,-0.32008,-0.345302,-0.379354,-0.45921,0.20195,0.504548,0.522861,0.372583,0.293403,0.0432415,-0.0308769,0.0552531,0.12223,0.00678052,-0.0405691,-0.0441196,-0.0283178,0.0844229,0.0742825,0.0238677},{0.132456,0.0920407,0.0891655,-0.107544,-0.183914,-0.000920637,0.291866,0.105689,0.179702,0.0554697,0.0319585,0.0393406,-0.113888,-0.146483,0.154699,0.0431889,-0.0156803,0.141644,0.402212,0.201289,0.0226289,-0.097835,-0.0349571,-0.107889,-0.146891,0.133143},{0.0722077,0.0849852,0.00883922,-0.00692278,-0.157906,-0.210079,-0.114494,-0.170894,-0.180987,-0.162314,-0.173019,-0.246363,-0.0380287,0.234591,0.399404,0.490904,0.598338,0.039757,-0.469497,-0.52864,-0.323751,-0.385915,-0.152472,0.0473778,0.198269,0.0970626},{-0.163313,0.0152738,-0.0553833,0.0212614,0.00629089,0.13365,0.172002,0.221566,-0.104659,-0.488793,-0.604094,-0.488187,-0.329774,-0.0535581,-0.202189,0.19759,0.538969,0.588478,0.513856,0.320872,0.309947,0.0918973,-0.0779377,-0.0675789,-0.0587223,-0.0600929},{-0.0420252,-0.108537,-0.0655829,-0.0129318,0.00602422,-0.13247,0.0311194,-0.0175163,-0.0496772,0.191316,0.435135,0.773993,0.623218,0.0164707,-0.182396,-0.054773,-0.0630315,0.166326,0.521695,0.380737,0.242087,0.0821704,0.0321354,0.0633826,-0.0686336,-0.0374932},{-0.202946,-0.0325506,-0.0628963,0.10118,0.135907,0.115845,0.0166556,0.0269586,-0.0324071,-0.619626,-0.697014,-0.627313,-0.223739,0.121622,0.140408,0.0251778,0.126355,0.674159,0.563379,0.176142,-0.0939378,-0.168376,-0.148602,-0.17285,0.0849887,0.0102933},{-0.120448,-0.0506882,-0.054609,-0.0484413,0.0860301,-0.0279908,-0.049396,-0.115219,-0.192176,-0.239406,-0.407456,-0.285107,-0.187077,-0.273704,0.151709,0.525071,0.424847,0.178359,0.266226,0.0758729,0.17387,-0.0963507,-0.158847,-0.143653,0.0884169,0.0630966},{-0.0370944,0.0063211,0.000795112,0.0177314,0.0551189,0.0812081,-0.0682838,-0.00683055,-0.0527946,-0.308797,-0.407199,-0.134964,-0.0164247,0.395152,0.289853,0.171666,0.0608859,0.00579711,0.121537,0.126366,0.0191546,-0.0198387,-0.119426,-0.0150658,0.0596604,0.00354925},{-0.370177,-0.0362305,0.0270284,-0.00724121,-0.0934788,-0.422378,-0.116088,0.503122,1.00108,0.676151,0.270693,-0.0153505,0.0370553,0.284502,0.36685,-0.136187,-0.658681,-0.488013,0.287781,0.114681,0.085171,-0.0673931,0.0562481,0.0642354,-0.0818569,-0.00649309},{-0.605885,-0.0342767,-0.106756,-0.0108561,0.139114,0.199869,0.143486,-0.184462,-0.025479,-0.145204,-0.117652,0.101766,-0.0641316,0.00734975,-0.0650362,0.0708859,0.102107,0.154801,0.0801971,0.0181492,-0.0494783,-0.0415954,-0.0761832,0.0448074,0.00830509,-0.0483324},{-0.259057,-0.0193595,-0.0317057,-0.0163604,0.106123,0.20201,0.268879,0.414205,0.513136,0.121504,-0.590777,-0.877661,-0.534557,-0.0664137,0.241275,-0.122409,-0.169221,-0.0983183,0.0234326,-0.158051,-0.305494,-0.1762,-0.0348845,-0.101536,-0.0307927,0.0660124},{-0.0544071,-0.034837,0.0753188,-0.0252939,0.10104,0.525139,0.44326,0.567396,0.425662,0.0964903,-0.404442,-0.451191,-0.0613677,0.188646,-0.109598,-0.351384,-0.407579,-0.470028,-0.294212,-0.292969,-0.109185,0.0498989,0.0173916,-0.0298402,-0.108818,-0.0143986},{-0.561108,0.00700599,0.0277801,-0.0330003,-0.0285824,-0.211772,-0.15645,-0.277405,-0.181587,0.227898,0.0940596,0.105928,0.0282449,-0.345496,-0.466701,0.00924022,0.383791,0.266456,0.238649,0.231119,0.241849,0.207347,0.0199014,0.0703734,0.0673963,0.0307016},{-0.161226,0.00154776,0.0215054,0.0175169,0.0755731,0.0474358,-0.0178372,0.0840021,0.0182734,-0.0520258,0.0790443,0.055953,-0.0324439,-0.118099,-0.0418037,-0.0961213,-0.0430925,-0.0191308,0.139166,-0.0204639,0.104876,-0.0782666,0.0549031,0.00699352,0.145317,0.0661577},{0.0490329,0.0894659,0.088519,-0.0497007,0.0959598,-0.0157742,-0.038,-0.120484,-0.227752,-0.175357,-0.121556,0.0444167,-0.132382,-0.0602462,0.0391231,0.184817,0.143992,-0.217863,-0.317582,-0.325589,-0.0516075,0.0512126,0.0806272,0.048066,0.0504316,-0.0472475},{-0.0060573,0.010271,-0.0271779,0.0486851,-0.0940981,-0.175384,-0.0171244,-0.125859,-0.0294502,0.277882,0.324247,0.229795,0.210787,0.610089,0.730262,0.17487,0.257042,0.500265,0.268143,0.170103,-0.00870399,-0.225263,-0.0736114,0.00118653,-0.0285847,-0.0177725},{-0.182554,-0.0695699,-0.117878,0.0105982,-0.0249706,-0.259535,-0.146017,-0.331449,-0.176257,-0.369141,-0.332208,-0.157041,-0.183267,-0.044404,0.114348,0.176802,-0.161752,-0.37264,-0.412366,-0.445236,-0.30409,0.0584231,0.248957,0.200828,0.187246,-0.0361665},{-0.289018,0.00774427,0.107694,-0.039178,-0.146267,0.281313,0.256714,0.349586,0.392868,0.0999404,-0.0616575,-0.363463,-0.484396,-0.130535,0.336273,0.0555702,-0.398342,-0.505263,-0.346397,-0.290521,0.147512,0.201766,0.0752528,0.0232519,-0.118287,-0.0473732},{0.146085,0.0298503,-0.0690541,-0.039768,-0.164591,-0.074728,-0.0244902,-0.0662042,-0.166126,-0.0347763,0.177654,0.137166,0.00435291,-0.0605122,0.0036551,0.152741,0.487155,0.580124,0.449639,0.40651,0.45289,0.264484,0.245099,0.148521,-0.0776952,0.0676483},{0.0332819,-0.0977672,-0.0265882,-0.11162,-0.0453533,0.115337,0.016976,-0.0711663,0.00642014,0.321072,0.483003,0.470637,0.145586,-0.142903,-0.0887754,-0.0853359,-0.302552,-0.137674,0.134953,0.0848655,-0.0348345,-0.183914,0.0541048,0.0465421,-0.0258493,-0.118115}};
+
+#endif
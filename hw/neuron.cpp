@@ -32,11 +32,15 @@
 #include <sys/stat.h>
 
 #include "neuron.hpp"
+#include "../include/levenshtein.h"
 
 #include "model.h"
 #if DIMENSION_OF_WEIGHTS == 2
 #include "model_2D.h"
 #endif
+#if INPUT_PROJECTION_STAGE == 1
+#include "model_projection.h"
+#endif
 
 #include "./include/tiny_math.h"
 
@@ -460,38 +464,160 @@ FILE *fp;
 
 #endif
 
+	//====================================================================================================================================================================================================================
+	// RUNTIME-LOADABLE MODEL
+	//====================================================================================================================================================================================================================
+
+	// Replaces a single weight of the forward hidden layer, index being its position in the layer (see NUMBER_OF_WEIGHTS)
+	static void StoreWeight_fw(unsigned int index, float weight)
+	{
+		const unsigned int gate = NUMBER_OF_NEURONS * NUMBER_OF_INPUTS;
+
+		if (index < gate * 4) {
+			const unsigned int i = index % gate;
+#if INPUT_PROJECTION_STAGE == 1
+			/* The input projection reads its own copy of the non-recurrent weights */
+			if (i % NUMBER_OF_INPUTS < NUMBER_OF_INPUTS_NONRECURRENT) {
+				const unsigned int n = i / NUMBER_OF_INPUTS, c = i % NUMBER_OF_INPUTS;
+				switch (index / gate) {
+				case 0: WGI_fw_in[n][c] = (DTYPE_WEIGHTS_WGI_fw)weight; break;
+				case 1: WGF_fw_in[n][c] = (DTYPE_WEIGHTS_WGF_fw)weight; break;
+				case 2: WGO_fw_in[n][c] = (DTYPE_WEIGHTS_WGO_fw)weight; break;
+				default: WCI_fw_in[n][c] = (DTYPE_WEIGHTS_WCI_fw)weight; break;
+				}
+			}
+#endif
+#if DIMENSION_OF_WEIGHTS == 1
+			switch (index / gate) {
+			case 0: WGI_fw[i] = (DTYPE_WEIGHTS_WGI_fw)weight; break;
+			case 1: WGF_fw[i] = (DTYPE_WEIGHTS_WGF_fw)weight; break;
+			case 2: WGO_fw[i] = (DTYPE_WEIGHTS_WGO_fw)weight; break;
+			default: WCI_fw[i] = (DTYPE_WEIGHTS_WCI_fw)weight; break;
+			}
+#else
+			switch (index / gate) {
+			case 0: WGI_fw_2d[i / NUMBER_OF_INPUTS][i % NUMBER_OF_INPUTS] = (DTYPE_WEIGHTS_WGI_fw)weight; break;
+			case 1: WGF_fw_2d[i / NUMBER_OF_INPUTS][i % NUMBER_OF_INPUTS] = (DTYPE_WEIGHTS_WGF_fw)weight; break;
+			case 2: WGO_fw_2d[i / NUMBER_OF_INPUTS][i % NUMBER_OF_INPUTS] = (DTYPE_WEIGHTS_WGO_fw)weight; break;
+			default: WCI_fw_2d[i / NUMBER_OF_INPUTS][i % NUMBER_OF_INPUTS] = (DTYPE_WEIGHTS_WCI_fw)weight; break;
+			}
+#endif
+		}
+		else {
+			const unsigned int i = (index - gate * 4) % NUMBER_OF_NEURONS;
+			switch ((index - gate * 4) / NUMBER_OF_NEURONS) {
+			case 0: WIP_fw[i] = (DTYPE_WEIGHTS_WIP_fw)weight; break;
+			case 1: WFP_fw[i] = (DTYPE_WEIGHTS_WFP_fw)weight; break;
+			default: WOP_fw[i] = (DTYPE_WEIGHTS_WOP_fw)weight; break;
+			}
+		}
+	}
+
+	// Replaces a single weight of the backward hidden layer, index being its position in the layer (see NUMBER_OF_WEIGHTS)
+	static void StoreWeight_bw(unsigned int index, float weight)
+	{
+		const unsigned int gate = NUMBER_OF_NEURONS * NUMBER_OF_INPUTS;
+
+		if (index < gate * 4) {
+			const unsigned int i = index % gate;
+#if INPUT_PROJECTION_STAGE == 1
+			/* The input projection reads its own copy of the non-recurrent weights */
+			if (i % NUMBER_OF_INPUTS < NUMBER_OF_INPUTS_NONRECURRENT) {
+				const unsigned int n = i / NUMBER_OF_INPUTS, c = i % NUMBER_OF_INPUTS;
+				switch (index / gate) {
+				case 0: WGI_bw_in[n][c] = (DTYPE_WEIGHTS_WGI_bw)weight; break;
+				case 1: WGF_bw_in[n][c] = (DTYPE_WEIGHTS_WGF_bw)weight; break;
+				case 2: WGO_bw_in[n][c] = (DTYPE_WEIGHTS_WGO_bw)weight; break;
+				default: WCI_bw_in[n][c] = (DTYPE_WEIGHTS_WCI_bw)weight; break;
+				}
+			}
+#endif
+#if DIMENSION_OF_WEIGHTS == 1
+			switch (index / gate) {
+			case 0: WGI_bw[i] = (DTYPE_WEIGHTS_WGI_bw)weight; break;
+			case 1: WGF_bw[i] = (DTYPE_WEIGHTS_WGF_bw)weight; break;
+			case 2: WGO_bw[i] = (DTYPE_WEIGHTS_WGO_bw)weight; break;
+			default: WCI_bw[i] = (DTYPE_WEIGHTS_WCI_bw)weight; break;
+			}
+#else
+			switch (index / gate) {
+			case 0: WGI_bw_2d[i / NUMBER_OF_INPUTS][i % NUMBER_OF_INPUTS] = (DTYPE_WEIGHTS_WGI_bw)weight; break;
+			case 1: WGF_bw_2d[i / NUMBER_OF_INPUTS][i % NUMBER_OF_INPUTS] = (DTYPE_WEIGHTS_WGF_bw)weight; break;
+			case 2: WGO_bw_2d[i / NUMBER_OF_INPUTS][i % NUMBER_OF_INPUTS] = (DTYPE_WEIGHTS_WGO_bw)weight; break;
+			default: WCI_bw_2d[i / NUMBER_OF_INPUTS][i % NUMBER_OF_INPUTS] = (DTYPE_WEIGHTS_WCI_bw)weight; break;
+			}
+#endif
+		}
+		else {
+			const unsigned int i = (index - gate * 4) % NUMBER_OF_NEURONS;
+			switch ((index - gate * 4) / NUMBER_OF_NEURONS) {
+			case 0: WIP_bw[i] = (DTYPE_WEIGHTS_WIP_bw)weight; break;
+			case 1: WFP_bw[i] = (DTYPE_WEIGHTS_WFP_bw)weight; break;
+			default: WOP_bw[i] = (DTYPE_WEIGHTS_WOP_bw)weight; break;
+			}
+		}
+	}
+
+	// Replaces a single weight of the model, index being its position in a JOB_LOAD_WEIGHTS job (see NUMBER_OF_WEIGHTS).
+	// The weights are in RAMs initialized with model.h, so a model loaded at runtime holds until the next one.
+	void Store_Weight(unsigned int index, float weight)
+	{
+	#pragma HLS INLINE off
+		if (index < NUMBER_OF_WEIGHTS_HIDDEN)
+			StoreWeight_fw(index, weight);
+		else if (index < NUMBER_OF_WEIGHTS_HIDDEN * 2)
+			StoreWeight_bw(index - NUMBER_OF_WEIGHTS_HIDDEN, weight);
+		else if (index < NUMBER_OF_WEIGHTS) {
+			const unsigned int i = index - NUMBER_OF_WEIGHTS_HIDDEN * 2;
+#if DIMENSION_OF_WEIGHTS == 1
+			W2[i] = (DTYPE_WEIGHTS_W2)weight;
+#else
+			W2_2d[i / (NUMBER_OF_NEURONS * 2 + 1)][i % (NUMBER_OF_NEURONS * 2 + 1)] = (DTYPE_WEIGHTS_W2)weight;
+#endif
+		}
+	}
+
 #ifndef EMULATING_IO_SINGLE_KERNEL_BLSTM
 
+/* The leaves of the argmax tree of a column: a power of 2, at least NUMBER_OF_CLASSES */
+#define ARGMAX_TREE_WIDTH 128
+#if (NUMBER_OF_CLASSES > ARGMAX_TREE_WIDTH) || (ARGMAX_TREE_WIDTH > 256)
+#error "ARGMAX_TREE_WIDTH does not fit NUMBER_OF_CLASSES"
+#endif
+
 	  /**
-	   *  @brief  Return the index of a maximum element in a 1D array.
-	   *  @param  first  Start index of range.
-	   *  @param  last   End index of range.
-	   *  @return  Index referencing the first instance of the largest value.
+	   *  @brief  The most probable class of a column of the output layer, by a tree of comparators:
+	   *  log2(ARGMAX_TREE_WIDTH) levels, each one halving the candidates by comparing adjacent pairs.
+	   *  @param  probs  The probabilities of the classes of the column.
+	   *  @param  value  The largest probability.
+	   *  @return  The first class of the largest probability.
 	  */
-	    unsigned int max_element_syn_test(DTYPE_TRNLB image[MAX_NUMBER_COLUMNS_TEST_SET][NUMBER_OF_CLASSES], unsigned int __first, unsigned int __last)
+	    uint8_t ColumnArgmax(DTYPE_TRNLB probs[NUMBER_OF_CLASSES], DTYPE_TRNLB *value)
 	    {
-	    //std::cout << "max_element_syn_test" << std::endl;
-	    //unsigned int i=0;
-		#pragma HLS INLINE off
-		  const int min_tripcount = NUMBER_OF_CLASSES;
-		  const int avg_tripcount = MAX_NUMBER_COLUMNS_TEST_SET; // based on profiling 1759 was max;
-		  const int max_tripcount = MAX_NUMBER_COLUMNS_TEST_SET;// * NUMBER_OF_CLASSES ;
-
-		  if (__first == __last)
-			  return __first;
-
-	      unsigned int __result = __first;
-	      while (++__first != __last) {
-	    	//i++;
-			#pragma HLS PIPELINE II=2 // FIXME: shall check with co-sim if enable_flush is needed, since dynamic bounds
-			#pragma HLS LOOP_TRIPCOUNT min=min_tripcount avg=avg_tripcount max=max_tripcount
-	    	  DTYPE_TRNLB check1 = image[__result/NUMBER_OF_CLASSES][__result%NUMBER_OF_CLASSES];
-	    	  DTYPE_TRNLB check2 = image[__first/NUMBER_OF_CLASSES][__first%NUMBER_OF_CLASSES];
-	    	  if (check1 < check2)
-	    		__result = __first;
-	      }
-	      //std::cout << "i = " << i << std::endl;
-	      return __result;
+		  DTYPE_TRNLB best[ARGMAX_TREE_WIDTH];
+		  uint8_t label[ARGMAX_TREE_WIDTH];
+		  #pragma HLS ARRAY_PARTITION variable=best complete dim=1
+		  #pragma HLS ARRAY_PARTITION variable=label complete dim=1
+
+		  // The padding repeats the 1st class after the last one, so it never wins over it
+		  for(unsigned int i = 0; i < ARGMAX_TREE_WIDTH; i++) {
+		  #pragma HLS UNROLL
+			  best[i] = (i < NUMBER_OF_CLASSES) ? probs[i] : probs[0];
+			  label[i] = (uint8_t)i;
+		  }
+
+		  // The left one of a pair holds the lower classes: it wins the ties
+		  for(unsigned int width = ARGMAX_TREE_WIDTH / 2; width > 0; width /= 2) {
+		  #pragma HLS UNROLL
+			  for(unsigned int i = 0; i < width; i++) {
+			  #pragma HLS UNROLL
+				  const bool right = best[2 * i] < best[2 * i + 1];
+				  best[i] = right ? best[2 * i + 1] : best[2 * i];
+				  label[i] = right ? label[2 * i + 1] : label[2 * i];
+			  }
+		  }
+		  *value = best[0];
+		  return label[0];
 	    }
 
 
@@ -587,6 +713,137 @@ FILE *fp;
 		}
 	}
 
+#if HIDDEN_LAYER_INTERLEAVE > 1
+#if (ACC_CALLS_PER_ACTION % HIDDEN_LAYER_INTERLEAVE != 0) || !defined(INTERFACE_IS_STREAM) || !defined(MANY_STREAMS_FOR_MANY_ACCS) || (NEURON_PARALLELISM != 1)
+#error "HIDDEN_LAYER_INTERLEAVE needs to divide ACC_CALLS_PER_ACTION, with INTERFACE_IS_STREAM, MANY_STREAMS_FOR_MANY_ACCS and NEURON_PARALLELISM 1"
+#endif
+const int hidden_layer_interleave = HIDDEN_LAYER_INTERLEAVE;
+
+	// The dot products of the four gates of the LSTM memory cell for every image of the group.
+	// A single pipeline over the inputs and the images: the weights of an input are read along with
+	// its first image, then the images take a cycle each, each one accumulating in its own registers.
+	// OPS: 8 x NUMBER_OF_INPUTS x HIDDEN_LAYER_INTERLEAVE
+	void DotVectorToVector126_four_fw_interleaved(DTYPE_IMG source[HIDDEN_LAYER_INTERLEAVE][NUMBER_OF_INPUTS],
+									  DTYPE_WEIGHTS_WGI_fw weights0[NUMBER_OF_INPUTS],
+									  DTYPE_WEIGHTS_WGF_fw weights1[NUMBER_OF_INPUTS],
+									  DTYPE_WEIGHTS_WGO_fw weights2[NUMBER_OF_INPUTS],
+									  DTYPE_WEIGHTS_WCI_fw weights3[NUMBER_OF_INPUTS],
+									  DTYPE_IN outputs[HIDDEN_LAYER_INTERLEAVE][4])
+	{
+		#pragma HLS ARRAY_PARTITION variable=outputs complete dim=0
+
+		#pragma HLS INLINE off
+		DTYPE_IN acc[HIDDEN_LAYER_INTERLEAVE][4];
+		#pragma HLS ARRAY_PARTITION variable=acc complete dim=0
+		for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+		#pragma HLS UNROLL
+			acc[k][0] = acc[k][1] = acc[k][2] = acc[k][3] = 0.0;
+		}
+		DTYPE_IN tmp0, tmp1, tmp2, tmp3;
+		DTYPE_IN w0 = 0.0, w1 = 0.0, w2 = 0.0, w3 = 0.0;
+		unsigned int i = 0, k = 0;
+		for(unsigned int t = 0; t < NUMBER_OF_INPUTS * HIDDEN_LAYER_INTERLEAVE; t++)
+		{
+		#pragma HLS PIPELINE II=1
+		// The accumulators of image k are next updated HIDDEN_LAYER_INTERLEAVE iterations later
+		#pragma HLS DEPENDENCE variable=acc inter distance=hidden_layer_interleave true
+
+			if (k == 0) {
+				w0 = (DTYPE_IN)weights0[i];
+				w1 = (DTYPE_IN)weights1[i];
+				w2 = (DTYPE_IN)weights2[i];
+				w3 = (DTYPE_IN)weights3[i];
+			}
+
+			DTYPE_IN src_fw1 = source[k][i];
+			tmp0 = src_fw1 * w0;
+			tmp1 = src_fw1 * w1;
+			tmp2 = src_fw1 * w2;
+			tmp3 = src_fw1 * w3;
+
+			acc[k][0] += tmp0 ;
+			acc[k][1] += tmp1 ;
+			acc[k][2] += tmp2 ;
+			acc[k][3] += tmp3 ;
+
+			if (++k == HIDDEN_LAYER_INTERLEAVE) {
+				k = 0;
+				i++;
+			}
+		}
+		for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+		#pragma HLS UNROLL
+			outputs[k][0] = acc[k][0];
+			outputs[k][1] = acc[k][1];
+			outputs[k][2] = acc[k][2];
+			outputs[k][3] = acc[k][3];
+		}
+	}
+
+
+	// The dot products of the four gates of the LSTM memory cell for every image of the group.
+	// A single pipeline over the inputs and the images: the weights of an input are read along with
+	// its first image, then the images take a cycle each, each one accumulating in its own registers.
+	// OPS: 8 x NUMBER_OF_INPUTS x HIDDEN_LAYER_INTERLEAVE
+	void DotVectorToVector126_four_bw_interleaved(DTYPE_IMG source[HIDDEN_LAYER_INTERLEAVE][NUMBER_OF_INPUTS],
+									  DTYPE_WEIGHTS_WGI_bw weights0[NUMBER_OF_INPUTS],
+									  DTYPE_WEIGHTS_WGF_bw weights1[NUMBER_OF_INPUTS],
+									  DTYPE_WEIGHTS_WGO_bw weights2[NUMBER_OF_INPUTS],
+									  DTYPE_WEIGHTS_WCI_bw weights3[NUMBER_OF_INPUTS],
+									  DTYPE_IN outputs[HIDDEN_LAYER_INTERLEAVE][4])
+	{
+		#pragma HLS ARRAY_PARTITION variable=outputs complete dim=0
+
+		#pragma HLS INLINE off
+		DTYPE_IN acc[HIDDEN_LAYER_INTERLEAVE][4];
+		#pragma HLS ARRAY_PARTITION variable=acc complete dim=0
+		for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+		#pragma HLS UNROLL
+			acc[k][0] = acc[k][1] = acc[k][2] = acc[k][3] = 0.0;
+		}
+		DTYPE_IN tmp0, tmp1, tmp2, tmp3;
+		DTYPE_IN w0 = 0.0, w1 = 0.0, w2 = 0.0, w3 = 0.0;
+		unsigned int i = 0, k = 0;
+		for(unsigned int t = 0; t < NUMBER_OF_INPUTS * HIDDEN_LAYER_INTERLEAVE; t++)
+		{
+		#pragma HLS PIPELINE II=1
+		// The accumulators of image k are next updated HIDDEN_LAYER_INTERLEAVE iterations later
+		#pragma HLS DEPENDENCE variable=acc inter distance=hidden_layer_interleave true
+
+			if (k == 0) {
+				w0 = (DTYPE_IN)weights0[i];
+				w1 = (DTYPE_IN)weights1[i];
+				w2 = (DTYPE_IN)weights2[i];
+				w3 = (DTYPE_IN)weights3[i];
+			}
+
+			DTYPE_IN src_bw1 = source[k][i];
+			tmp0 = src_bw1 * w0;
+			tmp1 = src_bw1 * w1;
+			tmp2 = src_bw1 * w2;
+			tmp3 = src_bw1 * w3;
+
+			acc[k][0] += tmp0 ;
+			acc[k][1] += tmp1 ;
+			acc[k][2] += tmp2 ;
+			acc[k][3] += tmp3 ;
+
+			if (++k == HIDDEN_LAYER_INTERLEAVE) {
+				k = 0;
+				i++;
+			}
+		}
+		for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+		#pragma HLS UNROLL
+			outputs[k][0] = acc[k][0];
+			outputs[k][1] = acc[k][1];
+			outputs[k][2] = acc[k][2];
+			outputs[k][3] = acc[k][3];
+		}
+	}
+
+#endif /* HIDDEN_LAYER_INTERLEAVE > 1 */
+
 	// The dot product corresponding to a four gates of the LSTM memory cell
 	void OLD_DotVectorToVector126_four_bw(DTYPE_IMG source[NUMBER_OF_INPUTS],
 									  //hls::stream<float> &source,// IN  // size: 1.0 + HIGHT_IN_PIX + NUMBER_OF_NEURONS = NUMBER_OF_INPUTS
@@ -672,26 +929,24 @@ FILE *fp;
 		}
 	}
 
-	// The function of a single LSTM memory cell
-	// OPS: 10(self) + 1028(nested) = 1038
-	void HiddenLayerSingleMemoryCell_fw(DTYPE_IMG source[NUMBER_OF_INPUTS],					// IN  // size: 1.0 + HIGHT_IN_PIX + NUMBER_OF_NEURONS = NUMBER_OF_INPUTS
-									 unsigned int currentColumn,	// IN  // The current column of the image
-									 DTYPE_IN in_state,				// IN  // A single input state
-									 DTYPE_WEIGHTS_WGI_fw WGI[NUMBER_OF_INPUTS],   // IN  // size: NUMBER_OF_INPUTS
-									 DTYPE_WEIGHTS_WGF_fw WGF[NUMBER_OF_INPUTS],   // IN  // size: NUMBER_OF_INPUTS
-									 DTYPE_WEIGHTS_WGO_fw WGO[NUMBER_OF_INPUTS],   // IN  // size: NUMBER_OF_INPUTS
-									 DTYPE_WEIGHTS_WCI_fw WCI[NUMBER_OF_INPUTS],   // IN  // size: NUMBER_OF_INPUTS
-									 DTYPE_WEIGHTS_WIP_fw WIP,						// IN  // A single peephole weight
-									 DTYPE_WEIGHTS_WFP_fw WFP,						// IN  // A single peephole weight
-									 DTYPE_WEIGHTS_WOP_fw WOP,						// IN  // A single peephole weight
-									 DTYPE_IN *out_state,				// OUT // A single output state
-									 DTYPE_IN *output)              	// OUT // A single output
-
+	// The gates of a single LSTM memory cell, from the dot products of its four gates
+	// OPS: 10
+	void MemoryCellGates(DTYPE_IN outputs[4],			// IN  // The dot products of the gates: input, forget, output, cell input
+						 unsigned int currentColumn,	// IN  // The current column of the image
+						 DTYPE_IN in_state,				// IN  // A single input state
+						 DTYPE_IN WIP,					// IN  // A single peephole weight
+						 DTYPE_IN WFP,					// IN  // A single peephole weight
+						 DTYPE_IN WOP,					// IN  // A single peephole weight
+						 DTYPE_IN *out_state,			// OUT // A single output state
+						 DTYPE_IN *output)				// OUT // A single output
 	{
 //#pragma HLS DATAFLOW
+		// Kept a function of its own: the unrolled cell engines of NEURON_PARALLELISM get an instance each,
+		// and with it their own lookup ROMs
+		#pragma HLS INLINE off
 #if TRIGF_APPROX == 2
 		// Force not to create multiple ROMs for every call, i.e. latency overhead is only 1-2 cycles x number_of_calls,
-		// but resources saving are more important here for LUTs
+		// but resources saving are more important here for LUTs. The limit holds within a cell engine.
 		#pragma HLS allocation instances=divexpf_lookup limit=1 function
 		#pragma HLS allocation instances=tanh_lookup limit=1 function
 #endif
@@ -699,9 +954,6 @@ FILE *fp;
 		DTYPE_IN gi, gf, go, ci;
 		DTYPE_IN tmp_in_state;
 		DTYPE_IN tmp_out_state;
-		DTYPE_IN outputs[4];
-
-		DotVectorToVector126_four_fw(source, WGI, WGF, WGO, WCI, outputs);
 
 		tmp_in_state = in_state;
 
@@ -712,8 +964,8 @@ FILE *fp;
 
 		if(currentColumn > 0)
 		{
-			gix = gix + (DTYPE_IN)WIP * tmp_in_state;
-			gfx = gfx + (DTYPE_IN)WFP * tmp_in_state;
+			gix = gix + WIP * tmp_in_state;
+			gfx = gfx + WFP * tmp_in_state;
 		}
 		#if TRIGF_APPROX == 0
 		gi = 1.0/(1.0 + expf(-(float)gix));
@@ -735,13 +987,10 @@ FILE *fp;
 
 		tmp_out_state = ci * gi;
 
-		//fprintf(fp, "%.10f\n%.10f\n", (float)gix, (float)gfx);
-		//fprintf(fp, "%.10f\n", (float)cix);
-
 		if(currentColumn > 0)
 		{
 			tmp_out_state = tmp_out_state + gf * tmp_in_state;
-			gox = gox + (DTYPE_IN)WOP * tmp_out_state;
+			gox = gox + WOP * tmp_out_state;
 		}
 		#if TRIGF_APPROX == 0
 		go = (DTYPE_IN)(1.0/(1.0 + expf(-(float)gox)));
@@ -760,6 +1009,29 @@ FILE *fp;
 		*out_state = tmp_out_state;
 	}
 
+	// The function of a single LSTM memory cell
+	// OPS: 10(self) + 1028(nested) = 1038
+	void HiddenLayerSingleMemoryCell_fw(DTYPE_IMG source[NUMBER_OF_INPUTS],					// IN  // size: 1.0 + HIGHT_IN_PIX + NUMBER_OF_NEURONS = NUMBER_OF_INPUTS
+									 unsigned int currentColumn,	// IN  // The current column of the image
+									 DTYPE_IN in_state,				// IN  // A single input state
+									 DTYPE_WEIGHTS_WGI_fw WGI[NUMBER_OF_INPUTS],   // IN  // size: NUMBER_OF_INPUTS
+									 DTYPE_WEIGHTS_WGF_fw WGF[NUMBER_OF_INPUTS],   // IN  // size: NUMBER_OF_INPUTS
+									 DTYPE_WEIGHTS_WGO_fw WGO[NUMBER_OF_INPUTS],   // IN  // size: NUMBER_OF_INPUTS
+									 DTYPE_WEIGHTS_WCI_fw WCI[NUMBER_OF_INPUTS],   // IN  // size: NUMBER_OF_INPUTS
+									 DTYPE_WEIGHTS_WIP_fw WIP,						// IN  // A single peephole weight
+									 DTYPE_WEIGHTS_WFP_fw WFP,						// IN  // A single peephole weight
+									 DTYPE_WEIGHTS_WOP_fw WOP,						// IN  // A single peephole weight
+									 DTYPE_IN *out_state,				// OUT // A single output state
+									 DTYPE_IN *output)              	// OUT // A single output
+
+	{
+		DTYPE_IN outputs[4];
+
+		DotVectorToVector126_four_fw(source, WGI, WGF, WGO, WCI, outputs);
+
+		MemoryCellGates(outputs, currentColumn, in_state, (DTYPE_IN)WIP, (DTYPE_IN)WFP, (DTYPE_IN)WOP, out_state, output);
+	}
+
 
 	// The function of a single LSTM memory cell
 	// OPS: 10(self) + 1028(nested) = 1038
@@ -777,166 +1049,618 @@ FILE *fp;
 									 DTYPE_IN *output)              	// OUT // A single output
 
 	{
-//#pragma HLS DATAFLOW
-#if TRIGF_APPROX == 2
-		// Force not to create multiple ROMs for every call, i.e. latency overhead is only 1-2 cycles x number_of_calls,
-		// but resources saving are more important here for LUTs
-		#pragma HLS allocation instances=divexpf_lookup limit=1 function
-		#pragma HLS allocation instances=tanh_lookup limit=1 function
-#endif
-		DTYPE_IN gix, gfx, gox, cix;
-		DTYPE_IN gi, gf, go, ci;
-		DTYPE_IN tmp_in_state;
-		DTYPE_IN tmp_out_state;
 		DTYPE_IN outputs[4];
 
 		DotVectorToVector126_four_bw(source, WGI, WGF, WGO, WCI, outputs);
 
-		tmp_in_state = in_state;
+		MemoryCellGates(outputs, currentColumn, in_state, (DTYPE_IN)WIP, (DTYPE_IN)WFP, (DTYPE_IN)WOP, out_state, output);
+	}
 
-		gix = outputs[0];
-		gfx = outputs[1];
-		gox = outputs[2];
-		cix = outputs[3];
+#if NUMBER_OF_NEURONS % NEURON_PARALLELISM != 0
+#error "NEURON_PARALLELISM must divide NUMBER_OF_NEURONS"
+#endif
+const int neuron_parallelism = NEURON_PARALLELISM;
+
+#if INPUT_PROJECTION_STAGE == 1
+	// The dot products of the four gates of a cell over the non-recurrent inputs, with their weights of model_projection.h
+	// OPS: 8 x NUMBER_OF_INPUTS_NONRECURRENT = 208
+	void DotVectorToVector26_four_fw(DTYPE_IMG source[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_WEIGHTS_WGI_fw weights0[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_WEIGHTS_WGF_fw weights1[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_WEIGHTS_WGO_fw weights2[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_WEIGHTS_WCI_fw weights3[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_IN outputs[4])	// OUT // The partial dot products of the gates
+	{
+		#pragma HLS ARRAY_PARTITION variable=outputs complete dim=1
 
-		if(currentColumn > 0)
+		#pragma HLS INLINE off
+		outputs[0] = outputs[1] = outputs[2] = outputs[3] = 0.0;
+		DTYPE_IN tmp0, tmp1, tmp2, tmp3;
+		for(unsigned int i = 0; i < NUMBER_OF_INPUTS_NONRECURRENT; i++)
 		{
-			gix = gix + (DTYPE_IN)WIP * tmp_in_state;
-			gfx = gfx + (DTYPE_IN)WFP * tmp_in_state;
+		#pragma HLS PIPELINE rewind
+
+			DTYPE_IN src_fw1 = source[i];
+			tmp0 = src_fw1 * (DTYPE_IN)weights0[i];
+			tmp1 = src_fw1 * (DTYPE_IN)weights1[i];
+			tmp2 = src_fw1 * (DTYPE_IN)weights2[i];
+			tmp3 = src_fw1 * (DTYPE_IN)weights3[i];
+
+			outputs[0] += tmp0 ;
+			outputs[1] += tmp1 ;
+			outputs[2] += tmp2 ;
+			outputs[3] += tmp3 ;
+
 		}
-		#if TRIGF_APPROX == 0
-		gi = 1.0/(1.0 + expf(-(float)gix));
-		gf = 1.0/(1.0 + expf(-(float)gfx));
-		ci = (DTYPE_IN)tanhf((float)cix);
-		#elif TRIGF_APPROX == 1
-		gi = 1.0/(1.0 + tiny_expf(-gix));
-		gf = 1.0/(1.0 + tiny_expf(-gfx));
-		ci = tiny_tanhf(cix);
-		#elif TRIGF_APPROX == 2
-		gi = divexpf_lookup(gix);
-		gf = divexpf_lookup(gfx);
-		ci = tanh_lookup(cix);
-		#elif TRIGF_APPROX == 3
-		gi = divexpf_pwl(gix);
-		gf = divexpf_pwl(gfx);
-		ci = tanh_pwl(cix);
-		#endif
+	}
 
-		tmp_out_state = ci * gi;
+	// The dot products of the four gates of a cell continued over the outputs of the previous column, the
+	// weights starting past the non-recurrent ones
+	// OPS: 8 x NUMBER_OF_NEURONS = 800
+	void DotVectorToVector100_four_fw(DTYPE_IMG source[NUMBER_OF_NEURONS],
+									  DTYPE_WEIGHTS_WGI_fw weights0[NUMBER_OF_NEURONS],
+									  DTYPE_WEIGHTS_WGF_fw weights1[NUMBER_OF_NEURONS],
+									  DTYPE_WEIGHTS_WGO_fw weights2[NUMBER_OF_NEURONS],
+									  DTYPE_WEIGHTS_WCI_fw weights3[NUMBER_OF_NEURONS],
+									  DTYPE_IN outputs[4])	// IN/OUT // The dot products of the gates
+	{
+		#pragma HLS ARRAY_PARTITION variable=outputs complete dim=1
 
-		if(currentColumn > 0)
+		#pragma HLS INLINE off
+		DTYPE_IN tmp0, tmp1, tmp2, tmp3;
+		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++)
 		{
-			tmp_out_state = tmp_out_state + gf * tmp_in_state;
-			gox = gox + (DTYPE_IN)WOP * tmp_out_state;
+		#pragma HLS PIPELINE rewind
+
+			DTYPE_IN src_fw1 = source[i];
+			tmp0 = src_fw1 * (DTYPE_IN)weights0[i];
+			tmp1 = src_fw1 * (DTYPE_IN)weights1[i];
+			tmp2 = src_fw1 * (DTYPE_IN)weights2[i];
+			tmp3 = src_fw1 * (DTYPE_IN)weights3[i];
+
+			outputs[0] += tmp0 ;
+			outputs[1] += tmp1 ;
+			outputs[2] += tmp2 ;
+			outputs[3] += tmp3 ;
+
 		}
-		#if TRIGF_APPROX == 0
-		go = (DTYPE_IN)(1.0/(1.0 + expf(-(float)gox)));
-		*output = (DTYPE_IN)tanhf((float)tmp_out_state) * go;
-		#elif TRIGF_APPROX == 1
-		go = 1.0/(1.0 + tiny_expf(-gox));
-		*output = tiny_tanhf(tmp_out_state) * go;
-		#elif TRIGF_APPROX == 2
-		go = divexpf_lookup(gox);
-		*output =  tanh_lookup(tmp_out_state) * go;
-		#elif TRIGF_APPROX == 3
-		go = divexpf_pwl(gox);
-		*output =  tanh_pwl(tmp_out_state) * go;
-		#endif
-		//
-		*out_state = tmp_out_state;
 	}
 
-
-	// OPS: 200+COLSx(125+400+100x1038) = 76366100
-	void Hidden_Layer_fw(
+	// The input projection of the forward hidden layer: the non-recurrent part of the dot products of
+	// every cell, column after column, 4 per neuron in the order the cell engines take the neurons
+	// OPS: COLSx(100x208) = 15225600
+	void Input_Projection_fw(
 						#ifdef INTERFACE_IS_STREAM
 					  	  hls::stream<DTYPE_IMG> &image, 	// IN  // size: numberOfColumns * HIGHT_IN_PIX
 						#else
 						  DTYPE_IMG *image, 				// IN // [MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
 						#endif
 						  unsigned int numberOfColumns,		// IN  //
-						  hls::stream<DTYPE_LAYERS> &result)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS
+						  hls::stream<DTYPE_IN> &projection)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS * 4
 	{
-		DTYPE_IMG source[NUMBER_OF_INPUTS];
-		/*
-		FILE *fd = fopen("/tmp/values.txt", "w");
-		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++)
-			for(unsigned int j = 0; j < NUMBER_OF_INPUTS; j++)
-			fprintf(fd, "%f %f %f %f\n", (float)WGI_fw_2d[i][j], (float)WGF_fw_2d[i][j], (float)WGO_fw_2d[i][j], (float)WCI_fw_2d[i][j]);
-		fclose(fd);
-		exit(-1);
-		 */
-
-		DTYPE_LAYERS outputRegister[NUMBER_OF_NEURONS];
-		DTYPE_IN stateRegister[NUMBER_OF_NEURONS];
-
-		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
-		#pragma HLS UNROLL
-			outputRegister[i] = 0.0;
-		}
+		DTYPE_IMG source[NUMBER_OF_INPUTS_NONRECURRENT];
 
-		//printf("DEBUG: numberOfColumns: %d\n", numberOfColumns);
-		unsigned int column_index;
 		for(unsigned int column = 0; column < numberOfColumns; column++)
 		{
 			const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
 			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
-			//Concatinate 1.0 + image + previous output
+			//Concatinate 1.0 + image
 			source[0] = 1.0;
-
 			for(unsigned int k = 0; k < HIGHT_IN_PIX ; k++) {
 #ifdef INTERFACE_IS_STREAM
 			#pragma HLS pipeline II=1
-				//if (k < HIGHT_IN_PIX)
-					source[k+1] = image.read();
-				//else
-				//	source[k+1] = outputRegister[k-HIGHT_IN_PIX];
-				//u.f = source[k+1];
-				//printf("image[%u]=%08x\n", column*HIGHT_IN_PIX+k, (unsigned int)u.t);
-				//std::cout << "image.read(" << global++ << ") = " << source[k+1] << std::endl;
+				source[k+1] = image.read();
 #else
 				source[k+1] = image[column*HIGHT_IN_PIX+k];
 #endif
 			}
-			for(unsigned int k = 0; k < NUMBER_OF_NEURONS; k++) {
-#pragma HLS pipeline II=1
-				source[k+1+HIGHT_IN_PIX] = outputRegister[k];
+
+			for(unsigned int g = 0; g < NUMBER_OF_NEURONS / NEURON_PARALLELISM; g++)
+			{
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++)
+				{
+					const unsigned int n = p * (NUMBER_OF_NEURONS / NEURON_PARALLELISM) + g;
+					DTYPE_WEIGHTS_WGI_fw *pWGI = WGI_fw_in[n];
+					DTYPE_WEIGHTS_WGF_fw *pWGF = WGF_fw_in[n];
+					DTYPE_WEIGHTS_WGO_fw *pWGO = WGO_fw_in[n];
+					DTYPE_WEIGHTS_WCI_fw *pWCI = WCI_fw_in[n];
+					DTYPE_IN outputs[4];
+
+					DotVectorToVector26_four_fw(source, pWGI, pWGF, pWGO, pWCI, outputs);
+
+					for(unsigned int j = 0; j < 4; j++) {
+					#pragma HLS pipeline II=1
+						projection.write(outputs[j]);
+					}
+				}
 			}
+		}
+	}
 
-			for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++)
+	// The recurrence of the forward hidden layer, the input projection of every cell coming from Input_Projection_fw
+	// OPS: 200+COLSx(100+400+100x810) = 59958200
+	void Hidden_Layer_Recurrence_fw(hls::stream<DTYPE_IN> &projection,	// IN  // size: numberOfColumns * NUMBER_OF_NEURONS * 4
+						  unsigned int numberOfColumns,		// IN  //
+						  hls::stream<DTYPE_LAYERS> &result)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS
+	{
+		/* A copy of the outputs of the previous column for every cell engine */
+		DTYPE_IMG source[NEURON_PARALLELISM][NUMBER_OF_NEURONS];
+		#pragma HLS ARRAY_PARTITION variable=source complete dim=1
+
+		DTYPE_LAYERS outputRegister[NUMBER_OF_NEURONS];
+		DTYPE_IN stateRegister[NUMBER_OF_NEURONS];
+#if NEURON_PARALLELISM > 1
+		#pragma HLS ARRAY_PARTITION variable=outputRegister block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=stateRegister block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WIP_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WFP_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WOP_fw block factor=neuron_parallelism dim=1
+#if DIMENSION_OF_WEIGHTS == 1
+		#pragma HLS ARRAY_PARTITION variable=WGI_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGF_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGO_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WCI_fw block factor=neuron_parallelism dim=1
+#else
+		#pragma HLS ARRAY_PARTITION variable=WGI_fw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGF_fw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGO_fw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WCI_fw_2d block factor=neuron_parallelism dim=1
+#endif
+#endif
+
+		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
+		#pragma HLS UNROLL
+			outputRegister[i] = 0.0;
+		}
+
+		for(unsigned int column = 0; column < numberOfColumns; column++)
+		{
+			const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
+			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+			for(unsigned int k = 0; k < NUMBER_OF_NEURONS; k++) {
+#pragma HLS pipeline II=1
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++) {
+				#pragma HLS UNROLL
+					source[p][k] = outputRegister[k];
+				}
+			}
+
+			/* The engines work on their blocks of neurons in parallel, engine p on neuron n */
+			for(unsigned int g = 0; g < NUMBER_OF_NEURONS / NEURON_PARALLELISM; g++)
 			{
-//#pragma HLS UNROLL factor=4
-//#pragma HLS pipeline II=1 // x14 FF-LUT resources, 5x speedup
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++)
+				{
+				#pragma HLS UNROLL
+					const unsigned int n = p * (NUMBER_OF_NEURONS / NEURON_PARALLELISM) + g;
 #if DIMENSION_OF_WEIGHTS == 1
-				DTYPE_WEIGHTS_WGI_bw *pWGI = WGI_fw + n * NUMBER_OF_INPUTS;
-				DTYPE_WEIGHTS_WGF_bw *pWGF = WGF_fw + n * NUMBER_OF_INPUTS;
-				DTYPE_WEIGHTS_WGO_bw *pWGO = WGO_fw + n * NUMBER_OF_INPUTS;
-				DTYPE_WEIGHTS_WCI_bw *pWCI = WCI_fw + n * NUMBER_OF_INPUTS;
+					DTYPE_WEIGHTS_WGI_fw *pWGI = WGI_fw + n * NUMBER_OF_INPUTS + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WGF_fw *pWGF = WGF_fw + n * NUMBER_OF_INPUTS + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WGO_fw *pWGO = WGO_fw + n * NUMBER_OF_INPUTS + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WCI_fw *pWCI = WCI_fw + n * NUMBER_OF_INPUTS + NUMBER_OF_INPUTS_NONRECURRENT;
 #else
-				DTYPE_WEIGHTS_WGI_fw *pWGI = WGI_fw_2d[n];
-				DTYPE_WEIGHTS_WGF_fw *pWGF = WGF_fw_2d[n];
-				DTYPE_WEIGHTS_WGO_fw *pWGO = WGO_fw_2d[n];
-				DTYPE_WEIGHTS_WCI_fw *pWCI = WCI_fw_2d[n];
+					DTYPE_WEIGHTS_WGI_fw *pWGI = WGI_fw_2d[n] + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WGF_fw *pWGF = WGF_fw_2d[n] + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WGO_fw *pWGO = WGO_fw_2d[n] + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WCI_fw *pWCI = WCI_fw_2d[n] + NUMBER_OF_INPUTS_NONRECURRENT;
 #endif
-				DTYPE_IN out_state, output;
+					DTYPE_IN outputs[4];
+					DTYPE_IN out_state, output;
 
-				HiddenLayerSingleMemoryCell_fw(source,
-											column,
-										    stateRegister[n],
-											pWGI,
-										    pWGF,
-										    pWGO,
-										    pWCI,
-										    WIP_fw[n],
-										    WFP_fw[n],
-										    WOP_fw[n],
-											&out_state,
-											&output);
+					for(unsigned int j = 0; j < 4; j++)
+						outputs[j] = projection.read();
 
-				stateRegister[n] = out_state;
-				outputRegister[n] = output;
+					DotVectorToVector100_four_fw(source[p], pWGI, pWGF, pWGO, pWCI, outputs);
+
+					MemoryCellGates(outputs, column, stateRegister[n], (DTYPE_IN)WIP_fw[n], (DTYPE_IN)WFP_fw[n], (DTYPE_IN)WOP_fw[n], &out_state, &output);
+
+					stateRegister[n] = out_state;
+					outputRegister[n] = output;
+#if NEURON_PARALLELISM == 1
+					result.write(outputRegister[n]);
+#endif
+				}
+			}
+#if NEURON_PARALLELISM > 1
+			/* The outputs of the column go out in neuron order */
+			for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++) {
+#pragma HLS pipeline II=1
+				result.write(outputRegister[n]);
+			}
+#endif
+		}
+	}
+
+	// The forward hidden layer as two stages, see INPUT_PROJECTION_STAGE
+	// OPS: 200+COLSx(100+400+100x1018) = 75183800
+	void Hidden_Layer_fw(
+						#ifdef INTERFACE_IS_STREAM
+					  	  hls::stream<DTYPE_IMG> &image, 	// IN  // size: numberOfColumns * HIGHT_IN_PIX
+						#else
+						  DTYPE_IMG *image, 				// IN // [MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
+						#endif
+						  unsigned int numberOfColumns,		// IN  //
+						  hls::stream<DTYPE_LAYERS> &result)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS
+	{
+#pragma HLS DATAFLOW
+		hls::stream<DTYPE_IN> projection("projection_fw"); // NUMBER_OF_NEURONS * 4 per column
+
+		/* A column of projections ahead of the recurrence */
+		const int projection_size = NUMBER_OF_NEURONS * 4;
+		#pragma HLS STREAM variable=projection depth=projection_size dim=1
+
+		Input_Projection_fw(image, numberOfColumns, projection);
+
+		Hidden_Layer_Recurrence_fw(projection, numberOfColumns, result);
+	}
+
+
+	// The dot products of the four gates of a cell over the non-recurrent inputs, with their weights of model_projection.h
+	// OPS: 8 x NUMBER_OF_INPUTS_NONRECURRENT = 208
+	void DotVectorToVector26_four_bw(DTYPE_IMG source[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_WEIGHTS_WGI_bw weights0[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_WEIGHTS_WGF_bw weights1[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_WEIGHTS_WGO_bw weights2[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_WEIGHTS_WCI_bw weights3[NUMBER_OF_INPUTS_NONRECURRENT],
+									 DTYPE_IN outputs[4])	// OUT // The partial dot products of the gates
+	{
+		#pragma HLS ARRAY_PARTITION variable=outputs complete dim=1
+
+		#pragma HLS INLINE off
+		outputs[0] = outputs[1] = outputs[2] = outputs[3] = 0.0;
+		DTYPE_IN tmp0, tmp1, tmp2, tmp3;
+		for(unsigned int i = 0; i < NUMBER_OF_INPUTS_NONRECURRENT; i++)
+		{
+		#pragma HLS PIPELINE rewind
+
+			DTYPE_IN src_bw1 = source[i];
+			tmp0 = src_bw1 * (DTYPE_IN)weights0[i];
+			tmp1 = src_bw1 * (DTYPE_IN)weights1[i];
+			tmp2 = src_bw1 * (DTYPE_IN)weights2[i];
+			tmp3 = src_bw1 * (DTYPE_IN)weights3[i];
+
+			outputs[0] += tmp0 ;
+			outputs[1] += tmp1 ;
+			outputs[2] += tmp2 ;
+			outputs[3] += tmp3 ;
+
+		}
+	}
+
+	// The dot products of the four gates of a cell continued over the outputs of the previous column, the
+	// weights starting past the non-recurrent ones
+	// OPS: 8 x NUMBER_OF_NEURONS = 800
+	void DotVectorToVector100_four_bw(DTYPE_IMG source[NUMBER_OF_NEURONS],
+									  DTYPE_WEIGHTS_WGI_bw weights0[NUMBER_OF_NEURONS],
+									  DTYPE_WEIGHTS_WGF_bw weights1[NUMBER_OF_NEURONS],
+									  DTYPE_WEIGHTS_WGO_bw weights2[NUMBER_OF_NEURONS],
+									  DTYPE_WEIGHTS_WCI_bw weights3[NUMBER_OF_NEURONS],
+									  DTYPE_IN outputs[4])	// IN/OUT // The dot products of the gates
+	{
+		#pragma HLS ARRAY_PARTITION variable=outputs complete dim=1
+
+		#pragma HLS INLINE off
+		DTYPE_IN tmp0, tmp1, tmp2, tmp3;
+		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++)
+		{
+		#pragma HLS PIPELINE rewind
+
+			DTYPE_IN src_bw1 = source[i];
+			tmp0 = src_bw1 * (DTYPE_IN)weights0[i];
+			tmp1 = src_bw1 * (DTYPE_IN)weights1[i];
+			tmp2 = src_bw1 * (DTYPE_IN)weights2[i];
+			tmp3 = src_bw1 * (DTYPE_IN)weights3[i];
+
+			outputs[0] += tmp0 ;
+			outputs[1] += tmp1 ;
+			outputs[2] += tmp2 ;
+			outputs[3] += tmp3 ;
+
+		}
+	}
+
+	// The input projection of the backward hidden layer: the non-recurrent part of the dot products of
+	// every cell, column after column, 4 per neuron in the order the cell engines take the neurons
+	// OPS: COLSx(100x208) = 15225600
+	void Input_Projection_bw(
+						#ifdef INTERFACE_IS_STREAM
+					  	  hls::stream<DTYPE_IMG> &image, 	// IN  // size: numberOfColumns * HIGHT_IN_PIX
+						#else
+						  DTYPE_IMG *image, 				// IN // [MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
+						#endif
+						  unsigned int numberOfColumns,		// IN  //
+						  hls::stream<DTYPE_IN> &projection)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS * 4
+	{
+		DTYPE_IMG source[NUMBER_OF_INPUTS_NONRECURRENT];
+
+		for(unsigned int column = 0; column < numberOfColumns; column++)
+		{
+			const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
+			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+			//Concatinate 1.0 + image
+			source[0] = 1.0;
+			for(unsigned int k = 0; k < HIGHT_IN_PIX ; k++) {
+#ifdef INTERFACE_IS_STREAM
+			#pragma HLS pipeline II=1
+				source[k+1] = image.read();
+#else
+				source[k+1] = image[column*HIGHT_IN_PIX+k];
+#endif
+			}
+
+			for(unsigned int g = 0; g < NUMBER_OF_NEURONS / NEURON_PARALLELISM; g++)
+			{
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++)
+				{
+					const unsigned int n = p * (NUMBER_OF_NEURONS / NEURON_PARALLELISM) + g;
+					DTYPE_WEIGHTS_WGI_bw *pWGI = WGI_bw_in[n];
+					DTYPE_WEIGHTS_WGF_bw *pWGF = WGF_bw_in[n];
+					DTYPE_WEIGHTS_WGO_bw *pWGO = WGO_bw_in[n];
+					DTYPE_WEIGHTS_WCI_bw *pWCI = WCI_bw_in[n];
+					DTYPE_IN outputs[4];
+
+					DotVectorToVector26_four_bw(source, pWGI, pWGF, pWGO, pWCI, outputs);
+
+					for(unsigned int j = 0; j < 4; j++) {
+					#pragma HLS pipeline II=1
+						projection.write(outputs[j]);
+					}
+				}
+			}
+		}
+	}
+
+	// The recurrence of the backward hidden layer, the input projection of every cell coming from Input_Projection_bw
+	// OPS: 200+COLSx(100+400+100x810) = 59958200
+	void Hidden_Layer_Recurrence_bw(hls::stream<DTYPE_IN> &projection,	// IN  // size: numberOfColumns * NUMBER_OF_NEURONS * 4
+						  unsigned int numberOfColumns,		// IN  //
+						  hls::stream<DTYPE_LAYERS> &result)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS
+	{
+		/* A copy of the outputs of the previous column for every cell engine */
+		DTYPE_IMG source[NEURON_PARALLELISM][NUMBER_OF_NEURONS];
+		#pragma HLS ARRAY_PARTITION variable=source complete dim=1
+
+		DTYPE_LAYERS outputRegister[NUMBER_OF_NEURONS];
+		DTYPE_IN stateRegister[NUMBER_OF_NEURONS];
+#if NEURON_PARALLELISM > 1
+		#pragma HLS ARRAY_PARTITION variable=outputRegister block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=stateRegister block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WIP_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WFP_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WOP_bw block factor=neuron_parallelism dim=1
+#if DIMENSION_OF_WEIGHTS == 1
+		#pragma HLS ARRAY_PARTITION variable=WGI_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGF_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGO_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WCI_bw block factor=neuron_parallelism dim=1
+#else
+		#pragma HLS ARRAY_PARTITION variable=WGI_bw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGF_bw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGO_bw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WCI_bw_2d block factor=neuron_parallelism dim=1
+#endif
+#endif
+
+		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
+		#pragma HLS UNROLL
+			outputRegister[i] = 0.0;
+		}
+
+		for(unsigned int column = 0; column < numberOfColumns; column++)
+		{
+			const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
+			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+			for(unsigned int k = 0; k < NUMBER_OF_NEURONS; k++) {
+#pragma HLS pipeline II=1
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++) {
+				#pragma HLS UNROLL
+					source[p][k] = outputRegister[k];
+				}
+			}
+
+			/* The engines work on their blocks of neurons in parallel, engine p on neuron n */
+			for(unsigned int g = 0; g < NUMBER_OF_NEURONS / NEURON_PARALLELISM; g++)
+			{
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++)
+				{
+				#pragma HLS UNROLL
+					const unsigned int n = p * (NUMBER_OF_NEURONS / NEURON_PARALLELISM) + g;
+#if DIMENSION_OF_WEIGHTS == 1
+					DTYPE_WEIGHTS_WGI_bw *pWGI = WGI_bw + n * NUMBER_OF_INPUTS + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WGF_bw *pWGF = WGF_bw + n * NUMBER_OF_INPUTS + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WGO_bw *pWGO = WGO_bw + n * NUMBER_OF_INPUTS + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WCI_bw *pWCI = WCI_bw + n * NUMBER_OF_INPUTS + NUMBER_OF_INPUTS_NONRECURRENT;
+#else
+					DTYPE_WEIGHTS_WGI_bw *pWGI = WGI_bw_2d[n] + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WGF_bw *pWGF = WGF_bw_2d[n] + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WGO_bw *pWGO = WGO_bw_2d[n] + NUMBER_OF_INPUTS_NONRECURRENT;
+					DTYPE_WEIGHTS_WCI_bw *pWCI = WCI_bw_2d[n] + NUMBER_OF_INPUTS_NONRECURRENT;
+#endif
+					DTYPE_IN outputs[4];
+					DTYPE_IN out_state, output;
+
+					for(unsigned int j = 0; j < 4; j++)
+						outputs[j] = projection.read();
+
+					DotVectorToVector100_four_bw(source[p], pWGI, pWGF, pWGO, pWCI, outputs);
+
+					MemoryCellGates(outputs, column, stateRegister[n], (DTYPE_IN)WIP_bw[n], (DTYPE_IN)WFP_bw[n], (DTYPE_IN)WOP_bw[n], &out_state, &output);
+
+					stateRegister[n] = out_state;
+					outputRegister[n] = output;
+#if NEURON_PARALLELISM == 1
+					result.write(outputRegister[n]);
+#endif
+				}
+			}
+#if NEURON_PARALLELISM > 1
+			/* The outputs of the column go out in neuron order */
+			for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++) {
+#pragma HLS pipeline II=1
 				result.write(outputRegister[n]);
 			}
+#endif
+		}
+	}
+
+	// The backward hidden layer as two stages, see INPUT_PROJECTION_STAGE
+	// OPS: 200+COLSx(100+400+100x1018) = 75183800
+	void Hidden_Layer_bw(
+						#ifdef INTERFACE_IS_STREAM
+					  	  hls::stream<DTYPE_IMG> &image, 	// IN  // size: numberOfColumns * HIGHT_IN_PIX
+						#else
+						  DTYPE_IMG *image, 				// IN // [MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
+						#endif
+						  unsigned int numberOfColumns,		// IN  //
+						  hls::stream<DTYPE_LAYERS> &result)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS
+	{
+#pragma HLS DATAFLOW
+		hls::stream<DTYPE_IN> projection("projection_bw"); // NUMBER_OF_NEURONS * 4 per column
+
+		/* A column of projections ahead of the recurrence */
+		const int projection_size = NUMBER_OF_NEURONS * 4;
+		#pragma HLS STREAM variable=projection depth=projection_size dim=1
+
+		Input_Projection_bw(image, numberOfColumns, projection);
+
+		Hidden_Layer_Recurrence_bw(projection, numberOfColumns, result);
+	}
+
+#else /* INPUT_PROJECTION_STAGE == 1 */
+
+	// OPS: 200+COLSx(125+400+100x1038) = 76366100
+	void Hidden_Layer_fw(
+						#ifdef INTERFACE_IS_STREAM
+					  	  hls::stream<DTYPE_IMG> &image, 	// IN  // size: numberOfColumns * HIGHT_IN_PIX
+						#else
+						  DTYPE_IMG *image, 				// IN // [MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX],
+						#endif
+						  unsigned int numberOfColumns,		// IN  //
+						  hls::stream<DTYPE_LAYERS> &result)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS
+	{
+		/* A copy of the inputs of the column for every cell engine */
+		DTYPE_IMG source[NEURON_PARALLELISM][NUMBER_OF_INPUTS];
+		#pragma HLS ARRAY_PARTITION variable=source complete dim=1
+		/*
+		FILE *fd = fopen("/tmp/values.txt", "w");
+		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++)
+			for(unsigned int j = 0; j < NUMBER_OF_INPUTS; j++)
+			fprintf(fd, "%f %f %f %f\n", (float)WGI_fw_2d[i][j], (float)WGF_fw_2d[i][j], (float)WGO_fw_2d[i][j], (float)WCI_fw_2d[i][j]);
+		fclose(fd);
+		exit(-1);
+		 */
+
+		DTYPE_LAYERS outputRegister[NUMBER_OF_NEURONS];
+		DTYPE_IN stateRegister[NUMBER_OF_NEURONS];
+#if NEURON_PARALLELISM > 1
+		#pragma HLS ARRAY_PARTITION variable=outputRegister block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=stateRegister block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WIP_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WFP_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WOP_fw block factor=neuron_parallelism dim=1
+#if DIMENSION_OF_WEIGHTS == 1
+		#pragma HLS ARRAY_PARTITION variable=WGI_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGF_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGO_fw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WCI_fw block factor=neuron_parallelism dim=1
+#else
+		#pragma HLS ARRAY_PARTITION variable=WGI_fw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGF_fw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGO_fw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WCI_fw_2d block factor=neuron_parallelism dim=1
+#endif
+#endif
+
+		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
+		#pragma HLS UNROLL
+			outputRegister[i] = 0.0;
+		}
+
+		//printf("DEBUG: numberOfColumns: %d\n", numberOfColumns);
+		unsigned int column_index;
+		for(unsigned int column = 0; column < numberOfColumns; column++)
+		{
+			const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
+			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+			//Concatinate 1.0 + image + previous output
+			for(unsigned int p = 0; p < NEURON_PARALLELISM; p++) {
+			#pragma HLS UNROLL
+				source[p][0] = 1.0;
+			}
+
+			for(unsigned int k = 0; k < HIGHT_IN_PIX ; k++) {
+#ifdef INTERFACE_IS_STREAM
+			#pragma HLS pipeline II=1
+				//if (k < HIGHT_IN_PIX)
+					const DTYPE_IMG pixel = image.read();
+				//else
+				//	source[k+1] = outputRegister[k-HIGHT_IN_PIX];
+				//u.f = source[k+1];
+				//printf("image[%u]=%08x\n", column*HIGHT_IN_PIX+k, (unsigned int)u.t);
+				//std::cout << "image.read(" << global++ << ") = " << source[k+1] << std::endl;
+#else
+				const DTYPE_IMG pixel = image[column*HIGHT_IN_PIX+k];
+#endif
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++) {
+				#pragma HLS UNROLL
+					source[p][k+1] = pixel;
+				}
+			}
+			for(unsigned int k = 0; k < NUMBER_OF_NEURONS; k++) {
+#pragma HLS pipeline II=1
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++) {
+				#pragma HLS UNROLL
+					source[p][k+1+HIGHT_IN_PIX] = outputRegister[k];
+				}
+			}
+
+			/* The engines work on their blocks of neurons in parallel, engine p on neuron n */
+			for(unsigned int g = 0; g < NUMBER_OF_NEURONS / NEURON_PARALLELISM; g++)
+			{
+//#pragma HLS pipeline II=1 // x14 FF-LUT resources, 5x speedup
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++)
+				{
+				#pragma HLS UNROLL
+					const unsigned int n = p * (NUMBER_OF_NEURONS / NEURON_PARALLELISM) + g;
+#if DIMENSION_OF_WEIGHTS == 1
+					DTYPE_WEIGHTS_WGI_bw *pWGI = WGI_fw + n * NUMBER_OF_INPUTS;
+					DTYPE_WEIGHTS_WGF_bw *pWGF = WGF_fw + n * NUMBER_OF_INPUTS;
+					DTYPE_WEIGHTS_WGO_bw *pWGO = WGO_fw + n * NUMBER_OF_INPUTS;
+					DTYPE_WEIGHTS_WCI_bw *pWCI = WCI_fw + n * NUMBER_OF_INPUTS;
+#else
+					DTYPE_WEIGHTS_WGI_fw *pWGI = WGI_fw_2d[n];
+					DTYPE_WEIGHTS_WGF_fw *pWGF = WGF_fw_2d[n];
+					DTYPE_WEIGHTS_WGO_fw *pWGO = WGO_fw_2d[n];
+					DTYPE_WEIGHTS_WCI_fw *pWCI = WCI_fw_2d[n];
+#endif
+					DTYPE_IN out_state, output;
+
+					HiddenLayerSingleMemoryCell_fw(source[p],
+												column,
+											    stateRegister[n],
+												pWGI,
+											    pWGF,
+											    pWGO,
+											    pWCI,
+											    WIP_fw[n],
+											    WFP_fw[n],
+											    WOP_fw[n],
+												&out_state,
+												&output);
+
+					stateRegister[n] = out_state;
+					outputRegister[n] = output;
+#if NEURON_PARALLELISM == 1
+					result.write(outputRegister[n]);
+#endif
+				}
+			}
+#if NEURON_PARALLELISM > 1
+			/* The outputs of the column go out in neuron order */
+			for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++) {
+#pragma HLS pipeline II=1
+				result.write(outputRegister[n]);
+			}
+#endif
 		}
 	}
 
@@ -951,10 +1675,30 @@ FILE *fp;
 						  unsigned int numberOfColumns,		// IN  //
 						  hls::stream<DTYPE_LAYERS> &result)// OUT // size: numberOfColumns * NUMBER_OF_NEURONS
 	{
-		DTYPE_IMG source[NUMBER_OF_INPUTS];
+		/* A copy of the inputs of the column for every cell engine */
+		DTYPE_IMG source[NEURON_PARALLELISM][NUMBER_OF_INPUTS];
+		#pragma HLS ARRAY_PARTITION variable=source complete dim=1
 
 		DTYPE_LAYERS outputRegister[NUMBER_OF_NEURONS];
 		DTYPE_IN stateRegister[NUMBER_OF_NEURONS];
+#if NEURON_PARALLELISM > 1
+		#pragma HLS ARRAY_PARTITION variable=outputRegister block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=stateRegister block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WIP_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WFP_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WOP_bw block factor=neuron_parallelism dim=1
+#if DIMENSION_OF_WEIGHTS == 1
+		#pragma HLS ARRAY_PARTITION variable=WGI_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGF_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGO_bw block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WCI_bw block factor=neuron_parallelism dim=1
+#else
+		#pragma HLS ARRAY_PARTITION variable=WGI_bw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGF_bw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WGO_bw_2d block factor=neuron_parallelism dim=1
+		#pragma HLS ARRAY_PARTITION variable=WCI_bw_2d block factor=neuron_parallelism dim=1
+#endif
+#endif
 
 		for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
 		#pragma HLS UNROLL
@@ -968,31 +1712,219 @@ FILE *fp;
 			const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
 			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
 			//Concatinate 1.0 + image + previous output
-			source[0] = 1.0;
+			for(unsigned int p = 0; p < NEURON_PARALLELISM; p++) {
+			#pragma HLS UNROLL
+				source[p][0] = 1.0;
+			}
 
 			for(unsigned int k = 0; k < HIGHT_IN_PIX ; k++) {
 #ifdef INTERFACE_IS_STREAM
 			#pragma HLS pipeline II=1
 				//if (k < HIGHT_IN_PIX)
-					source[k+1] = image.read();
+					const DTYPE_IMG pixel = image.read();
 				//else
 				//	source[k+1] = outputRegister[k-HIGHT_IN_PIX];
 				//u.f = source[k+1];
 				//printf("image[%u]=%08x\n", column*HIGHT_IN_PIX+k, (unsigned int)u.t);
 				//std::cout << "image.read(" << global++ << ") = " << source[k+1] << std::endl;
 #else
-				source[k+1] = image[column*HIGHT_IN_PIX+k];
+				const DTYPE_IMG pixel = image[column*HIGHT_IN_PIX+k];
 #endif
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++) {
+				#pragma HLS UNROLL
+					source[p][k+1] = pixel;
+				}
 			}
 			for(unsigned int k = 0; k < NUMBER_OF_NEURONS; k++) {
 #pragma HLS pipeline II=1
-				source[k+1+HIGHT_IN_PIX] = outputRegister[k];
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++) {
+				#pragma HLS UNROLL
+					source[p][k+1+HIGHT_IN_PIX] = outputRegister[k];
+				}
 			}
 
-			for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++)
+			/* The engines work on their blocks of neurons in parallel, engine p on neuron n */
+			for(unsigned int g = 0; g < NUMBER_OF_NEURONS / NEURON_PARALLELISM; g++)
 			{
-//#pragma HLS UNROLL factor=4
 //#pragma HLS pipeline II=1 // x14 FF-LUT resources, 5x speedup
+				for(unsigned int p = 0; p < NEURON_PARALLELISM; p++)
+				{
+				#pragma HLS UNROLL
+					const unsigned int n = p * (NUMBER_OF_NEURONS / NEURON_PARALLELISM) + g;
+#if DIMENSION_OF_WEIGHTS == 1
+					DTYPE_WEIGHTS_WGI_bw *pWGI = WGI_bw + n * NUMBER_OF_INPUTS;
+					DTYPE_WEIGHTS_WGF_bw *pWGF = WGF_bw + n * NUMBER_OF_INPUTS;
+					DTYPE_WEIGHTS_WGO_bw *pWGO = WGO_bw + n * NUMBER_OF_INPUTS;
+					DTYPE_WEIGHTS_WCI_bw *pWCI = WCI_bw + n * NUMBER_OF_INPUTS;
+#else
+					DTYPE_WEIGHTS_WGI_bw *pWGI = WGI_bw_2d[n];
+					DTYPE_WEIGHTS_WGF_bw *pWGF = WGF_bw_2d[n];
+					DTYPE_WEIGHTS_WGO_bw *pWGO = WGO_bw_2d[n];
+					DTYPE_WEIGHTS_WCI_bw *pWCI = WCI_bw_2d[n];
+#endif
+					DTYPE_IN out_state, output;
+
+					HiddenLayerSingleMemoryCell_bw(source[p],
+												column,
+											    stateRegister[n],
+												pWGI,
+											    pWGF,
+											    pWGO,
+											    pWCI,
+											    WIP_bw[n],
+											    WFP_bw[n],
+											    WOP_bw[n],
+												&out_state,
+												&output);
+
+					stateRegister[n] = out_state;
+					outputRegister[n] = output;
+#if NEURON_PARALLELISM == 1
+					result.write(outputRegister[n]);
+#endif
+				}
+			}
+#if NEURON_PARALLELISM > 1
+			/* The outputs of the column go out in neuron order */
+			for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++) {
+#pragma HLS pipeline II=1
+				result.write(outputRegister[n]);
+			}
+#endif
+		}
+	}
+#endif /* INPUT_PROJECTION_STAGE == 1 */
+
+
+
+#if HIDDEN_LAYER_INTERLEAVE > 1
+	// The forward hidden layer of a group of HIDDEN_LAYER_INTERLEAVE images, see HIDDEN_LAYER_INTERLEAVE.
+	// Every column, each image being still active, goes out in neuron order on the stream of its image.
+	// OPS: HIDDEN_LAYER_INTERLEAVE x (200+COLSx(125+400+100x1038))
+	void Hidden_Layer_fw_interleaved(
+						  hls::stream<DTYPE_IMG> image[HIDDEN_LAYER_INTERLEAVE], 				// IN  // size: numberOfColumns[k] * HIGHT_IN_PIX
+						  short unsigned int numberOfColumns[HIDDEN_LAYER_INTERLEAVE],		// IN  //
+						  hls::stream<DTYPE_LAYERS> result[HIDDEN_LAYER_INTERLEAVE])		// OUT // size: numberOfColumns[k] * NUMBER_OF_NEURONS
+	{
+		DTYPE_IMG source[HIDDEN_LAYER_INTERLEAVE][NUMBER_OF_INPUTS];
+		DTYPE_LAYERS outputRegister[HIDDEN_LAYER_INTERLEAVE][NUMBER_OF_NEURONS];
+		DTYPE_IN stateRegister[HIDDEN_LAYER_INTERLEAVE][NUMBER_OF_NEURONS];
+		DTYPE_IN outputs[HIDDEN_LAYER_INTERLEAVE][4];
+		#pragma HLS ARRAY_PARTITION variable=outputs complete dim=0
+
+		unsigned int maxNumberOfColumns = 0;
+		for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+			maxNumberOfColumns = MAX(maxNumberOfColumns, (unsigned int)numberOfColumns[k]);
+			for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
+			#pragma HLS pipeline II=1
+				outputRegister[k][i] = 0.0;
+			}
+		}
+
+		for(unsigned int column = 0; column < maxNumberOfColumns; column++)
+		{
+			const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
+			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+			//Concatinate 1.0 + image + previous output
+			for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+				if (column < numberOfColumns[k]) {
+					source[k][0] = 1.0;
+					for(unsigned int i = 0; i < HIGHT_IN_PIX ; i++) {
+					#pragma HLS pipeline II=1
+						source[k][i+1] = image[k].read();
+					}
+					for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
+					#pragma HLS pipeline II=1
+						source[k][i+1+HIGHT_IN_PIX] = outputRegister[k][i];
+					}
+				}
+			}
+
+			for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++)
+			{
+#if DIMENSION_OF_WEIGHTS == 1
+				DTYPE_WEIGHTS_WGI_fw *pWGI = WGI_fw + n * NUMBER_OF_INPUTS;
+				DTYPE_WEIGHTS_WGF_fw *pWGF = WGF_fw + n * NUMBER_OF_INPUTS;
+				DTYPE_WEIGHTS_WGO_fw *pWGO = WGO_fw + n * NUMBER_OF_INPUTS;
+				DTYPE_WEIGHTS_WCI_fw *pWCI = WCI_fw + n * NUMBER_OF_INPUTS;
+#else
+				DTYPE_WEIGHTS_WGI_fw *pWGI = WGI_fw_2d[n];
+				DTYPE_WEIGHTS_WGF_fw *pWGF = WGF_fw_2d[n];
+				DTYPE_WEIGHTS_WGO_fw *pWGO = WGO_fw_2d[n];
+				DTYPE_WEIGHTS_WCI_fw *pWCI = WCI_fw_2d[n];
+#endif
+				DotVectorToVector126_four_fw_interleaved(source, pWGI, pWGF, pWGO, pWCI, outputs);
+
+				for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+					DTYPE_IN out_state, output;
+
+					/* An image whose columns are over is left as it is */
+					if (column < numberOfColumns[k]) {
+						MemoryCellGates(outputs[k], column, stateRegister[k][n],
+										(DTYPE_IN)WIP_fw[n], (DTYPE_IN)WFP_fw[n], (DTYPE_IN)WOP_fw[n],
+										&out_state, &output);
+						stateRegister[k][n] = out_state;
+						outputRegister[k][n] = output;
+					}
+				}
+			}
+
+			for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+				if (column < numberOfColumns[k]) {
+					for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++) {
+					#pragma HLS pipeline II=1
+						result[k].write(outputRegister[k][n]);
+					}
+				}
+			}
+		}
+	}
+
+
+	// The backward hidden layer of a group of HIDDEN_LAYER_INTERLEAVE images, see HIDDEN_LAYER_INTERLEAVE.
+	// Every column, each image being still active, goes out in neuron order on the stream of its image.
+	// OPS: HIDDEN_LAYER_INTERLEAVE x (200+COLSx(125+400+100x1038))
+	void Hidden_Layer_bw_interleaved(
+						  hls::stream<DTYPE_IMG> image[HIDDEN_LAYER_INTERLEAVE], 				// IN  // size: numberOfColumns[k] * HIGHT_IN_PIX
+						  short unsigned int numberOfColumns[HIDDEN_LAYER_INTERLEAVE],		// IN  //
+						  hls::stream<DTYPE_LAYERS> result[HIDDEN_LAYER_INTERLEAVE])		// OUT // size: numberOfColumns[k] * NUMBER_OF_NEURONS
+	{
+		DTYPE_IMG source[HIDDEN_LAYER_INTERLEAVE][NUMBER_OF_INPUTS];
+		DTYPE_LAYERS outputRegister[HIDDEN_LAYER_INTERLEAVE][NUMBER_OF_NEURONS];
+		DTYPE_IN stateRegister[HIDDEN_LAYER_INTERLEAVE][NUMBER_OF_NEURONS];
+		DTYPE_IN outputs[HIDDEN_LAYER_INTERLEAVE][4];
+		#pragma HLS ARRAY_PARTITION variable=outputs complete dim=0
+
+		unsigned int maxNumberOfColumns = 0;
+		for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+			maxNumberOfColumns = MAX(maxNumberOfColumns, (unsigned int)numberOfColumns[k]);
+			for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
+			#pragma HLS pipeline II=1
+				outputRegister[k][i] = 0.0;
+			}
+		}
+
+		for(unsigned int column = 0; column < maxNumberOfColumns; column++)
+		{
+			const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
+			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+			//Concatinate 1.0 + image + previous output
+			for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+				if (column < numberOfColumns[k]) {
+					source[k][0] = 1.0;
+					for(unsigned int i = 0; i < HIGHT_IN_PIX ; i++) {
+					#pragma HLS pipeline II=1
+						source[k][i+1] = image[k].read();
+					}
+					for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
+					#pragma HLS pipeline II=1
+						source[k][i+1+HIGHT_IN_PIX] = outputRegister[k][i];
+					}
+				}
+			}
+
+			for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++)
+			{
 #if DIMENSION_OF_WEIGHTS == 1
 				DTYPE_WEIGHTS_WGI_bw *pWGI = WGI_bw + n * NUMBER_OF_INPUTS;
 				DTYPE_WEIGHTS_WGF_bw *pWGF = WGF_bw + n * NUMBER_OF_INPUTS;
@@ -1004,29 +1936,34 @@ FILE *fp;
 				DTYPE_WEIGHTS_WGO_bw *pWGO = WGO_bw_2d[n];
 				DTYPE_WEIGHTS_WCI_bw *pWCI = WCI_bw_2d[n];
 #endif
-				DTYPE_IN out_state, output;
-
-				HiddenLayerSingleMemoryCell_bw(source,
-											column,
-										    stateRegister[n],
-											pWGI,
-										    pWGF,
-										    pWGO,
-										    pWCI,
-										    WIP_bw[n],
-										    WFP_bw[n],
-										    WOP_bw[n],
-											&out_state,
-											&output);
+				DotVectorToVector126_four_bw_interleaved(source, pWGI, pWGF, pWGO, pWCI, outputs);
+
+				for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+					DTYPE_IN out_state, output;
+
+					/* An image whose columns are over is left as it is */
+					if (column < numberOfColumns[k]) {
+						MemoryCellGates(outputs[k], column, stateRegister[k][n],
+										(DTYPE_IN)WIP_bw[n], (DTYPE_IN)WFP_bw[n], (DTYPE_IN)WOP_bw[n],
+										&out_state, &output);
+						stateRegister[k][n] = out_state;
+						outputRegister[k][n] = output;
+					}
+				}
+			}
 
-				stateRegister[n] = out_state;
-				outputRegister[n] = output;
-				result.write(outputRegister[n]);
+			for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++) {
+				if (column < numberOfColumns[k]) {
+					for(unsigned int n = 0; n < NUMBER_OF_NEURONS; n++) {
+					#pragma HLS pipeline II=1
+						result[k].write(outputRegister[k][n]);
+					}
+				}
 			}
 		}
 	}
 
-
+#endif /* HIDDEN_LAYER_INTERLEAVE > 1 */
 
 	void OLD_Hidden_Layer_bw(
 #ifdef INTERFACE_IS_STREAM
@@ -1180,198 +2117,363 @@ const int cyclic_factor_out = OUTPUT_LAYER_UNROLL_FACTOR;
 		DotVectorToVector201(W2, input_fw, input_bw, output);
 	}
 
+#if SOFTMAX_RECIPROCAL == 1
+	// The reciprocal of a positive softmax sum: 1/sum = recip * 2^-(*shift), recip in (0.5, 1]
+	// The leading one of the sum gives the shift and the mantissa m in [1, 2), whose leading fraction bits
+	// index recip_lut. A Newton step r*(2 - m*r) then doubles its 7 correct bits.
+	// OPS: 19+1+3
+	DTYPE_RECIP SoftmaxReciprocal(DTYPE_OUTPUT sum, int *shift)
+	{
+	#pragma HLS INLINE
+#ifdef FORMAT_IS_FLOAT
+		*shift = 0;
+		return 1.0f / sum;
+#else
+		const int width = DTYPE_OUTPUT::width;
+		const int fraction = DTYPE_OUTPUT::width - DTYPE_OUTPUT::iwidth;
+		ap_uint<width> bits = sum.range(width - 1, 0);
+		int msb = 0;
+
+		for(int i = 0; i < width; i++) {
+		#pragma HLS UNROLL
+			if (bits[i])
+				msb = i;
+		}
+
+		ap_ufixed<width, 1> m;
+		m.range(width - 1, 0) = bits << (width - 1 - msb);
+		const unsigned int index = m.range(width - 2, width - 1 - LUT_BITS_RECIP);
+		const DTYPE_RECIP r = recip_lut[index];
+
+		*shift = msb - fraction;
+		return (DTYPE_RECIP)(r * (2 - m * r));
+#endif
+	}
+#endif
+
+	// The output layer on a single column: the probabilities of the classes, reduced to what the CTC decoding needs
+	// OPS: 200+110x(800+5+1+4)+127
+	void OutputLayerColumn(DTYPE_LAYERS input_fw[NUMBER_OF_NEURONS],	// IN  // size: NUMBER_OF_NEURONS
+						   DTYPE_LAYERS input_bw[NUMBER_OF_NEURONS],	// IN  // size: NUMBER_OF_NEURONS
+						   hls::stream<column_argmax_t> &output)		// OUT // size: 1
+	{
+	  DTYPE_OUTPUT sum = 0.0;
+	  DTYPE_OUTPUT pOutput[NUMBER_OF_CLASSES];
+	  DTYPE_TRNLB probs[NUMBER_OF_CLASSES];
+	  #pragma HLS ARRAY_PARTITION variable=probs complete dim=1
+
+	  // Compute the function of each neuron of the output layer
+	  for(unsigned int cl = 0; cl < NUMBER_OF_CLASSES; cl++)
+	  {
+	  //#pragma HLS PIPELINE II=1 // -> splits huge memory to many huge memories, leading to insane bram utilization
+#if DIMENSION_OF_WEIGHTS == 1
+		DTYPE_WEIGHTS_W2 *pW2 = W2 + cl * (NUMBER_OF_NEURONS * 2 + 1);
+#else
+	    DTYPE_WEIGHTS_W2 *pW2 = W2_2d[cl];
+#endif
+	    OutputLayerSinlgleNeuron(pW2, input_fw, input_bw, &pOutput[cl]);
+	    // Softmax function
+	    #if TRIGF_APPROX == 0
+	    pOutput[cl] = (DTYPE_OUTPUT)expf((float)pOutput[cl]);
+	    #elif TRIGF_APPROX == 1
+	    pOutput[cl] = tiny_expf(pOutput[cl]);
+	    #elif TRIGF_APPROX == 2
+	    pOutput[cl] = expf_lookup(pOutput[cl]);//+expf_pwl(pOutput[cl]);
+	    #elif TRIGF_APPROX == 3
+	    pOutput[cl] = expf_pwl(pOutput[cl]);
+	    #endif
+
+	    //printf("pOutput[%u] = %f\n", cl, pOutput[cl]);
+
+	    sum += pOutput[cl];
+	  }
+#if SOFTMAX_RECIPROCAL == 1
+	  // A sum wrapped around to a negative value divides like its magnitude, then negates
+	  const bool negative = (sum < 0);
+	  int shift = 0;
+	  const DTYPE_RECIP recip = (sum != 0) ? SoftmaxReciprocal(negative ? (DTYPE_OUTPUT)-sum : sum, &shift) : (DTYPE_RECIP)1.0;
+	  for(unsigned int cl = 0; cl < NUMBER_OF_CLASSES; cl++) {
+	  #pragma HLS PIPELINE II=1
+#ifdef FORMAT_IS_FLOAT
+	    probs[cl] = negative ? -(pOutput[cl] * recip) : pOutput[cl] * recip;
+#else
+	    // Wide enough for the fraction bits of the product, whatever the shift
+	    ap_fixed<DTYPE_OUTPUT::width + DTYPE_RECIP::width + DTYPE_OUTPUT::iwidth, DTYPE_OUTPUT::iwidth + 1> scaled = pOutput[cl] * recip;
+	    if (shift >= 0)
+	  	  scaled >>= shift;
+	    else
+	  	  scaled <<= -shift;
+	    if (negative)
+	  	  probs[cl] = -scaled;
+	    else
+	  	  probs[cl] = scaled;
+#endif
+	  }
+#else
+	  for(unsigned int cl = 0; cl < NUMBER_OF_CLASSES; cl++) {
+	  #pragma HLS PIPELINE II=1
+	    if (sum != 0) // Fixed point seg.faluts when dividing by zero, i.e. bits shall allow any representation of accumulated sum
+	  	  probs[cl] = pOutput[cl] / sum;
+	    else
+	  	  probs[cl] = pOutput[cl];
+	  }
+#endif
+
+	  column_argmax_t column;
+	  column.blank = probs[0];
+	  column.label = ColumnArgmax(probs, &column.value);
+	  output.write(column);
+	}
+
+	// The columns of the output layer, in the order they are computed: step t of the hidden layers
+	// (numberOfColumns/2 <= t) completes column t, then column numberOfColumns-1-t unless it is the same one.
+	// Returns the number of columns completed by step t, 0 before the midpoint.
+	inline unsigned int OutputLayerColumnsAtStep(unsigned int t, unsigned int numberOfColumns, unsigned int cols[2])
+	{
+	  if (t < numberOfColumns / 2)
+		  return 0;
+	  cols[0] = t;
+	  cols[1] = numberOfColumns - 1 - t;
+	  return (cols[1] == t) ? 1 : 2;
+	}
+
+	// Step t of the output layer: consumes the outputs of step t of both hidden layers, then either keeps
+	// them (before the midpoint) or completes the columns of the step (see OutputLayerColumnsAtStep)
+	void OutputLayerStep(unsigned int t,					// IN  // The step
+						 unsigned int numberOfColumns,		// IN  //
+						 hls::stream<DTYPE_LAYERS> &input_fws,
+						 hls::stream<DTYPE_LAYERS> &input_bws,
+						 DTYPE_LAYERS early_fw[][NUMBER_OF_NEURONS],	// IN/OUT // The outputs of the steps before the midpoint
+						 DTYPE_LAYERS early_bw[][NUMBER_OF_NEURONS],	// IN/OUT //
+						 hls::stream<column_argmax_t> &output)			// OUT //
+	{
+	  DTYPE_LAYERS input_fw[NUMBER_OF_NEURONS];
+	  DTYPE_LAYERS input_bw[NUMBER_OF_NEURONS];
+
+	  for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++)
+	  {
+	  #pragma HLS pipeline II=1
+	    input_fw[i] = input_fws.read();
+	    input_bw[i] = input_bws.read();
+	  }
+
+	  unsigned int cols[2];
+	  const unsigned int n = OutputLayerColumnsAtStep(t, numberOfColumns, cols);
+	  if (n == 0) {
+	    for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++) {
+	    #pragma HLS pipeline II=1
+	      early_fw[t][i] = input_fw[i];
+	      early_bw[t][i] = input_bw[i];
+	    }
+	  }
+	  else if (n == 1) {
+	    // The middle column of an odd number of columns
+	    OutputLayerColumn(input_fw, input_bw, output);
+	  }
+	  else {
+	    // Column t, whose backward output came at step numberOfColumns-1-t, then the mirrored column
+	    OutputLayerColumn(input_fw, early_bw[cols[1]], output);
+	    OutputLayerColumn(early_fw[cols[1]], input_bw, output);
+	  }
+	}
+
+	// Column c needs the forward output of column c and the backward one of column c, i.e. the step c of
+	// Hidden_Layer_fw and the step numberOfColumns-1-c of Hidden_Layer_bw. Both streams are consumed a step
+	// at a time, so the hidden layers run side by side, and from the midpoint on every step completes the
+	// columns t and numberOfColumns-1-t (see OutputLayerColumnsAtStep). Only the outputs of the steps before
+	// the midpoint are kept: half a line of each direction.
 	// OPS:  = 732*201 COLSx(200+110x(800+5+1+4)) = 65367600
 	void Output_Layer(unsigned int numberOfColumns, // IN  //
-	          //float input_fw[MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_NEURONS],	// IN  // size: numberOfColumns * NUMBER_OF_NEURONS
-	          //float input_bw[MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_NEURONS],	// IN  // size: numberOfColumns * NUMBER_OF_NEURONS
 	          hls::stream<DTYPE_LAYERS> &input_fws,
 	          hls::stream<DTYPE_LAYERS> &input_bws,
-	          //float output[MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_CLASSES]) 	// OUT // size: numberOfColumns * NUMBER_OF_CLASSES
-	          hls::stream<DTYPE_TRNLB> &output
+	          hls::stream<column_argmax_t> &output	// OUT // size: numberOfColumns, in the order of OutputLayerColumnsAtStep
 	#if SHARED_MEM == 1
-	          ,DTYPE_LAYERS *input_bw)
+	          ,DTYPE_LAYERS *shared_bw)
 	#else
 	          )
 	#endif
 	  {
 	//#pragma HLS DATAFLOW
-	  DTYPE_OUTPUT sum;
-
-	  DTYPE_LAYERS input_fw[NUMBER_OF_NEURONS];
-
+	  // The outputs of the steps before the midpoint
+	  DTYPE_LAYERS early_fw[MAX_NUMBER_COLUMNS_TEST_SET / 2][NUMBER_OF_NEURONS];
 	#if SHARED_MEM == 0
-	  DTYPE_LAYERS input_bw[MAX_NUMBER_COLUMNS_TEST_SET][NUMBER_OF_NEURONS];
-
+	  DTYPE_LAYERS early_bw[MAX_NUMBER_COLUMNS_TEST_SET / 2][NUMBER_OF_NEURONS];
+	#else
+	  DTYPE_LAYERS (*early_bw)[NUMBER_OF_NEURONS] = (DTYPE_LAYERS (*)[NUMBER_OF_NEURONS])shared_bw;
 	#endif
 	  const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
 
-	  for(unsigned int  i = 0; i < numberOfColumns; i++)
-		#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
-		//#pragma HLS pipeline II=1
-	    for(unsigned int  j = 0; j < NUMBER_OF_NEURONS; j++) {
-	    input_bw[i][j] = input_bws.read();
-	  }
-
-	  // Compute the function of the output layer for each concatinated column
-	  for(unsigned int col = 0; col < numberOfColumns; col++)
+	  for(unsigned int t = 0; t < numberOfColumns; t++)
 	  {
 	  #pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+	    OutputLayerStep(t, numberOfColumns, input_fws, input_bws, early_fw, early_bw, output);
+	  }
+	}
 
-	    // pre-calculating bw address for relaxing timing closure (sub-mul-fetch)
-	    unsigned int input_bw_addr = (numberOfColumns - col - 1); //* NUMBER_OF_NEURONS;
-
-	    for(unsigned int i = 0; i < NUMBER_OF_NEURONS; i++)
-	    {
-	      input_fw[i] = input_fws.read();
-	      //input_bw[i] = input_bws.read();
-	    }
-
-	    sum = 0.0;
-	    DTYPE_LAYERS *pInput_fw  = input_fw;// + col * NUMBER_OF_NEURONS;
-	    //std::cout << "DEBUG: *pInput_bw:" << (numberOfColumns - col - 1) * NUMBER_OF_NEURONS << "\n";
-	    DTYPE_LAYERS *pInput_bw  = input_bw[input_bw_addr];
-	    //float *pOutput = output + col * NUMBER_OF_CLASSES;
-	    DTYPE_OUTPUT pOutput[NUMBER_OF_CLASSES];
-	    // Compute the function of each neuron of the output layer
-	    //DTYPE_WEIGHTS_W2 *pW2 = W2_local; // FIXME: huge memory
-	    //#pragma HLS RESOURCE variable=pW2 core=ROM_nP_BRAM
+#if HIDDEN_LAYER_INTERLEAVE > 1
+	// The output layer of a group of HIDDEN_LAYER_INTERLEAVE images: the images take a step each, in the
+	// order of Hidden_Layer_fw_interleaved and Hidden_Layer_bw_interleaved
+	void Output_Layer_interleaved(short unsigned int numberOfColumns[HIDDEN_LAYER_INTERLEAVE], // IN  //
+	          hls::stream<DTYPE_LAYERS> input_fws[HIDDEN_LAYER_INTERLEAVE],
+	          hls::stream<DTYPE_LAYERS> input_bws[HIDDEN_LAYER_INTERLEAVE],
+	          hls::stream<column_argmax_t> output[HIDDEN_LAYER_INTERLEAVE])	// OUT // size: numberOfColumns[k]
+	  {
+	  DTYPE_LAYERS early_fw[HIDDEN_LAYER_INTERLEAVE][MAX_NUMBER_COLUMNS_TEST_SET / 2][NUMBER_OF_NEURONS];
+	  DTYPE_LAYERS early_bw[HIDDEN_LAYER_INTERLEAVE][MAX_NUMBER_COLUMNS_TEST_SET / 2][NUMBER_OF_NEURONS];
+	  const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
 
+	  unsigned int maxNumberOfColumns = 0;
+	  for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++)
+	    maxNumberOfColumns = MAX(maxNumberOfColumns, (unsigned int)numberOfColumns[k]);
 
-	    for(unsigned int cl = 0; cl < NUMBER_OF_CLASSES; cl++)
-	    {
-	    //#pragma HLS PIPELINE II=1 // -> splits huge memory to many huge memories, leading to insane bram utilization
-#if DIMENSION_OF_WEIGHTS == 1
-		  DTYPE_WEIGHTS_W2 *pW2 = W2 + cl * (NUMBER_OF_NEURONS * 2 + 1);
-#else
-	      DTYPE_WEIGHTS_W2 *pW2 = W2_2d[cl];
-#endif
-	      OutputLayerSinlgleNeuron(pW2, pInput_fw, pInput_bw, &pOutput[cl]);
-	      // Softmax function
-	      #if TRIGF_APPROX == 0
-	      pOutput[cl] = (DTYPE_OUTPUT)expf((float)pOutput[cl]);
-	      #elif TRIGF_APPROX == 1
-	      pOutput[cl] = tiny_expf(pOutput[cl]);
-	      #elif TRIGF_APPROX == 2
-	      pOutput[cl] = expf_lookup(pOutput[cl]);//+expf_pwl(pOutput[cl]);
-		    #elif TRIGF_APPROX == 3
-	      pOutput[cl] = expf_pwl(pOutput[cl]);
-	      #endif
-
-	      //printf("pOutput[%u] = %f\n", cl, pOutput[cl]);
-
-	      sum += pOutput[cl];
-	    }
-	    DTYPE_TRNLB tmpdiv;
-	    for(unsigned int cl = 0; cl < NUMBER_OF_CLASSES; cl++) {
-	    #pragma HLS PIPELINE II=1
-	      if (sum != 0) // Fixed point seg.faluts when dividing by zero, i.e. bits shall allow any representation of accumulated sum
-	    	  tmpdiv = pOutput[cl] / sum;
-	      else
-	    	  tmpdiv = pOutput[cl];
-	      output.write(tmpdiv);
-
-	/*
-	      // DEBUGGING for host
-	      union {
-	          uint32_t t;
-	          float f;
-	          char b[sizeof(float)];
-	      } u;
-	        u.f = pOutput[cl];
-	        printf("DEBUG host: output[%u]=%08x\n", col*NUMBER_OF_CLASSES + cl, (unsigned int)u.t);
-	*/
-	    }
+	  for(unsigned int t = 0; t < maxNumberOfColumns; t++)
+	  {
+	  #pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+	    for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++)
+	      if (t < numberOfColumns[k])
+	        OutputLayerStep(t, numberOfColumns[k], input_fws[k], input_bws[k], early_fw[k], early_bw[k], output[k]);
 	  }
 	}
+#endif /* HIDDEN_LAYER_INTERLEAVE > 1 */
 
 
-	// Reconstruct a line from the labels
-	// OPS: 732x112x2=732*(5+10+7320*7) = 37518660
-void TranslateBack(
-					   unsigned int numberOfColumns, 	// IN  //
-					   //float input[MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_CLASSES], // IN  // size: numberOfColumns * NUMBER_OF_CLASSES
-					   hls::stream<DTYPE_TRNLB> &inputs,
-					   uint8_t output_ind[MAX_PREDICTED_STRING_LENGTH],
-					   uint8_t *str_len, // OUT //
-					   //float *input,
-					   DTYPE_TRNLB threshold  // IN  //
-					  #if SHARED_MEM == 1
-					  ,DTYPE_TRNLB *input)
-					  #else
-					  )
-					  #endif
+	// Stores the columns of step t of the output layer, reduced to what the decoding needs
+	inline void TranslateBackStep(unsigned int t,						// IN  // The step
+								  unsigned int numberOfColumns,			// IN  //
+								  hls::stream<column_argmax_t> &inputs,	// IN  //
+								  DTYPE_TRNLB blank[MAX_NUMBER_COLUMNS_TEST_SET],	// OUT //
+								  DTYPE_TRNLB value[MAX_NUMBER_COLUMNS_TEST_SET],	// OUT //
+								  uint8_t label[MAX_NUMBER_COLUMNS_TEST_SET])		// OUT //
+	{
+		unsigned int cols[2];
+		const unsigned int n = OutputLayerColumnsAtStep(t, numberOfColumns, cols);
+		for(unsigned int k = 0; k < n; k++) {
+		#pragma HLS PIPELINE II=1
+			const column_argmax_t column = inputs.read();
+			blank[cols[k]] = column.blank;
+			value[cols[k]] = column.value;
+			label[cols[k]] = column.label;
+		}
+	}
+
+	// Finds the segments of a line in a single pass over its columns, see TranslateBack
+	void TranslateBackSegments(unsigned int numberOfColumns,	// IN  //
+							   DTYPE_TRNLB blank[MAX_NUMBER_COLUMNS_TEST_SET],	// IN  //
+							   DTYPE_TRNLB value[MAX_NUMBER_COLUMNS_TEST_SET],	// IN  //
+							   uint8_t label[MAX_NUMBER_COLUMNS_TEST_SET],		// IN  //
+							   uint8_t output_ind[MAX_PREDICTED_STRING_LENGTH],	// OUT //
+							   uint8_t *str_len,				// OUT //
+							   DTYPE_TRNLB threshold)			// IN  //
 	{
-		unsigned int left_limit = 0, right_limit;
-		unsigned int offset, label;
 		const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
-		const int max_lat = MAX_NUMBER_COLUMNS_TEST_SET*NUMBER_OF_CLASSES;
 
 		*str_len=0;
 
-		#if SHARED_MEM == 0
-		DTYPE_TRNLB input[MAX_NUMBER_COLUMNS_TEST_SET][NUMBER_OF_CLASSES];
-		const int factor = NUMBER_OF_CLASSES;
-		//#pragma HLS ARRAY_RESHAPE variable=input cyclic factor=factor dim=1
-		#endif
-		for(unsigned int col = 0; col < numberOfColumns; col++)
-		#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
-			for(unsigned int cl = 0; cl < NUMBER_OF_CLASSES; cl++) {
-				input[col][cl] = inputs.read(); // read all steam but keep only columns for every 100 classes
-		}
+		// The running maximum of the segment since the last blank-to-symbol transition
+		DTYPE_TRNLB seg_value = 0;
+		uint8_t seg_label = 0;
+		bool seg_empty = true;
 
-		for(unsigned int col = 0; col < numberOfColumns-1; col++) // FIXME: check algorithmic validity of -1
+		/* 'col + 1' instead of 'numberOfColumns - 1' keeps empty slots (0 columns) of a partial batch from wrapping around */
+		for(unsigned int col = 0; col + 1 < numberOfColumns; col++) // FIXME: check algorithmic validity of -1
 		{
-			DTYPE_TRNLB rep1 = input[col][0];
-			DTYPE_TRNLB rep2 = input[(col + 1)][0];
+		#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+		#pragma HLS PIPELINE II=1
+			DTYPE_TRNLB rep1 = blank[col];
+			DTYPE_TRNLB rep2 = blank[col + 1];
+
+			// The first column of the largest probability wins, as in a scan of the whole segment
+			if (seg_empty || (seg_value < value[col])) {
+				seg_value = value[col];
+				seg_label = label[col];
+				seg_empty = false;
+			}
 
-			#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
 			if (rep1 > threshold && rep2 < threshold ) {
-				left_limit = (col + 1) * NUMBER_OF_CLASSES;
+				seg_empty = true;
+				seg_label = 0;
 			}
 			else if (rep1 < threshold && rep2 > threshold )
 			{
-				right_limit = (col + 1) * NUMBER_OF_CLASSES;
-				offset = max_element_syn_test(input, left_limit, right_limit);
-				//std::cout << MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_CLASSES << " right_limit: " << right_limit
-				//		<< "(" << right_limit/NUMBER_OF_CLASSES << ") left_limit: " << left_limit
-				//		<< "(" << left_limit/NUMBER_OF_CLASSES << ") diff: " << right_limit-left_limit
-				//		<< "(" << (right_limit-left_limit)/NUMBER_OF_CLASSES << ") offset " << offset << "\n";
-				label = offset - (offset / NUMBER_OF_CLASSES) * NUMBER_OF_CLASSES;
 				if (*str_len < MAX_PREDICTED_STRING_LENGTH) {
-					output_ind[*str_len] = (uint8_t)label;
+					output_ind[*str_len] = seg_label;
 					*str_len = *str_len + 1;
 				}
 			}
 		}
 	}
 
+	// Reconstruct a line from the labels
+	// A segment is a run of columns whose blank probability falls below the threshold, and its label the class
+	// of the largest probability within it. Each column comes reduced by the output layer to its blank probability
+	// and its most probable class, so only these are kept, then the segments are found in a single pass that keeps
+	// the running maximum of the current one.
+	// OPS: 732x4
+void TranslateBack(
+					   unsigned int numberOfColumns, 	// IN  //
+					   hls::stream<column_argmax_t> &inputs, // IN  // size: numberOfColumns, in the order of Output_Layer
+					   uint8_t output_ind[MAX_PREDICTED_STRING_LENGTH],
+					   uint8_t *str_len, // OUT //
+					   DTYPE_TRNLB threshold)  // IN  //
+	{
+		const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
 
-#endif /* EMULATING_IO_SINGLE_KERNEL_BLSTM */
+		DTYPE_TRNLB blank[MAX_NUMBER_COLUMNS_TEST_SET];
+		DTYPE_TRNLB value[MAX_NUMBER_COLUMNS_TEST_SET];
+		uint8_t label[MAX_NUMBER_COLUMNS_TEST_SET];
 
-	double LevenshteinDistance(const std::string& s1, const std::string& s2)
+		// The columns come in the order of Output_Layer
+		for(unsigned int t = numberOfColumns / 2; t < numberOfColumns; t++) {
+		#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+			TranslateBackStep(t, numberOfColumns, inputs, blank, value, label);
+		}
+
+		TranslateBackSegments(numberOfColumns, blank, value, label, output_ind, str_len, threshold);
+	}
+
+#if HIDDEN_LAYER_INTERLEAVE > 1
+	// Reconstruct the lines of a group of HIDDEN_LAYER_INTERLEAVE images, see TranslateBack
+	void TranslateBack_interleaved(
+					   short unsigned int numberOfColumns[HIDDEN_LAYER_INTERLEAVE], 	// IN  //
+					   hls::stream<column_argmax_t> inputs[HIDDEN_LAYER_INTERLEAVE], // IN  // in the order of Output_Layer_interleaved
+					   uint8_t output_ind[HIDDEN_LAYER_INTERLEAVE][MAX_PREDICTED_STRING_LENGTH],
+					   uint8_t str_len[HIDDEN_LAYER_INTERLEAVE], // OUT //
+					   DTYPE_TRNLB threshold)  // IN  //
 	{
-		const std::size_t len1 = s1.size(), len2 = s2.size();
-		std::vector<unsigned int> col(len2+1), prevCol(len2+1);
+		const int max_col_test_set = MAX_NUMBER_COLUMNS_TEST_SET;
 
-		for (unsigned int i = 0; i < prevCol.size(); i++)
-			prevCol[i] = i;
-		for (unsigned int i = 0; i < len1; i++)
-		{
-			col[0] = i+1;
-			for (unsigned int j = 0; j < len2; j++)
-			{
-				//col[j+1] = std::min({ prevCol[1 + j] + 1, col[j] + 1, prevCol[j] + (s1[i]==s2[j] ? 0 : 1) });
+		DTYPE_TRNLB blank[HIDDEN_LAYER_INTERLEAVE][MAX_NUMBER_COLUMNS_TEST_SET];
+		DTYPE_TRNLB value[HIDDEN_LAYER_INTERLEAVE][MAX_NUMBER_COLUMNS_TEST_SET];
+		uint8_t label[HIDDEN_LAYER_INTERLEAVE][MAX_NUMBER_COLUMNS_TEST_SET];
 
-				col[j+1] = std::min(prevCol[1 + j] + 1, std::min(col[j] + 1, prevCol[j] + (s1[i]==s2[j] ? 0 : 1)));
-			}
+		unsigned int maxNumberOfColumns = 0;
+		for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++)
+			maxNumberOfColumns = MAX(maxNumberOfColumns, (unsigned int)numberOfColumns[k]);
 
-			col.swap(prevCol);
+		for(unsigned int t = 0; t < maxNumberOfColumns; t++) {
+		#pragma HLS LOOP_TRIPCOUNT min=1 max=max_col_test_set
+			for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++)
+				if (t < numberOfColumns[k])
+					TranslateBackStep(t, numberOfColumns[k], inputs[k], blank[k], value[k], label[k]);
 		}
+
+		for(unsigned int k = 0; k < HIDDEN_LAYER_INTERLEAVE; k++)
+			TranslateBackSegments(numberOfColumns[k], blank[k], value[k], label[k], output_ind[k], &str_len[k], threshold);
+	}
+#endif /* HIDDEN_LAYER_INTERLEAVE > 1 */
+
+
+#endif /* EMULATING_IO_SINGLE_KERNEL_BLSTM */
+
+	double LevenshteinDistance(const std::string& s1, const std::string& s2)
+	{
+		/* Bit-parallel, see levenshtein.h */
+		const unsigned int distance = levenshtein_bitpar(s1.data(), s1.size(), s2.data(), s2.size());
 		#if PROFILE
-			std::cout << prevCol[len2] << std::endl;
+			std::cout << distance << std::endl;
 		#endif
 
-		return (double)prevCol[len2] / (double)s2.size();
+		return (double)distance / (double)s2.size();
 	}
 
 	double LevenshteinDistanceCStyle(const char *s1, const char *s2)
@@ -1453,7 +2555,7 @@ void TranslateBack(
 
 		hls::stream<DTYPE_LAYERS> pOutputFromtHiddenLayer_fw("pOutputFromtHiddenLayer_fw"); // MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_NEURONS
 		hls::stream<DTYPE_LAYERS> pOutputFromtHiddenLayer_bw("pOutputFromtHiddenLayer_bw"); // MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_NEURONS
-		hls::stream<DTYPE_TRNLB> poutputFromOutputLayer("poutputFromOutputLayer"); //MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_CLASSES
+		hls::stream<column_argmax_t> poutputFromOutputLayer("poutputFromOutputLayer"); //MAX_NUMBER_COLUMNS_TEST_SET
 
 		const int stream_size = STREAM_KERNEL_SIZE_IN;
 		#pragma HLS STREAM variable=pOutputFromtHiddenLayer_fw depth=stream_size dim=1
@@ -1501,12 +2603,7 @@ void TranslateBack(
 				      poutputFromOutputLayer,
 					  vecPredictedStringInd,
 					  str_len,
-					  0.7
-					  #if SHARED_MEM == 1
-					  ,shared_mem);
-					  #else
-					  );
-					  #endif
+					  0.7);
 /**/
 #endif /* EMULATING_IO_SINGLE_KERNEL_BLSTM */
 		//std::cout << "str_len = " << str_len << std::endl;
@@ -1519,6 +2616,56 @@ void TranslateBack(
 	}
 
 
+#if HIDDEN_LAYER_INTERLEAVE > 1
+	//====================================================================================================================================================================================================================
+	// Single Instance of BLSTM for a group of HIDDEN_LAYER_INTERLEAVE images sharing its engines
+	//====================================================================================================================================================================================================================
+	void Interleaved_Kernel_BLSTM(
+			hls::stream<DTYPE_IMG> image_fw[HIDDEN_LAYER_INTERLEAVE],
+			hls::stream<DTYPE_IMG> image_bw[HIDDEN_LAYER_INTERLEAVE],
+			short unsigned int numberOfColumnsVec[HIDDEN_LAYER_INTERLEAVE],
+			uint8_t vecPredictedStringInd[HIDDEN_LAYER_INTERLEAVE][MAX_PREDICTED_STRING_LENGTH],
+			uint8_t vecPredictedStringLen[HIDDEN_LAYER_INTERLEAVE]) {
+
+#pragma HLS DATAFLOW
+#pragma HLS INLINE off
+
+		hls::stream<DTYPE_LAYERS> pOutputFromtHiddenLayer_fw[HIDDEN_LAYER_INTERLEAVE];
+		hls::stream<DTYPE_LAYERS> pOutputFromtHiddenLayer_bw[HIDDEN_LAYER_INTERLEAVE];
+		hls::stream<column_argmax_t> poutputFromOutputLayer[HIDDEN_LAYER_INTERLEAVE];
+
+		const int stream_size = STREAM_KERNEL_SIZE_IN;
+		#pragma HLS STREAM variable=pOutputFromtHiddenLayer_fw depth=stream_size dim=1
+		#pragma HLS STREAM variable=pOutputFromtHiddenLayer_bw depth=stream_size dim=1
+
+		const int stream_size_out = STREAM_KERNEL_SIZE_OUT;
+		#pragma HLS STREAM variable=poutputFromOutputLayer depth=stream_size_out dim=1
+
+		Hidden_Layer_fw_interleaved(image_fw,
+					 numberOfColumnsVec,
+					 pOutputFromtHiddenLayer_fw);
+
+		// Backward direction
+		Hidden_Layer_bw_interleaved(image_bw,
+					 numberOfColumnsVec,
+					 pOutputFromtHiddenLayer_bw);
+
+		// CTC - Output Layer
+		Output_Layer_interleaved(numberOfColumnsVec,
+					 pOutputFromtHiddenLayer_fw,
+					 pOutputFromtHiddenLayer_bw,
+					 poutputFromOutputLayer);
+
+		// Return the predicted strings
+		TranslateBack_interleaved(numberOfColumnsVec,
+				      poutputFromOutputLayer,
+					  vecPredictedStringInd,
+					  vecPredictedStringLen,
+					  0.7);
+	}
+#endif /* HIDDEN_LAYER_INTERLEAVE > 1 */
+
+
 	//====================================================================================================================================================================================================================
 	// Single Instance of BLSTM
 	//====================================================================================================================================================================================================================
@@ -1617,6 +2764,21 @@ void TranslateBack(
 		 * */
 		assert (HW_THREADS_PER_ACTION <= ACC_CALLS_PER_ACTION);
 
+#if HIDDEN_LAYER_INTERLEAVE > 1
+		/* A physical accelerator infers HIDDEN_LAYER_INTERLEAVE images at once */
+		for(unsigned int g = 0; g < ACC_CALLS_PER_ACTION / HIDDEN_LAYER_INTERLEAVE; g++) {
+		#pragma HLS UNROLL
+		const int limit = (HW_THREADS_PER_ACTION + HIDDEN_LAYER_INTERLEAVE - 1) / HIDDEN_LAYER_INTERLEAVE;
+		#pragma HLS allocation instances=Interleaved_Kernel_BLSTM limit=limit function
+
+			Interleaved_Kernel_BLSTM(
+				image_fw + g * HIDDEN_LAYER_INTERLEAVE,
+				image_bw + g * HIDDEN_LAYER_INTERLEAVE,
+				numberOfColumnsVec + g * HIDDEN_LAYER_INTERLEAVE,
+				vecPredictedStringInd + g * HIDDEN_LAYER_INTERLEAVE,
+				vecPredictedStringLen + g * HIDDEN_LAYER_INTERLEAVE);
+		}
+#else /* HIDDEN_LAYER_INTERLEAVE > 1 */
 		for(unsigned int i = 0; i < ACC_CALLS_PER_ACTION; i++) {
 		//#pragma HLS PIPELINE II=1
 		#pragma HLS UNROLL
@@ -1635,6 +2797,7 @@ void TranslateBack(
 				vecPredictedStringInd[i],
 				&vecPredictedStringLen[i]);
 		}
+#endif /* HIDDEN_LAYER_INTERLEAVE > 1 */
 	}
 
 
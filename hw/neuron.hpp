@@ -278,6 +278,13 @@
 	// Connectionist Temporal Classification Layer (CTC layer)
 	//====================================================================================================================================================================================================================
 
+	// A column of the output layer, as much of it as the CTC decoding needs
+	typedef struct {
+		DTYPE_TRNLB blank;	// the probability of the blank (class 0)
+		DTYPE_TRNLB value;	// the largest probability
+		uint8_t label;		// the first class of the largest probability
+	} column_argmax_t;
+
 	// The dot product corresponding to a single neuron of the output layer operating on an concatinated output from the forward and the bakward hidden layers
 	inline DTYPE_OUTPUT DotVectorToVector201(DTYPE *W2,		// IN  // size: NUMBER_OF_NEURONS * 2 + 1
 									                         DTYPE_LAYERS *input_fw, 	// IN  // size: NUMBER_OF_NEURONS
@@ -301,7 +308,7 @@
 	//void TranslateBack(Alphabet &alphabet, unsigned int numberOfColumns, float *input, std::string &output, float threshold = 0.7);
 	void TranslateBack( unsigned int numberOfColumns,
 								//float *input,
-								hls::stream<DTYPE_TRNLB> &inputs,
+								hls::stream<column_argmax_t> &inputs,
 								uint8_t output_ind[MAX_PREDICTED_STRING_LENGTH],
 								uint8_t *str_len,
 								DTYPE_TRNLB threshold = 0.7);
@@ -311,6 +318,14 @@
 
 
 
+	//====================================================================================================================================================================================================================
+	// Runtime-loadable model
+	//====================================================================================================================================================================================================================
+
+	// Replaces a single weight of the model, index being its position in a JOB_LOAD_WEIGHTS job (see NUMBER_OF_WEIGHTS)
+	void Store_Weight(unsigned int index, float weight);
+
+
 	//====================================================================================================================================================================================================================
 	// Single Instance of BLSTM
 	//====================================================================================================================================================================================================================
@@ -328,6 +343,19 @@
 	);
 
 
+#if HIDDEN_LAYER_INTERLEAVE > 1
+	//====================================================================================================================================================================================================================
+	// Single Instance of BLSTM for a group of HIDDEN_LAYER_INTERLEAVE images sharing its engines
+	//====================================================================================================================================================================================================================
+	void Interleaved_Kernel_BLSTM(
+			hls::stream<DTYPE_IMG> image_fw[HIDDEN_LAYER_INTERLEAVE],
+			hls::stream<DTYPE_IMG> image_bw[HIDDEN_LAYER_INTERLEAVE],
+			short unsigned int numberOfColumnsVec[HIDDEN_LAYER_INTERLEAVE],
+			uint8_t vecPredictedStringInd[HIDDEN_LAYER_INTERLEAVE][MAX_PREDICTED_STRING_LENGTH],
+			uint8_t vecPredictedStringLen[HIDDEN_LAYER_INTERLEAVE]);
+#endif /* HIDDEN_LAYER_INTERLEAVE > 1 */
+
+
   //====================================================================================================================================================================================================================
 	// Single Instance of BLSTM with splitted image feeding
 	//====================================================================================================================================================================================================================
@@ -36,6 +36,9 @@ extern "C" {
 //#define BLSTM_ACTION_TYPE 0x00000101
 #define BLSTM_ACTION_TYPE 0x10141008
 
+/* The card DRAM the action addresses (JOB_COPY, JOB_INFER_BATCH) */
+#define CARD_DRAM_SIZE		(1 * 1024 *1024 * 1024)
+
 /* Enumerator holding accelerator status and error information.
  * The 2-LSB bytes are keeping status information.
  * The 2-MSB bytes are keeping error information.
@@ -51,10 +54,47 @@ typedef enum {						   /* Bits  :   Value   */
 	ACC_EXECUTED			= 0x10,    /* 7:0   : 0001 0000 */
 	ACC_DATA_RETURNED		= 0x20,    /* 7:0   : 0010 0000 */
 	PROCESS_EXECUTED		= 0x40,    /* 7:0   : 0100 0000 */
+	ACC_WEIGHTS_LOADED		= 0x80,    /* 7:0   : 1000 0000 */
+	ACC_BATCH_EXECUTED		= 0x100,   /* 15:8  : 0000 0001 */
 	ACC_ERR_MAX_RET			= 0x10000, /* 23:16 : 0000 0001 */
 	ACC_ERR_SIZE_MISMATCH	= 0x20000, /* 23:16 : 0000 0010 */
+	ACC_ERR_WEIGHTS_SIZE	= 0x40000, /* 23:16 : 0000 0100 */
+	ACC_ERR_DESC			= 0x80000, /* 23:16 : 0000 1000 */
 } status_t;
 
+/* The error bits of the status, 31:16 */
+#define ACC_ERR_MASK 0xffff0000
+
+/* Enumerator holding the kind of job of an action call.
+ * JOB_INFER        : the input is the images of the action, the output their labels.
+ * JOB_LOAD_WEIGHTS : the input is a model of NUMBER_OF_WEIGHTS floats (see common_def.h), which
+ *                    replaces the weights in the on-chip RAMs for the inference jobs to come.
+ *                    Nothing is written to the output.
+ * JOB_COPY         : copies in.size bytes from the input to the output, each one in host or card
+ *                    DRAM after its type. Stages a batch in card DRAM and fetches its results back.
+ * JOB_INFER_BATCH  : the input is a table of in.size / 64 descriptors in card DRAM (blstm_desc_t),
+ *                    each one an inference job on images in card DRAM. Their labels go to card
+ *                    DRAM and their lengths and status back into the descriptors. The errors of
+ *                    every descriptor are reported on the call too, which then fails.
+ * */
+typedef enum {
+	JOB_INFER				= 0x0,
+	JOB_LOAD_WEIGHTS		= 0x1,
+	JOB_COPY				= 0x2,
+	JOB_INFER_BATCH			= 0x3,
+} jobtype_t;
+
+/* Enumerator holding the layout of the input pixels in memory.
+ * IN_FMT_FLOAT32 : 4 bytes per pixel, i.e. 16 pixels per 512b transfer. The pixel is either
+ *                  a float, or a DTYPE_IMG on the 1st byte (IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1).
+ * IN_FMT_PACKED8 : 1 byte per pixel, i.e. 64 pixels per 512b transfer. The pixel is the raw
+ *                  8-bit DTYPE_IMG (ap_fixed<8,4>), casted in host (IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1).
+ * */
+typedef enum {
+	IN_FMT_FLOAT32			= 0x0,
+	IN_FMT_PACKED8			= 0x1,
+} informat_t;
+
 typedef struct simgcols {
         /* Keep the struct aligned to 64 bits */
 		uint16_t cols[8];
@@ -70,8 +110,23 @@ typedef struct blstm_job {
 	//uint64_t pad;
 	struct simgcols imgcols;	/* struct holding the columns of every image */
 	struct simgcols imgstrlen;	/* struct holding the returned strlen of every image */
+	uint32_t informat;			/* in:   4 bytes - the layout of input pixels (informat_t) */
+	uint32_t jobtype;			/* in:   4 bytes - the kind of job (jobtype_t) */
 } blstm_job_t;
 
+/* The descriptor of an action of a batch (JOB_INFER_BATCH): the in/out fields of blstm_job_t for
+ * images and labels in card DRAM. Its 64 bytes are a single 512b transfer. */
+typedef struct blstm_desc {
+	uint64_t in_addr;			/* in:   8 bytes - card DRAM address of the pixels of the images */
+	uint64_t out_addr;			/* in:   8 bytes - card DRAM address of their labels */
+	uint32_t in_size;			/* in:   4 bytes - the size of the pixels in bytes */
+	uint32_t informat;			/* in:   4 bytes - the layout of input pixels (informat_t) */
+	struct simgcols imgcols;	/* in:  16 bytes - the columns of every image */
+	struct simgcols imgstrlen;	/* out: 16 bytes - the returned strlen of every image */
+	uint32_t status;			/* out:  4 bytes - the status of accelerator on this action */
+	uint32_t pad;
+} blstm_desc_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,10 +38,24 @@
 #define MAX_NUMBER_COLUMNS_TEST_SET 732
 #define BYPASS_COLUMNS 0
 
+/*!
+ * \def NUMBER_OF_WEIGHTS
+ * The number of weights of the model, as a JOB_LOAD_WEIGHTS job carries them (one float each): the
+ * forward hidden layer (WGI, WGF, WGO, WCI, then the peepholes WIP, WFP, WOP), the backward one in the
+ * same order, then the output layer (W2). Every text model (data/model/model_fw.txt, model_bw.txt)
+ * holds a hidden layer in this order, followed by W2.
+ * */
+#define NUMBER_OF_WEIGHTS_HIDDEN (NUMBER_OF_NEURONS * NUMBER_OF_INPUTS * 4 + NUMBER_OF_NEURONS * 3)
+#define NUMBER_OF_WEIGHTS_OUTPUT (NUMBER_OF_CLASSES * (NUMBER_OF_NEURONS * 2 + 1))
+#define NUMBER_OF_WEIGHTS (NUMBER_OF_WEIGHTS_HIDDEN * 2 + NUMBER_OF_WEIGHTS_OUTPUT)
+
 /*!
  * \def MAX_NUMBER_IMAGES_TEST_SET
- * The maximum number of input images. If the input folder provided has more
- *  images than this number, then they will be ignored.
+ * The maximum number of input images of the HLS testbench (hw/action_blstm_tb.cpp),
+ * which keeps statically sized arrays. If the input folder provided has more
+ * images than this number, then they will be ignored by the testbench.
+ * The host application (sw/snap_blstm.cpp) sizes its structures at runtime
+ * and is not limited by this value.
  * */
 #define MAX_NUMBER_IMAGES_TEST_SET 1 //3402 dataset size
 
@@ -49,7 +63,8 @@
  * \def ACC_CALLS_PER_ACTION
  * The number of accelerator calls on a single action execution.
  * This number defines how many data streams shall be input to IP from host memory (and results back)
- * It should be less or equal to MAX_NUMBER_IMAGES_TEST_SET. Valid for simulation and synthesis.
+ * The number of images does not have to be a multiple of it: the last action of the host may be
+ * partial, with 0 columns on the unused slots. Valid for simulation and synthesis.
  * */
 #define ACC_CALLS_PER_ACTION 1
 
@@ -141,6 +156,7 @@ typedef float DTYPE_IMG;
 typedef float DTYPE_LAYERS;
 #endif /* SHARED_MEM == 1 */
 typedef float DTYPE_OUTPUT;
+typedef float DTYPE_RECIP;
 
 #else /* FORMAT_IS_FLOAT */
 
@@ -178,6 +194,9 @@ typedef float DTYPE_OUTPUT;
 // The width of the output layer
 //typedef ap_fixed<24,19> : 97.6336%% // DSE ap_fixed<9,6>:96.2442%, ap_fixed<16,12>:97.231%, ap_fixed<17,13>:97.5215, ap_fixed<18,14>: 97.5939%, ap_fixed<19,15>:97.6135%
 #define DTYPE_OUTPUT ap_fixed<19,15>
+
+// The mantissa of the reciprocal of the softmax sum, in (0.5, 1] (SOFTMAX_RECIPROCAL)
+#define DTYPE_RECIP ap_ufixed<16,1>
 #endif /* __cplusplus */
 
 #endif /* FORMAT_IS_FLOAT */
@@ -221,6 +240,16 @@ typedef float DTYPE_OUTPUT;
  */
 #define TRIGF_APPROX 2
 
+/*!
+ * \def SOFTMAX_RECIPROCAL
+ * How the output layer normalizes the exponentials of a column by their sum
+ * 0 : A division per class
+ * 1 : A single reciprocal of the sum per column, from a look-up table (recip_lut) refined by
+ *     a Newton step, then a multiplication per class. On data/samples_sm: 98.5042%, the same
+ *     labels as 0.
+ * */
+#define SOFTMAX_RECIPROCAL 0
+
 /*!
  * \def MAX_PREDICTED_STRING_LENGTH
  * Choose the length of the predicted string
@@ -267,10 +296,51 @@ typedef float DTYPE_OUTPUT;
  * */
 #define INPUT_LAYER_UNROLL_FACTOR 9 // 9
 
+/*!
+ * \def NEURON_PARALLELISM
+ * The number of LSTM cell engines of each hidden layer. Engine p computes the neurons
+ * p * NUMBER_OF_NEURONS / NEURON_PARALLELISM ... (p+1) * NUMBER_OF_NEURONS / NEURON_PARALLELISM - 1
+ * of every column, out of its own block of the weight ROMs, the peephole weights and the cell
+ * states. A column then takes ~NUMBER_OF_NEURONS / NEURON_PARALLELISM cell latencies (~NUMBER_OF_INPUTS
+ * cycles each) instead of NUMBER_OF_NEURONS, plus NUMBER_OF_NEURONS cycles to stream the outputs out
+ * in neuron order. In return the cell datapath (4 multipliers and the activation LUTs) is instantiated
+ * NEURON_PARALLELISM times per layer, and the weight ROMs, same in total size, are split in as many
+ * banks (below one BRAM per bank they move to LUTRAM). It shall divide NUMBER_OF_NEURONS.
+ * The labels are the same for any value. Valid only for synthesis.
+ * */
+#define NEURON_PARALLELISM 1
+
+/*!
+ * \def HIDDEN_LAYER_INTERLEAVE
+ * The number of images whose recurrences share a hidden layer engine of each direction. Within an
+ * image the columns are serial, column t+1 needing all the outputs of column t, so the accumulations
+ * of the dot products of a cell wait on each other. With HIDDEN_LAYER_INTERLEAVE > 1 the engine cycles
+ * through the images instead, input after input, keeping a cell state and an output register per image:
+ * every weight is read once for all of them and an accumulator is revisited every HIDDEN_LAYER_INTERLEAVE
+ * cycles. The group of images then takes about as long as its longest image, out of the weight ROMs and
+ * the cell datapath of a single one. It shall divide ACC_CALLS_PER_ACTION, with INTERFACE_IS_STREAM,
+ * MANY_STREAMS_FOR_MANY_ACCS and NEURON_PARALLELISM 1. The labels are the same for any value.
+ * */
+#define HIDDEN_LAYER_INTERLEAVE 1
+
+/*!
+ * \def INPUT_PROJECTION_STAGE
+ * 1 splits each hidden layer (Hidden_Layer_fw/bw) in two dataflow stages. Out of the NUMBER_OF_INPUTS
+ * inputs of a cell only the NUMBER_OF_NEURONS outputs of the previous column are recurrent: the input
+ * projection stage computes the dot products of the bias and the HIGHT_IN_PIX pixels of column t+1 while
+ * the recurrence stage goes on with column t, from these partial sums over the recurrent inputs only.
+ * The critical path of a cell is then NUMBER_OF_NEURONS MACs per gate instead of NUMBER_OF_INPUTS, for
+ * a FIFO of a column of partial sums (4 * NUMBER_OF_NEURONS) and a copy of the weights of the
+ * non-recurrent inputs (hw/model_projection.h) in ROMs of the projection stage, so that the two stages
+ * share no memory. The sums are accumulated in the same order, so the labels are the same. It does not
+ * apply to the hidden layers of HIDDEN_LAYER_INTERLEAVE > 1. Not synthesized yet, hence off by default.
+ * */
+#define INPUT_PROJECTION_STAGE 0
+
 
 #define FRACT_BITS 4
 #define FLOAT2FIXED(x) ((int)((x) * (1 << FRACT_BITS)))
-#define FIXED2FLOAT(x) (((float)(x)) / (1 << FRACT_BITS
+#define FIXED2FLOAT(x) (((float)(x)) / (1 << FRACT_BITS))
 
 /*!
  * \def IMG_FLOAT_TO_FIXED_CASTING_IN_CPU
@@ -279,6 +349,8 @@ typedef float DTYPE_OUTPUT;
  * do the casting in CPU. It results in higher latency comparing to do the
  * casting in FPGA. However it is a workaround with Vivado_HLS 2017.4 issue that
  * does not generate functional RTL on float-to-fixed casting.
+ * It is required by the dense input format (IN_FMT_PACKED8), where the host sends
+ * one byte per pixel instead of a 4-byte float slot.
  * */
 #define IMG_FLOAT_TO_FIXED_CASTING_IN_CPU 1
 
@@ -319,7 +391,7 @@ enum log_level_t {
 #else
 #define STREAM_ACTION_SIZE_IN MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX
 #define STREAM_KERNEL_SIZE_IN MAX_NUMBER_COLUMNS_TEST_SET * NUMBER_OF_NEURONS
-#define STREAM_KERNEL_SIZE_OUT MAX_PREDICTED_STRING_LENGTH * NUMBER_OF_CLASSES
+#define STREAM_KERNEL_SIZE_OUT MAX_NUMBER_COLUMNS_TEST_SET
 #endif
 
 
@@ -0,0 +1,142 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file levenshtein.h
+ * @brief Bit-parallel edit distance (Myers 1999, in the blocked formulation of Hyyro 2003),
+ * shared by the host code and the testbenches for the accuracy of the predicted strings.
+ * The shorter string is encoded as bit-vectors of 64 rows, one machine word per block, and
+ * every character of the longer one advances all blocks at once. Strings longer than
+ * LEV_MAX_WORDS blocks fall back to the textbook O(n*m) DP. C++ only (the DP fallback
+ * allocates its column with new[] beyond LEV_DP_COLUMN bytes).
+ * */
+
+#ifndef __LEVENSHTEIN_H__
+#define __LEVENSHTEIN_H__
+
+#include <stdint.h>
+#include <string.h>
+
+/*!
+ * \def LEV_MAX_WORDS
+ * The maximum number of 64-bit blocks of the bit-parallel edit distance, i.e. it covers strings
+ * of up to 64 * LEV_MAX_WORDS bytes. The Peq table lives on the stack: 256 * LEV_MAX_WORDS words.
+ * */
+#define LEV_MAX_WORDS 8
+
+/* One column of the textbook DP, for strings beyond LEV_MAX_WORDS blocks */
+#define LEV_DP_COLUMN 512
+
+/**
+ * @brief Edit distance by the textbook DP over the columns of the shorter string, keeping one
+ * column on the stack (or on the heap when the shorter string exceeds LEV_DP_COLUMN).
+ */
+static inline unsigned int levenshtein_dp(const unsigned char *p, size_t m, const unsigned char *t, size_t n)
+{
+	unsigned int stack_col[LEV_DP_COLUMN + 1];
+	unsigned int *col = (m < LEV_DP_COLUMN) ? stack_col : new unsigned int[m + 1];
+	unsigned int d;
+
+	for (size_t i = 0; i <= m; i++)
+		col[i] = (unsigned int)i;
+	for (size_t j = 0; j < n; j++) {
+		unsigned int diag = col[0];
+		col[0] = (unsigned int)(j + 1);
+		for (size_t i = 1; i <= m; i++) {
+			unsigned int up = col[i];
+			unsigned int v = diag + (p[i-1] == t[j] ? 0 : 1);
+			if (up + 1 < v) v = up + 1;
+			if (col[i-1] + 1 < v) v = col[i-1] + 1;
+			col[i] = v;
+			diag = up;
+		}
+	}
+	d = col[m];
+	if (col != stack_col)
+		delete[] col;
+	return d;
+}
+
+/**
+ * @brief The edit distance between s1 and s2, compared byte by byte (as the DP it replaces).
+ * @param s1 The 1st string.
+ * @param len1 The length of s1 in bytes.
+ * @param s2 The 2nd string.
+ * @param len2 The length of s2 in bytes.
+ * @return The number of insertions, deletions and substitutions turning s1 into s2.
+ */
+static inline unsigned int levenshtein_bitpar(const char *s1, size_t len1, const char *s2, size_t len2)
+{
+	/* The pattern (bit-vector rows) is the shorter string, the text is scanned once */
+	const unsigned char *p = (const unsigned char *)((len1 <= len2) ? s1 : s2);
+	const unsigned char *t = (const unsigned char *)((len1 <= len2) ? s2 : s1);
+	const size_t m = (len1 <= len2) ? len1 : len2;
+	const size_t n = (len1 <= len2) ? len2 : len1;
+
+	if (m == 0)
+		return (unsigned int)n;
+
+	const size_t words = (m + 63) / 64;
+	if (words > LEV_MAX_WORDS)
+		return levenshtein_dp(p, m, t, n);
+
+	uint64_t peq[256][LEV_MAX_WORDS];
+	uint64_t pv[LEV_MAX_WORDS], mv[LEV_MAX_WORDS];
+	/* Row m is the last row of the DP: its bit in the last block scores the distance */
+	const uint64_t last = 1ull << ((m - 1) % 64);
+	unsigned int score = (unsigned int)m;
+
+	for (unsigned int c = 0; c < 256; c++)
+		memset(peq[c], 0, words * sizeof(uint64_t));
+	for (size_t i = 0; i < m; i++)
+		peq[p[i]][i / 64] |= 1ull << (i % 64);
+	for (size_t b = 0; b < words; b++) {
+		pv[b] = ~0ull;
+		mv[b] = 0;
+	}
+
+	for (size_t j = 0; j < n; j++) {
+		const uint64_t *eqs = peq[t[j]];
+		/* Horizontal delta entering the top of the block: +1 for the first row of the DP */
+		int hin = 1;
+		for (size_t b = 0; b < words; b++) {
+			const uint64_t hneg = (hin < 0) ? 1 : 0;
+			const uint64_t hpos = (hin > 0) ? 1 : 0;
+			uint64_t eq = eqs[b];
+			const uint64_t xv = eq | mv[b];
+			eq |= hneg;
+			const uint64_t xh = (((eq & pv[b]) + pv[b]) ^ pv[b]) | eq;
+			uint64_t ph = mv[b] | ~(xh | pv[b]);
+			uint64_t mh = pv[b] & xh;
+			const uint64_t out = (b == words - 1) ? last : (1ull << 63);
+			int hout = 0;
+			if (ph & out)
+				hout = 1;
+			else if (mh & out)
+				hout = -1;
+			ph = (ph << 1) | hpos;
+			mh = (mh << 1) | hneg;
+			pv[b] = mh | ~(xv | ph);
+			mv[b] = ph & xv;
+			hin = hout;
+		}
+		score += hin;
+	}
+	return score;
+}
+
+#endif /* __LEVENSHTEIN_H__ */
@@ -48,6 +48,78 @@
 #include "./include/neuron.h"
 
 
+/* The card DRAM of the software action (JOB_COPY, JOB_INFER_BATCH), allocated on first use */
+static uint8_t *card_dram = NULL;
+
+/**
+ * @brief The address of a buffer of a job in the memory of the process, be it in host DRAM or in the
+ * card DRAM of the software action.
+ * @param addr The address of the buffer in its memory.
+ * @param type The type of its memory (SNAP_ADDRTYPE_HOST_DRAM, SNAP_ADDRTYPE_CARD_DRAM).
+ * @param size The size of the buffer in bytes.
+ * @return The address, NULL if the buffer is not within the card DRAM.
+ */
+static void *job_addr(uint64_t addr, uint16_t type, uint64_t size)
+{
+	if (type != SNAP_ADDRTYPE_CARD_DRAM)
+		return (void *)(unsigned long)addr;
+	if (addr + size > CARD_DRAM_SIZE)
+		return NULL;
+	if (card_dram == NULL)
+		card_dram = (uint8_t *)calloc(1, CARD_DRAM_SIZE);
+	return (card_dram != NULL) ? card_dram + addr : NULL;
+}
+
+static int action_main(struct snap_sim_action *action,
+		       void *job, unsigned int job_len);
+
+/**
+ * @brief Walks the table of descriptors of a batch (JOB_INFER_BATCH), every descriptor an inference
+ * job on images in card DRAM, see blstm_desc_t.
+ * @param action The SNAP action struct.
+ * @param js The batch job.
+ * @return 0 upon success, -EINVAL if the table is not within the card DRAM, -EIO if any action
+ * failed. The errors of every action are reported on its descriptor and on the batch.
+ */
+static int action_batch(struct snap_sim_action *action, struct blstm_job *js)
+{
+	blstm_desc_t *descs = (blstm_desc_t *)job_addr(js->in.addr, js->in.type, js->in.size);
+	struct blstm_job djob;
+	uint32_t errors = 0;
+	unsigned int d;
+
+	if ((js->in.type != SNAP_ADDRTYPE_CARD_DRAM) || (descs == NULL) || (js->in.size % sizeof(blstm_desc_t) != 0)) {
+		js->status = ACC_ERR_DESC;
+		return -EINVAL;
+	}
+	for (d = 0; d < js->in.size / sizeof(blstm_desc_t); d++) {
+		const uint32_t size_out = ACC_CALLS_PER_ACTION * MAX_PREDICTED_STRING_LENGTH * sizeof(uint32_t);
+		void *in = job_addr(descs[d].in_addr, SNAP_ADDRTYPE_CARD_DRAM, descs[d].in_size);
+		void *out = job_addr(descs[d].out_addr, SNAP_ADDRTYPE_CARD_DRAM, size_out);
+
+		memset(&djob, 0, sizeof(djob));
+		if ((in == NULL) || (out == NULL))
+			djob.status = ACC_ERR_DESC;
+		else {
+			djob.in.addr = (unsigned long)in;
+			djob.in.size = descs[d].in_size;
+			djob.out.addr = (unsigned long)out;
+			djob.out.size = size_out;
+			djob.informat = descs[d].informat;
+			djob.jobtype = JOB_INFER;
+			djob.imgcols = descs[d].imgcols;
+			action_main(action, &djob, sizeof(djob));
+		}
+		descs[d].imgstrlen = djob.imgstrlen;
+		descs[d].status = djob.status;
+		errors |= djob.status & ACC_ERR_MASK;
+	}
+	js->axitrans_in = d;
+	js->status |= errors | ACC_BATCH_EXECUTED | PROCESS_EXECUTED;
+	/* A batch fails with any of its actions, as in hardware */
+	return errors ? -EIO : 0;
+}
+
 static int mmio_write32(struct snap_card *card,
 			uint64_t offs, uint32_t data)
 {
@@ -79,6 +151,7 @@ static int action_main(struct snap_sim_action *action,
 {
 	struct blstm_job *js = (struct blstm_job *)job;
 	float *src;
+	int8_t *src_raw;
 	unsigned int *dst;
 	size_t len_in, len_out;
 	unsigned int i, j, k;
@@ -91,6 +164,41 @@ static int action_main(struct snap_sim_action *action,
 
 	//__hexdump(stderr, js, sizeof(*js));
 
+	/* A model to load, nothing to infer: the weights hold for the next jobs */
+	if (js->jobtype == JOB_LOAD_WEIGHTS) {
+		if (js->in.size != NUMBER_OF_WEIGHTS * sizeof(float)) {
+			js->status = ACC_ERR_WEIGHTS_SIZE;
+			action->job.retc = SNAP_RETC_FAILURE;
+			return 0;
+		}
+		LoadWeights((const float *)(unsigned long)js->in.addr);
+		js->status = ACC_WEIGHTS_LOADED | PROCESS_EXECUTED;
+		action->job.retc = SNAP_RETC_SUCCESS;
+		return 0;
+	}
+
+	/* Staging a batch in card DRAM, or fetching its results back */
+	if (js->jobtype == JOB_COPY) {
+		void *in = job_addr(js->in.addr, js->in.type, js->in.size);
+		void *out = job_addr(js->out.addr, js->out.type, js->in.size);
+		if ((in == NULL) || (out == NULL)) {
+			js->status = ACC_ERR_SIZE_MISMATCH;
+			action->job.retc = SNAP_RETC_FAILURE;
+			return 0;
+		}
+		memcpy(out, in, js->in.size);
+		js->status = PROCESS_EXECUTED;
+		action->job.retc = SNAP_RETC_SUCCESS;
+		return 0;
+	}
+
+	/* A batch of actions staged in card DRAM */
+	if (js->jobtype == JOB_INFER_BATCH) {
+		js->status = 0;
+		action->job.retc = (action_batch(action, js) == 0) ? SNAP_RETC_SUCCESS : SNAP_RETC_FAILURE;
+		return 0;
+	}
+
     const unsigned int imgs_cols_regs_on_AXIl = sizeof(js->imgcols.cols)/sizeof(js->imgcols.cols[0]);
     uint16_t cols[8];
     unsigned int imgs = 0, size_from_cols_reg = 0;
@@ -105,6 +213,7 @@ static int action_main(struct snap_sim_action *action,
 	len_out = js->out.size;
 	dst = (unsigned int *)(unsigned long)js->out.addr;
 	src = (float *)(unsigned long)js->in.addr;
+	src_raw = (int8_t *)(unsigned long)js->in.addr;
 
 	act_trace("   copy %p to %p %ld bytes\n", src, dst, len_in);
 
@@ -139,8 +248,17 @@ static int action_main(struct snap_sim_action *action,
 
 	total_pixels_in_action = 0;
   for ( i = 0; i < imgs; i++ ) {
+#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
+		/* Pixels are raw DTYPE_IMG bytes, either dense (IN_FMT_PACKED8) or on the 1st byte of a float slot */
+		const unsigned int stride = (js->informat == IN_FMT_PACKED8) ? 1 : sizeof(float);
+		for ( j = 0; j < (cols[i] * HIGHT_IN_PIX); j++ ) {
+			image_fw[i][j] = FIXED2FLOAT(src_raw[(total_pixels_in_action + j) * stride]);
+			image_bw[i][j] = FIXED2FLOAT(src_raw[(total_pixels_in_action + cols[i] * HIGHT_IN_PIX + j) * stride]);
+		}
+#else
 		memcpy(image_fw[i], src + total_pixels_in_action, (cols[i] * HIGHT_IN_PIX) * sizeof(float));
 		memcpy(image_bw[i], src + total_pixels_in_action + cols[i] * HIGHT_IN_PIX , (cols[i] * HIGHT_IN_PIX) * sizeof(float));
+#endif
 		//for ( j = 0; j < (cols[i] * HIGHT_IN_PIX); j++ ) {
 		//	image_fw[i][j] = src[total_pixels_in_action + j];
 		//	image_bw[i][j] = src[total_pixels_in_action + cols[i] * HIGHT_IN_PIX + j];
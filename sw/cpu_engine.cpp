@@ -0,0 +1,68 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file cpu_engine.cpp
+ * @brief In-process calls of the software BLSTM engine (neuron.c), see cpu_engine.hpp.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+/* The C++ types of common_def.h (ap_fixed) must not get C linkage: include it ahead of neuron.h */
+#include "../include/common_def.h"
+extern "C" {
+#include "include/neuron.h"
+}
+
+#include "cpu_engine.hpp"
+#include "quantize.hpp"
+
+unsigned int cpu_engine_run(const float *image_fw, const float *image_bw, unsigned int cols, unsigned int *labels)
+{
+	const unsigned int pixels = cols * HIGHT_IN_PIX;
+	/* Single_Kernel_BLSTM() takes non-const images, and the quantized ones when casting in CPU */
+	std::vector<float> fw(image_fw, image_fw + pixels), bw(image_bw, image_bw + pixels);
+	unsigned int len = 0;
+
+#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
+	/* The pixels as the software action receives them: DTYPE_IMG, back to float */
+	std::vector<int8_t> raw(2 * pixels);
+	quantize_img_packed(image_fw, raw.data(), pixels);
+	quantize_img_packed(image_bw, raw.data() + pixels, pixels);
+	for (unsigned int j = 0; j < pixels; j++) {
+		fw[j] = FIXED2FLOAT(raw[j]);
+		bw[j] = FIXED2FLOAT(raw[pixels + j]);
+	}
+#endif
+
+	Single_Kernel_BLSTM(fw.data(), bw.data(), cols, labels, &len);
+
+	/* As the software action: the labels stay within the alphabet */
+	for (unsigned int l = 0; l < len; l++)
+		labels[l] = std::min(labels[l], (unsigned int)(NUMBER_OF_CLASSES - 1));
+	return len;
+}
+
+void cpu_engine_load(const float *weights)
+{
+	LoadWeights(weights);
+}
@@ -0,0 +1,46 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file cpu_engine.hpp
+ * @brief The software BLSTM engine of neuron.c, called in-process by snap_blstm so that host
+ * threads can infer images alongside the cards (option -H). It sees the pixels exactly as the
+ * software action does: quantized to DTYPE_IMG when IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1.
+ */
+
+#ifndef CPU_ENGINE_HPP
+#define CPU_ENGINE_HPP
+
+/**
+ * @brief Infer one image on the calling thread. Thread-safe.
+ * @param image_fw The forward image, cols * HIGHT_IN_PIX pixels.
+ * @param image_bw The backward image, cols * HIGHT_IN_PIX pixels.
+ * @param cols The number of columns of the image.
+ * @param labels The predicted labels, room for MAX_PREDICTED_STRING_LENGTH.
+ * @return The number of predicted labels.
+ */
+unsigned int cpu_engine_run(const float *image_fw, const float *image_bw, unsigned int cols, unsigned int *labels);
+
+/**
+ * @brief Replace the model of the engine, as a JOB_LOAD_WEIGHTS job does on a card. Not thread-safe:
+ * no image shall be inferred meanwhile.
+ * @param weights The NUMBER_OF_WEIGHTS weights of the job (see model_blob.hpp).
+ */
+void cpu_engine_load(const float *weights);
+
+#endif /* CPU_ENGINE_HPP */
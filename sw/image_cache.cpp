@@ -0,0 +1,220 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file image_cache.cpp
+ * @brief On-disk cache of the parsed images, see image_cache.hpp.
+ *
+ * Entries are written to a temporary file and renamed, so that concurrent runs and threads
+ * never see a partial entry.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "../include/common_def.h"
+
+#include "image_cache.hpp"
+#include "quantize.hpp"
+
+#define CACHE_MAGIC 0x43494c42	/* "BLIC" */
+#define CACHE_VERSION 1
+
+/* The layout of the columns of an entry */
+#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
+#define CACHE_LAYOUT_DTYPE_IMG 1
+#define CACHE_PIXEL_SIZE sizeof(int8_t)
+#else
+#define CACHE_LAYOUT_DTYPE_IMG 0
+#define CACHE_PIXEL_SIZE sizeof(float)
+#endif
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t layout;	/* CACHE_LAYOUT_DTYPE_IMG */
+	uint32_t fract_bits;	/* FRACT_BITS of the raw DTYPE_IMG bytes */
+	uint32_t rows;		/* HIGHT_IN_PIX */
+	uint32_t cols;
+	uint64_t size;		/* of the image file */
+	int64_t mtime_ns;
+	uint64_t hash;		/* of the content of the image file */
+	uint32_t path_len;	/* the path of the image file follows the header */
+	uint32_t reserved;
+} cache_header_t;
+
+/* 64-bit hash, a word at a time (not meant to resist collisions on purpose) */
+static uint64_t cache_hash(const uint8_t *data, size_t len)
+{
+	uint64_t h = 0xcbf29ce484222325ull ^ len;
+	size_t k = 0;
+
+	for (; k + 8 <= len; k += 8) {
+		uint64_t w;
+		memcpy(&w, data + k, sizeof(w));
+		h = (h ^ w) * 0x9e3779b97f4a7c15ull;
+		h ^= h >> 29;
+	}
+	for (; k < len; k++)
+		h = (h ^ data[k]) * 0x100000001b3ull;
+	h ^= h >> 32;
+	return h;
+}
+
+ImageCache::ImageCache() : hits(0), misses(0)
+{
+}
+
+ImageCache::~ImageCache()
+{
+}
+
+int ImageCache::Init(const char *dir)
+{
+	this->dir = dir;
+	if ((mkdir(dir, 0755) != 0) && (errno != EEXIST)) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot create the image cache %s: %s\n", dir, strerror(errno));
+		return -ENODEV;
+	}
+	return 0;
+}
+
+std::string ImageCache::Entry(const std::string &fname) const
+{
+	char name[32];
+
+	snprintf(name, sizeof(name), "/%016llx.img",
+			(unsigned long long)cache_hash((const uint8_t *)fname.data(), fname.size()));
+	return dir + name;
+}
+
+bool ImageCache::Lookup(const std::string &fname, image_key_t &key, std::vector<float> &pixels, unsigned int &cols)
+{
+	std::vector<uint8_t> data;
+	cache_header_t header;
+	struct stat st;
+	FILE *fp;
+
+	key.fname = fname;
+	key.valid = false;
+	misses++;
+
+	/* The identity of the image file, from its metadata and content */
+	if (stat(fname.c_str(), &st) != 0)
+		return false;
+	key.size = st.st_size;
+	key.mtime_ns = (int64_t)st.st_mtim.tv_sec * 1000000000ll + st.st_mtim.tv_nsec;
+	fp = fopen(fname.c_str(), "rb");
+	if (!fp)
+		return false;
+	data.resize(key.size);
+	const size_t n = fread(data.data(), 1, data.size(), fp);
+	fclose(fp);
+	if (n != data.size())
+		return false;
+	key.hash = cache_hash(data.data(), data.size());
+	key.valid = true;
+
+	fp = fopen(Entry(fname).c_str(), "rb");
+	if (!fp)
+		return false;
+	bool hit = (fread(&header, sizeof(header), 1, fp) == 1) &&
+			(header.magic == CACHE_MAGIC) && (header.version == CACHE_VERSION) &&
+			(header.layout == CACHE_LAYOUT_DTYPE_IMG) && (header.fract_bits == FRACT_BITS) &&
+			(header.rows == HIGHT_IN_PIX) && (header.size == key.size) &&
+			(header.mtime_ns == key.mtime_ns) && (header.hash == key.hash) &&
+			(header.path_len == fname.size());
+	if (hit) {
+		std::string path(header.path_len, '\0');
+		const size_t pixels_n = (size_t)header.cols * HIGHT_IN_PIX;
+		data.resize(pixels_n * CACHE_PIXEL_SIZE);
+		hit = (fread(&path[0], 1, path.size(), fp) == path.size()) && (path == fname) &&
+				(fread(data.data(), 1, data.size(), fp) == data.size());
+		if (hit) {
+			cols = header.cols;
+			pixels.resize(pixels_n);
+#if CACHE_LAYOUT_DTYPE_IMG
+			for (size_t p = 0; p < pixels_n; p++)
+				pixels[p] = FIXED2FLOAT((int8_t)data[p]);
+#else
+			memcpy(pixels.data(), data.data(), data.size());
+#endif
+		}
+	}
+	fclose(fp);
+
+	if (hit) {
+		misses--;
+		hits++;
+	}
+	return hit;
+}
+
+void ImageCache::Store(const image_key_t &key, const float *pixels, unsigned int cols)
+{
+	const size_t pixels_n = (size_t)cols * HIGHT_IN_PIX;
+	const std::string entry = Entry(key.fname);
+	std::string tmp = entry + ".XXXXXX";
+	cache_header_t header;
+
+	if (!key.valid)
+		return;
+
+	memset(&header, 0, sizeof(header));
+	header.magic = CACHE_MAGIC;
+	header.version = CACHE_VERSION;
+	header.layout = CACHE_LAYOUT_DTYPE_IMG;
+	header.fract_bits = FRACT_BITS;
+	header.rows = HIGHT_IN_PIX;
+	header.cols = cols;
+	header.size = key.size;
+	header.mtime_ns = key.mtime_ns;
+	header.hash = key.hash;
+	header.path_len = key.fname.size();
+
+	const int fd = mkstemp(&tmp[0]);
+	if (fd < 0)
+		return;
+	FILE *fp = fdopen(fd, "wb");
+	if (!fp) {
+		close(fd);
+		unlink(tmp.c_str());
+		return;
+	}
+
+	bool ok = (fwrite(&header, sizeof(header), 1, fp) == 1) &&
+			(fwrite(key.fname.data(), 1, key.fname.size(), fp) == key.fname.size());
+#if CACHE_LAYOUT_DTYPE_IMG
+	std::vector<int8_t> raw(pixels_n);
+	quantize_img_packed(pixels, raw.data(), pixels_n);
+	ok = ok && (fwrite(raw.data(), 1, raw.size(), fp) == raw.size());
+#else
+	ok = ok && (fwrite(pixels, sizeof(float), pixels_n, fp) == pixels_n);
+#endif
+	ok = (fclose(fp) == 0) && ok;
+
+	if (!ok || (rename(tmp.c_str(), entry.c_str()) != 0)) {
+		if (DEBUG_LEVEL >= LOG_WARNING) fprintf(stderr, "WARNING: Cannot write the image cache entry %s: %s\n",
+				entry.c_str(), strerror(errno));
+		unlink(tmp.c_str());
+	}
+}
@@ -0,0 +1,79 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file image_cache.hpp
+ * @brief On-disk cache of the parsed images of snap_blstm (option -K), so that repeated runs
+ * over the same dataset skip parsing. An entry is named after the path of its image and holds
+ * the size, mtime and a 64-bit hash of the content of the image file, followed by its columns:
+ * the raw DTYPE_IMG bytes when IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1 (lossless, as every consumer
+ * quantizes the pixels anyway), floats otherwise. An entry which does not match its image file
+ * in all of these, or was written by a build of another layout, is a miss and gets rewritten.
+ */
+
+#ifndef IMAGE_CACHE_HPP
+#define IMAGE_CACHE_HPP
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <atomic>
+
+/** The identity of an image file, from ImageCache::Lookup() for ImageCache::Store() */
+typedef struct {
+	std::string fname;
+	uint64_t size;
+	int64_t mtime_ns;
+	uint64_t hash;
+	bool valid;
+} image_key_t;
+
+	//=================================================================================================================
+	// IMAGE CACHE
+	//=================================================================================================================
+
+	class ImageCache
+	{
+		public:
+
+		ImageCache();
+		~ImageCache();
+
+		// Uses (and creates if needed) the directory dir. 0 upon success.
+		int Init(const char *dir);
+
+		// The columns of an image file, column after column of HIGHT_IN_PIX, if cached. Thread-safe.
+		bool Lookup(const std::string &fname, image_key_t &key, std::vector<float> &pixels, unsigned int &cols);
+
+		// Caches the columns of the image file of key. Thread-safe, failures only cost the entry.
+		void Store(const image_key_t &key, const float *pixels, unsigned int cols);
+
+		std::atomic<unsigned int> hits;
+		std::atomic<unsigned int> misses;
+
+		protected:
+
+		private:
+
+		std::string Entry(const std::string &fname) const;
+
+		std::string dir;
+	};
+
+#endif /* IMAGE_CACHE_HPP */
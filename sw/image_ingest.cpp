@@ -0,0 +1,599 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file image_ingest.cpp
+ * @brief Decoding and normalization of the line images, see image_ingest.hpp.
+ *
+ * img2txt.py scales the pixels g to g / max, inverts them and normalizes by mean and standard
+ * deviation. Scaling and inversion cancel out in the normalization: a pixel becomes
+ * (mean(g) - g) / std(g), clipped. The mean and variance come exactly from the integer
+ * histogram, and as a pixel has 256 values, they are normalized once per image into a table
+ * in double precision (the float64 of the script) and then looked up while transposing.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+
+#include "../include/common_def.h"
+
+#include "image_ingest.hpp"
+
+/* Upper bound of the decoded size of a PNG, against corrupt headers */
+#define INGEST_MAX_PIXELS (1 << 26)
+
+static int read_file(const std::string &fname, std::vector<uint8_t> &data, size_t max)
+{
+	FILE *fp = fopen(fname.c_str(), "rb");
+	uint8_t chunk[65536];
+	size_t n;
+
+	if (!fp) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot open file %s: %s\n", fname.c_str(), strerror(errno));
+		return -EIO;
+	}
+	data.clear();
+	while ((data.size() < max) && ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0))
+		data.insert(data.end(), chunk, chunk + n);
+	fclose(fp);
+	if (data.size() > max)
+		data.resize(max);
+	return 0;
+}
+
+//=================================================================================================================
+// NORMALIZATION
+//=================================================================================================================
+
+void ingest_normalize(const uint8_t *gray, unsigned int cols, float *pixels)
+{
+	const uint64_t n = (uint64_t)cols * HIGHT_IN_PIX;
+	uint64_t hist[256] = { 0 };
+	uint64_t sum = 0;
+	double var = 0.0;
+	float lut[256];
+
+	for (uint64_t p = 0; p < n; p++)
+		hist[gray[p]]++;
+	for (unsigned int g = 0; g < 256; g++)
+		sum += hist[g] * g;
+
+	/* Two passes over the histogram, the population variance as numpy's std */
+	const double mean = (double)sum / (double)n;
+	for (unsigned int g = 0; g < 256; g++)
+		var += (double)hist[g] * ((double)g - mean) * ((double)g - mean);
+	var /= (double)n;
+	/* A blank image has no deviation: its pixels all become 0 */
+	const double inv_std = (var > 0.0) ? 1.0 / sqrt(var) : 0.0;
+	for (unsigned int g = 0; g < 256; g++) {
+		double v = (mean - (double)g) * inv_std;
+		v = (v < INGEST_MIN_CLIP) ? INGEST_MIN_CLIP : ((v > INGEST_MAX_CLIP) ? INGEST_MAX_CLIP : v);
+		lut[g] = (float)v;
+	}
+
+	for (unsigned int col = 0; col < cols; col++)
+		for (unsigned int row = 0; row < HIGHT_IN_PIX; row++)
+			pixels[col * HIGHT_IN_PIX + row] = lut[gray[row * cols + col]];
+}
+
+//=================================================================================================================
+// PGM
+//=================================================================================================================
+
+/* The next header field of a PGM, skipping white space and comments */
+static int pgm_field(const std::vector<uint8_t> &data, size_t &pos, unsigned int &value)
+{
+	while (pos < data.size()) {
+		if (data[pos] == '#')
+			while ((pos < data.size()) && (data[pos] != '\n'))
+				pos++;
+		else if ((data[pos] == ' ') || (data[pos] == '\t') || (data[pos] == '\r') || (data[pos] == '\n'))
+			pos++;
+		else
+			break;
+	}
+	if ((pos >= data.size()) || (data[pos] < '0') || (data[pos] > '9'))
+		return -EINVAL;
+	value = 0;
+	while ((pos < data.size()) && (data[pos] >= '0') && (data[pos] <= '9') && (value < 100000000))
+		value = value * 10 + (data[pos++] - '0');
+	return 0;
+}
+
+static int pgm_header(const std::vector<uint8_t> &data, size_t &pos, unsigned int &width, unsigned int &height, unsigned int &maxval)
+{
+	pos = 2;
+	if ((data.size() < 2) || (data[0] != 'P') || ((data[1] != '5') && (data[1] != '2')))
+		return -EINVAL;
+	if (pgm_field(data, pos, width) || pgm_field(data, pos, height) || pgm_field(data, pos, maxval))
+		return -EINVAL;
+	/* A single white space ends the header of a binary PGM */
+	pos++;
+	return ((maxval > 0) && (maxval < 256)) ? 0 : -EINVAL;
+}
+
+static int pgm_decode(const std::vector<uint8_t> &data, std::vector<uint8_t> &gray, unsigned int &width, unsigned int &height)
+{
+	unsigned int maxval, value;
+	size_t pos;
+
+	if (pgm_header(data, pos, width, height, maxval))
+		return -EINVAL;
+	if ((uint64_t)width * height > INGEST_MAX_PIXELS)
+		return -EINVAL;
+	gray.resize((size_t)width * height);
+	if (data[1] == '5') {
+		if (pos + gray.size() > data.size())
+			return -EINVAL;
+		memcpy(gray.data(), &data[pos], gray.size());
+	}
+	else {
+		for (size_t p = 0; p < gray.size(); p++) {
+			if (pgm_field(data, pos, value) || (value > maxval))
+				return -EINVAL;
+			gray[p] = (uint8_t)value;
+		}
+	}
+	return 0;
+}
+
+//=================================================================================================================
+// PNG
+//=================================================================================================================
+
+/* Inflate (RFC 1951) with canonical Huffman codes, after Mark Adler's puff.c */
+#define INF_MAXBITS 15
+
+struct inflate_state {
+	const uint8_t *src;
+	size_t len;
+	size_t pos;
+	uint32_t bitbuf;
+	unsigned int bitcnt;
+	int error;
+	std::vector<uint8_t> *out;
+};
+
+struct huffman {
+	short count[INF_MAXBITS + 1];
+	short symbol[288];
+};
+
+static unsigned int inf_bits(struct inflate_state *s, unsigned int need)
+{
+	uint32_t val = s->bitbuf;
+
+	while (s->bitcnt < need) {
+		if (s->pos >= s->len) {
+			s->error = 1;
+			return 0;
+		}
+		val |= (uint32_t)s->src[s->pos++] << s->bitcnt;
+		s->bitcnt += 8;
+	}
+	s->bitbuf = val >> need;
+	s->bitcnt -= need;
+	return val & ((1u << need) - 1);
+}
+
+static int inf_decode(struct inflate_state *s, const struct huffman *h)
+{
+	int code = 0, first = 0, index = 0;
+
+	for (unsigned int len = 1; len <= INF_MAXBITS; len++) {
+		code |= inf_bits(s, 1);
+		const int count = h->count[len];
+		if (code - count < first)
+			return h->symbol[index + (code - first)];
+		index += count;
+		first += count;
+		first <<= 1;
+		code <<= 1;
+	}
+	s->error = 1;
+	return 0;
+}
+
+/* Builds a code from its lengths. Incomplete codes are allowed, over-subscribed ones are not */
+static int inf_construct(struct huffman *h, const short *length, unsigned int n)
+{
+	short offs[INF_MAXBITS + 1];
+	int left = 1;
+
+	memset(h->count, 0, sizeof(h->count));
+	for (unsigned int symbol = 0; symbol < n; symbol++)
+		h->count[length[symbol]]++;
+	for (unsigned int len = 1; len <= INF_MAXBITS; len++) {
+		left <<= 1;
+		left -= h->count[len];
+		if (left < 0)
+			return -EINVAL;
+	}
+	offs[1] = 0;
+	for (unsigned int len = 1; len < INF_MAXBITS; len++)
+		offs[len + 1] = offs[len] + h->count[len];
+	for (unsigned int symbol = 0; symbol < n; symbol++)
+		if (length[symbol] != 0)
+			h->symbol[offs[length[symbol]]++] = symbol;
+	return 0;
+}
+
+static int inf_codes(struct inflate_state *s, const struct huffman *lencode, const struct huffman *distcode)
+{
+	static const short lbase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+			35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	static const short lext[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+			3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	static const short dbase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+			257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	static const short dext[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+			7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+	std::vector<uint8_t> &out = *s->out;
+
+	while (!s->error) {
+		int symbol = inf_decode(s, lencode);
+		if (symbol < 256) {
+			out.push_back((uint8_t)symbol);
+		}
+		else if (symbol == 256) {
+			return 0;
+		}
+		else {
+			symbol -= 257;
+			if (symbol >= 29)
+				return -EINVAL;
+			const size_t len = lbase[symbol] + inf_bits(s, lext[symbol]);
+			symbol = inf_decode(s, distcode);
+			if (symbol >= 30)
+				return -EINVAL;
+			const size_t dist = dbase[symbol] + inf_bits(s, dext[symbol]);
+			if ((dist > out.size()) || (out.size() + len > INGEST_MAX_PIXELS * 4))
+				return -EINVAL;
+			/* The copy may overlap its own output */
+			for (size_t k = 0; k < len; k++)
+				out.push_back(out[out.size() - dist]);
+		}
+	}
+	return -EINVAL;
+}
+
+static int inf_stored(struct inflate_state *s)
+{
+	s->bitbuf = 0;
+	s->bitcnt = 0;
+	if (s->pos + 4 > s->len)
+		return -EINVAL;
+	const unsigned int len = s->src[s->pos] | (s->src[s->pos + 1] << 8);
+	const unsigned int nlen = s->src[s->pos + 2] | (s->src[s->pos + 3] << 8);
+	s->pos += 4;
+	if ((len != (~nlen & 0xffff)) || (s->pos + len > s->len))
+		return -EINVAL;
+	s->out->insert(s->out->end(), s->src + s->pos, s->src + s->pos + len);
+	s->pos += len;
+	return 0;
+}
+
+struct fixed_codes {
+	struct huffman lencode;
+	struct huffman distcode;
+};
+
+static struct fixed_codes inf_fixed_codes(void)
+{
+	struct fixed_codes codes;
+	short lengths[288];
+	unsigned int symbol;
+
+	for (symbol = 0; symbol < 144; symbol++) lengths[symbol] = 8;
+	for (; symbol < 256; symbol++) lengths[symbol] = 9;
+	for (; symbol < 280; symbol++) lengths[symbol] = 7;
+	for (; symbol < 288; symbol++) lengths[symbol] = 8;
+	inf_construct(&codes.lencode, lengths, 288);
+	for (symbol = 0; symbol < 30; symbol++) lengths[symbol] = 5;
+	inf_construct(&codes.distcode, lengths, 30);
+	return codes;
+}
+
+static int inf_fixed(struct inflate_state *s)
+{
+	/* Built once, by the 1st thread to get here */
+	static const struct fixed_codes codes = inf_fixed_codes();
+
+	return inf_codes(s, &codes.lencode, &codes.distcode);
+}
+
+static int inf_dynamic(struct inflate_state *s)
+{
+	static const short order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+	short lengths[288 + 30];
+	struct huffman lencode, distcode;
+	unsigned int index;
+
+	const unsigned int nlen = inf_bits(s, 5) + 257;
+	const unsigned int ndist = inf_bits(s, 5) + 1;
+	const unsigned int ncode = inf_bits(s, 4) + 4;
+	if ((nlen > 286) || (ndist > 30))
+		return -EINVAL;
+
+	for (index = 0; index < ncode; index++)
+		lengths[order[index]] = inf_bits(s, 3);
+	for (; index < 19; index++)
+		lengths[order[index]] = 0;
+	if (inf_construct(&lencode, lengths, 19))
+		return -EINVAL;
+
+	for (index = 0; (index < nlen + ndist) && !s->error; ) {
+		int symbol = inf_decode(s, &lencode);
+		if (symbol < 16) {
+			lengths[index++] = symbol;
+			continue;
+		}
+		short len = 0;
+		unsigned int repeat;
+		if (symbol == 16) {
+			if (index == 0)
+				return -EINVAL;
+			len = lengths[index - 1];
+			repeat = 3 + inf_bits(s, 2);
+		}
+		else if (symbol == 17)
+			repeat = 3 + inf_bits(s, 3);
+		else
+			repeat = 11 + inf_bits(s, 7);
+		if (index + repeat > nlen + ndist)
+			return -EINVAL;
+		while (repeat--)
+			lengths[index++] = len;
+	}
+	if (s->error || (lengths[256] == 0))
+		return -EINVAL;
+
+	if (inf_construct(&lencode, lengths, nlen) || inf_construct(&distcode, lengths + nlen, ndist))
+		return -EINVAL;
+	return inf_codes(s, &lencode, &distcode);
+}
+
+/* Inflates a zlib stream (RFC 1950), without checking its Adler-32 */
+static int zlib_inflate(const std::vector<uint8_t> &src, std::vector<uint8_t> &out)
+{
+	struct inflate_state s;
+	unsigned int last;
+	int rc = 0;
+
+	if ((src.size() < 2) || ((src[0] & 0x0f) != 8) || (((src[0] << 8) | src[1]) % 31) || (src[1] & 0x20))
+		return -EINVAL;
+	s.src = src.data();
+	s.len = src.size();
+	s.pos = 2;
+	s.bitbuf = 0;
+	s.bitcnt = 0;
+	s.error = 0;
+	s.out = &out;
+
+	do {
+		last = inf_bits(&s, 1);
+		switch (inf_bits(&s, 2)) {
+		case 0: rc = inf_stored(&s); break;
+		case 1: rc = inf_fixed(&s); break;
+		case 2: rc = inf_dynamic(&s); break;
+		default: rc = -EINVAL;
+		}
+	} while (!last && !rc && !s.error);
+	return (rc || s.error) ? -EINVAL : 0;
+}
+
+static inline uint32_t be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static const uint8_t png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+static int png_decode(const std::vector<uint8_t> &data, std::vector<uint8_t> &gray, unsigned int &width, unsigned int &height)
+{
+	std::vector<uint8_t> idat, raw;
+	const uint8_t *plte = NULL;
+	unsigned int depth = 0, color = 0, interlace = 0, plte_entries = 0;
+	size_t pos = 8;
+
+	if ((data.size() < 8) || memcmp(data.data(), png_signature, 8))
+		return -EINVAL;
+
+	while (pos + 12 <= data.size()) {
+		const uint32_t len = be32(&data[pos]);
+		const uint8_t *type = &data[pos + 4];
+		const uint8_t *body = &data[pos + 8];
+		if (len > data.size() - pos - 12)
+			return -EINVAL;
+		if (!memcmp(type, "IHDR", 4) && (len >= 13)) {
+			width = be32(body);
+			height = be32(body + 4);
+			depth = body[8];
+			color = body[9];
+			interlace = body[12];
+		}
+		else if (!memcmp(type, "PLTE", 4)) {
+			plte = body;
+			plte_entries = len / 3;
+		}
+		else if (!memcmp(type, "IDAT", 4))
+			idat.insert(idat.end(), body, body + len);
+		else if (!memcmp(type, "IEND", 4))
+			break;
+		pos += 12 + len;
+	}
+
+	/* Samples per pixel of the color types 0 (gray), 2 (RGB), 3 (palette), 4 (gray+alpha), 6 (RGBA) */
+	static const unsigned int channels_of[7] = { 1, 0, 3, 1, 2, 0, 4 };
+	if ((depth != 8) || (color > 6) || !channels_of[color] || interlace ||
+			((uint64_t)width * height > INGEST_MAX_PIXELS) || ((color == 3) && !plte)) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: unsupported PNG: depth %u, color type %u, interlace %u\n",
+				depth, color, interlace);
+		return -EINVAL;
+	}
+	const unsigned int bpp = channels_of[color];
+	const size_t stride = (size_t)width * bpp;
+
+	raw.reserve((stride + 1) * height);
+	if (zlib_inflate(idat, raw) || (raw.size() < (stride + 1) * height))
+		return -EINVAL;
+
+	/* Undo the filter of every scanline in place, the filter byte leads the row */
+	for (unsigned int y = 0; y < height; y++) {
+		uint8_t *row = &raw[y * (stride + 1) + 1];
+		const uint8_t *up = y ? &raw[(y - 1) * (stride + 1) + 1] : NULL;
+		const uint8_t filter = row[-1];
+		for (size_t x = 0; x < stride; x++) {
+			const int a = (x >= bpp) ? row[x - bpp] : 0;
+			const int b = up ? up[x] : 0;
+			const int c = (up && (x >= bpp)) ? up[x - bpp] : 0;
+			switch (filter) {
+			case 0: break;
+			case 1: row[x] += a; break;
+			case 2: row[x] += b; break;
+			case 3: row[x] += (a + b) >> 1; break;
+			case 4: {
+				const int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+				row[x] += ((pa <= pb) && (pa <= pc)) ? a : ((pb <= pc) ? b : c);
+				break;
+			}
+			default: return -EINVAL;
+			}
+		}
+	}
+
+	/* To 8-bit grayscale as PIL's convert('L'): ITU-R 601-2 luma, alpha dropped */
+	gray.resize((size_t)width * height);
+	for (unsigned int y = 0; y < height; y++) {
+		const uint8_t *row = &raw[y * (stride + 1) + 1];
+		for (unsigned int x = 0; x < width; x++) {
+			const uint8_t *rgb = row + x * bpp;
+			if (color == 3) {
+				if (rgb[0] >= plte_entries)
+					return -EINVAL;
+				rgb = plte + 3 * rgb[0];
+			}
+			else if ((color == 0) || (color == 4)) {
+				gray[(size_t)y * width + x] = rgb[0];
+				continue;
+			}
+			gray[(size_t)y * width + x] = (uint8_t)((rgb[0] * 19595 + rgb[1] * 38470 + rgb[2] * 7471 + 0x8000) >> 16);
+		}
+	}
+	return 0;
+}
+
+//=================================================================================================================
+// INGESTION
+//=================================================================================================================
+
+ingest_format_t ingest_format(const std::string &fname)
+{
+	const size_t dot = fname.rfind('.');
+	if (dot == std::string::npos)
+		return INGEST_TEXT;
+	std::string ext = fname.substr(dot + 1);
+	for (size_t k = 0; k < ext.size(); k++)
+		ext[k] = tolower(ext[k]);
+	if (ext == "pgm")
+		return INGEST_PGM;
+	if (ext == "gray")
+		return INGEST_GRAY;
+	if (ext == "png")
+		return INGEST_PNG;
+	return INGEST_TEXT;
+}
+
+int ingest_columns(const std::string &fname)
+{
+	std::vector<uint8_t> head;
+	unsigned int width, height, maxval;
+	size_t pos;
+
+	switch (ingest_format(fname)) {
+	case INGEST_PGM:
+		if (read_file(fname, head, 1024) || pgm_header(head, pos, width, height, maxval))
+			return -1;
+		return (int)width;
+	case INGEST_GRAY: {
+		FILE *fp = fopen(fname.c_str(), "rb");
+		if (!fp)
+			return -1;
+		fseek(fp, 0, SEEK_END);
+		const long size = ftell(fp);
+		fclose(fp);
+		return (size < 0) ? -1 : (int)(size / HIGHT_IN_PIX);
+	}
+	case INGEST_PNG:
+		/* IHDR is the 1st chunk: its width follows the signature, length and type */
+		if (read_file(fname, head, 24) || (head.size() < 24) || memcmp(head.data(), png_signature, 8))
+			return -1;
+		return (int)be32(&head[16]);
+	default:
+		return -1;
+	}
+}
+
+int ingest_image(const std::string &fname, std::vector<float> &pixels, unsigned int &cols)
+{
+	std::vector<uint8_t> data, gray;
+	unsigned int width = 0, height = 0;
+	int rc;
+
+	rc = read_file(fname, data, (size_t)-1);
+	if (rc)
+		return rc;
+
+	switch (ingest_format(fname)) {
+	case INGEST_PGM:
+		rc = pgm_decode(data, gray, width, height);
+		break;
+	case INGEST_GRAY:
+		if (data.size() % HIGHT_IN_PIX) {
+			rc = -EINVAL;
+			break;
+		}
+		gray.swap(data);
+		width = gray.size() / HIGHT_IN_PIX;
+		height = HIGHT_IN_PIX;
+		break;
+	case INGEST_PNG:
+		rc = png_decode(data, gray, width, height);
+		break;
+	default:
+		rc = -EINVAL;
+	}
+	if (rc == 0 && ((height != HIGHT_IN_PIX) || (width == 0))) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: image %s is %ux%u, the network takes %u rows\n",
+				fname.c_str(), width, height, HIGHT_IN_PIX);
+		rc = -EINVAL;
+	}
+	if (rc) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot decode image %s\n", fname.c_str());
+		return rc;
+	}
+
+	cols = width;
+	pixels.resize((size_t)cols * HIGHT_IN_PIX);
+	ingest_normalize(gray.data(), cols, pixels.data());
+	return 0;
+}
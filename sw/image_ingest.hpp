@@ -0,0 +1,82 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file image_ingest.hpp
+ * @brief Native ingestion of 8-bit grayscale line images, in place of the text files of
+ * scripts/img2txt.py. An image of HIGHT_IN_PIX rows is inverted, normalized by its mean and
+ * standard deviation, clipped to [INGEST_MIN_CLIP, INGEST_MAX_CLIP] and laid out column by
+ * column, i.e. the pixels the text file of the image would hold.
+ *
+ * Formats, by file extension:
+ *  .pgm  binary (P5) or ASCII (P2) PGM
+ *  .gray headerless 8-bit pixels, HIGHT_IN_PIX rows of file size / HIGHT_IN_PIX pixels
+ *  .png  non-interlaced 8-bit grayscale, gray+alpha, RGB, RGBA or palette PNG (built-in
+ *        decoder, no zlib), converted to grayscale as PIL does
+ * Anything else is a text file of pixels (InputImage::Parse()).
+ */
+
+#ifndef IMAGE_INGEST_HPP
+#define IMAGE_INGEST_HPP
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+/* The clipping range of the normalized pixels, as in scripts/img2txt.py */
+#define INGEST_MIN_CLIP -1.75
+#define INGEST_MAX_CLIP 3.75
+
+typedef enum {
+	INGEST_TEXT = 0,	/* pixels as text, see InputImage::Parse() */
+	INGEST_PGM,
+	INGEST_GRAY,
+	INGEST_PNG
+} ingest_format_t;
+
+/**
+ * @brief The format of an image file, from its extension.
+ */
+ingest_format_t ingest_format(const std::string &fname);
+
+/**
+ * @brief The number of columns of an image, from its header only.
+ * @return The columns, or -1 for text files and unreadable headers.
+ */
+int ingest_columns(const std::string &fname);
+
+/**
+ * @brief Reads, decodes and normalizes an image file (not INGEST_TEXT).
+ * @param fname The image file.
+ * @param pixels The normalized pixels, column after column of HIGHT_IN_PIX.
+ * @param cols The number of columns.
+ * @return 0 upon success, -EIO if the file cannot be read, -EINVAL if it is malformed,
+ * unsupported or not HIGHT_IN_PIX rows high.
+ */
+int ingest_image(const std::string &fname, std::vector<float> &pixels, unsigned int &cols);
+
+/**
+ * @brief Normalizes an 8-bit grayscale image of HIGHT_IN_PIX rows (see above).
+ * @param gray The pixels, row after row.
+ * @param cols The width of the image.
+ * @param pixels The normalized pixels, column after column, cols * HIGHT_IN_PIX.
+ */
+void ingest_normalize(const uint8_t *gray, unsigned int cols, float *pixels);
+
+#endif /* IMAGE_INGEST_HPP */
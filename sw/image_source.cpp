@@ -0,0 +1,186 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file image_source.cpp
+ * @brief The work queue of snap_blstm, see image_source.hpp.
+ *
+ * An action lasts as long as its longest image, so the longest images of a window go first:
+ * the slowest actions are not the last ones of their window. The number of columns of an image
+ * file comes from its header, or only after parsing for a text file: then the size of the file
+ * stands in for it.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+
+#include "../include/common_def.h"
+
+#include "image_source.hpp"
+#include "image_ingest.hpp"
+
+ImageSource::ImageSource() : window(0), list(NULL), line(NULL), lineSize(0), read(0), taken(0)
+{
+}
+
+ImageSource::~ImageSource()
+{
+	if (list != NULL)
+		fclose(list);
+	free(line);
+}
+
+/* With a single image per action the actions do not change: the images keep the input order */
+static unsigned int source_window(unsigned int window)
+{
+	if ((ACC_CALLS_PER_ACTION == 1) || (window <= ACC_CALLS_PER_ACTION))
+		return 0;
+	return (window + ACC_CALLS_PER_ACTION - 1) / ACC_CALLS_PER_ACTION * ACC_CALLS_PER_ACTION;
+}
+
+void ImageSource::Init(const std::string &imgDir, const std::string &gtDir,
+		std::vector<std::string> &images, std::vector<std::string> &groundTruth, unsigned int window)
+{
+	this->imgDir = imgDir;
+	this->gtDir = gtDir;
+	this->window = source_window(window);
+	this->images.swap(images);
+	this->groundTruth.swap(groundTruth);
+}
+
+int ImageSource::Init(const char *fname, const std::string &imgDir, const std::string &gtDir, unsigned int window)
+{
+	this->imgDir = imgDir;
+	this->gtDir = gtDir;
+	this->window = source_window(window);
+
+	list = fopen(fname, "r");
+	if (!list) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot open the list file %s: %s\n", fname, strerror(errno));
+		return -ENODEV;
+	}
+	return 0;
+}
+
+/* The next pair of the input order, false at its end */
+bool ImageSource::Next(image_item_t &item)
+{
+	if (list == NULL) {
+		if (read >= images.size())
+			return false;
+		item.image = imgDir + images[read];
+		item.groundTruth = gtDir + groundTruth[read];
+		/* Taken once, the names are of no further use */
+		std::string().swap(images[read]);
+		std::string().swap(groundTruth[read]);
+	}
+	else {
+		while (1) {
+			if (getline(&line, &lineSize, list) < 0)
+				return false;
+			char *save = NULL;
+			const char *image = strtok_r(line, " \t\r\n", &save);
+			const char *gt = strtok_r(NULL, " \t\r\n", &save);
+			if (image == NULL)
+				continue;
+			if (gt == NULL) {
+				if (DEBUG_LEVEL >= LOG_WARNING) fprintf(stderr, "WARNING: no ground truth for %s in the list file, skipped\n", image);
+				continue;
+			}
+			item.image = imgDir + image;
+			item.groundTruth = gtDir + gt;
+			break;
+		}
+	}
+	item.idx = read++;
+	return true;
+}
+
+/* Reads the next window, in processing order */
+void ImageSource::Fill()
+{
+	const unsigned int count = window ? window : IMAGE_SOURCE_CHUNK;
+	std::vector<image_item_t> items;
+	std::vector<off_t> length;
+	image_item_t item;
+
+	while ((items.size() < count) && Next(item))
+		items.push_back(item);
+
+	if (window) {
+		length.resize(items.size(), 0);
+		for (unsigned int i = 0; i < items.size(); i++) {
+			struct stat st;
+			if (ingest_format(items[i].image) != INGEST_TEXT)
+				length[i] = ingest_columns(items[i].image);
+			else if (stat(items[i].image.c_str(), &st) == 0)
+				length[i] = st.st_size;
+		}
+		std::vector<unsigned int> order(items.size());
+		for (unsigned int i = 0; i < order.size(); i++)
+			order[i] = i;
+		std::stable_sort(order.begin(), order.end(),
+				[&length](unsigned int a, unsigned int b) { return length[a] > length[b]; });
+		for (unsigned int i = 0; i < order.size(); i++)
+			queue.push_back(items[order[i]]);
+	}
+	else
+		queue.insert(queue.end(), items.begin(), items.end());
+}
+
+unsigned int ImageSource::Take(image_item_t *items, unsigned int n)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	unsigned int k = 0;
+
+	while (k < n) {
+		if (queue.empty())
+			Fill();
+		if (queue.empty())
+			break;
+		items[k++] = queue.front();
+		queue.pop_front();
+	}
+	taken += k;
+	return k;
+}
+
+unsigned int ImageSource::Remaining()
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (list == NULL)
+		return queue.size() + (images.size() - read);
+	return feof(list) ? queue.size() : UINT_MAX;
+}
+
+unsigned int ImageSource::Taken()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return taken;
+}
+
+unsigned int ImageSource::Window() const
+{
+	return window;
+}
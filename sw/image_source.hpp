@@ -0,0 +1,107 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file image_source.hpp
+ * @brief The work queue of snap_blstm: hands out the (image, ground truth) pairs of the dataset
+ * a window at a time. Within a window the images are ordered longest first, so that the actions
+ * are formed out of images of similar lengths (option -W).
+ *
+ * The pairs come either from the sorted listings of the image and ground truth directories, or
+ * from a list file (option -l) of one "<image> <groundtruth>" pair per line, read as the images
+ * are taken: then only a window of pairs is ever held, whatever the size of the dataset.
+ */
+
+#ifndef IMAGE_SOURCE_HPP
+#define IMAGE_SOURCE_HPP
+
+#include <stdio.h>
+#include <sys/types.h>
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+/* Pairs read from a list file at a time when the images keep the input order */
+#define IMAGE_SOURCE_CHUNK 256
+
+/** An image of the dataset */
+typedef struct {
+	unsigned int idx;		/* 0-based position in the input order */
+	std::string image;		/* path of the image file */
+	std::string groundTruth;	/* path of the ground truth file */
+} image_item_t;
+
+	//=================================================================================================================
+	// IMAGE SOURCE
+	//=================================================================================================================
+
+	class ImageSource
+	{
+		public:
+
+		ImageSource();
+		~ImageSource();
+
+		// Hands out the images of the file names images[] and groundTruth[] (same count), relative to
+		// imgDir and gtDir. window: the images within which the order may change, 0 keeps the input order.
+		void Init(const std::string &imgDir, const std::string &gtDir,
+				std::vector<std::string> &images, std::vector<std::string> &groundTruth, unsigned int window);
+
+		// Same from the list file fname, whose paths are relative to imgDir and gtDir. 0 upon success.
+		int Init(const char *fname, const std::string &imgDir, const std::string &gtDir, unsigned int window);
+
+		// Takes the next images of the processing order, up to n of them. Thread-safe.
+		// Returns the number of images taken, 0 when the dataset is exhausted.
+		unsigned int Take(image_item_t *items, unsigned int n);
+
+		// The images not taken yet, UINT_MAX until the end of a list file is read. Thread-safe.
+		unsigned int Remaining();
+
+		// The images taken so far. Thread-safe.
+		unsigned int Taken();
+
+		// The window in effect: 0 when reordering cannot help the actions (see Init()), else the
+		// requested one rounded up to whole actions.
+		unsigned int Window() const;
+
+		protected:
+
+		private:
+
+		bool Next(image_item_t &item);
+		void Fill();
+
+		std::mutex lock;
+		std::string imgDir;
+		std::string gtDir;
+		unsigned int window;
+		/* The directory listings, or the list file */
+		std::vector<std::string> images;
+		std::vector<std::string> groundTruth;
+		FILE *list;
+		char *line;
+		size_t lineSize;
+		unsigned int read;
+		unsigned int taken;
+		/* The current window, in processing order */
+		std::deque<image_item_t> queue;
+	};
+
+#endif /* IMAGE_SOURCE_HPP */
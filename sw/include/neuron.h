@@ -123,6 +123,10 @@
 			unsigned int *vecPredictedStringInd,
 			unsigned int *str_len);
 
+	// Replaces the weights of the model by those of a JOB_LOAD_WEIGHTS job, NUMBER_OF_WEIGHTS floats. Not thread-safe
+	// against a running Single_Kernel_BLSTM.
+	void LoadWeights(const float *weights);
+
 	//====================================================================================================================================================================================================================
 	// AUXILIARY
 	//====================================================================================================================================================================================================================
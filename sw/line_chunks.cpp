@@ -0,0 +1,109 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file line_chunks.cpp
+ * @brief Chunking of the lines wider than the action, see line_chunks.hpp.
+ *
+ * The normalized pixels grow with the ink (scripts/img2txt.py inverts the image), so the
+ * blankest column is the one of the lowest sum. The sum is the one of the DTYPE_IMG pixels the
+ * action receives: the pixels of a line read from the cache (option -K) are already quantized,
+ * and are thus cut at the same seams as when parsed.
+ */
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "../include/common_def.h"
+
+#include "line_chunks.hpp"
+#include "quantize.hpp"
+
+#if (LINE_CHUNK_SEARCH + LINE_CHUNK_OVERLAP >= MAX_NUMBER_COLUMNS_TEST_SET) || (LINE_CHUNK_SEARCH < LINE_CHUNK_OVERLAP)
+#error "LINE_CHUNK_SEARCH and LINE_CHUNK_OVERLAP do not fit MAX_NUMBER_COLUMNS_TEST_SET"
+#endif
+
+/* At most as many labels as could be written within the overlap, of at least 2 columns each */
+#define LINE_MERGE_MAX (LINE_CHUNK_OVERLAP / 2)
+/* At least as many labels as the overlap holds in practice: with an alphabet of about 100
+ * symbols a single label matches by chance far too often to be dropped */
+#define LINE_MERGE_MIN 2
+/* Labels at either border of the repeat that may differ between the two chunks */
+#define LINE_MERGE_BORDER 1
+
+void line_chunks(const float *pixels, unsigned int cols, std::vector<line_chunk_t> &chunks)
+{
+	const unsigned int half = LINE_CHUNK_OVERLAP / 2;
+	unsigned int start = 0;
+
+	chunks.clear();
+	while (cols - start > MAX_NUMBER_COLUMNS_TEST_SET) {
+		const unsigned int end = start + MAX_NUMBER_COLUMNS_TEST_SET;
+		unsigned int seam = end - half;
+		int seam_ink = 0;
+
+		/* The seam leaves half of the overlap on either side within the chunk */
+		for (unsigned int col = end - LINE_CHUNK_SEARCH + half; col <= end - half; col++) {
+			int8_t column[HIGHT_IN_PIX];
+			int ink = 0;
+			quantize_img_packed(pixels + (size_t)col * HIGHT_IN_PIX, column, HIGHT_IN_PIX);
+			for (unsigned int row = 0; row < HIGHT_IN_PIX; row++)
+				ink += column[row];
+			if ((col == end - LINE_CHUNK_SEARCH + half) || (ink < seam_ink)) {
+				seam = col;
+				seam_ink = ink;
+			}
+		}
+
+		line_chunk_t chunk = { start, seam + half - start };
+		chunks.push_back(chunk);
+		start = seam - half;
+	}
+
+	line_chunk_t chunk = { start, cols - start };
+	chunks.push_back(chunk);
+}
+
+void line_merge(std::vector<unsigned int> &labels, const unsigned int *chunk, size_t len)
+{
+	size_t repeat = 0, dropped = 0, skipped = 0;
+
+	/* The longest prefix of the chunk that repeats the end of the labels so far, of LINE_MERGE_MIN
+	 * labels at least, else the whole chunk is appended. The last label so far and the first one of
+	 * the chunk lie at the borders of their chunks, where the other chunk may decode them differently:
+	 * either may be left out of the repeat, for the version of the other chunk. At equal lengths, the
+	 * repeat of fewer such labels wins */
+	for (size_t d = 0; d <= LINE_MERGE_BORDER; d++) {
+		for (size_t s = 0; s <= LINE_MERGE_BORDER; s++) {
+			if ((labels.size() < d + LINE_MERGE_MIN) || (len < s + LINE_MERGE_MIN))
+				continue;
+			size_t r = std::min(std::min(labels.size() - d, len - s), (size_t)LINE_MERGE_MAX);
+			for (; (r > repeat) && (r >= LINE_MERGE_MIN); r--) {
+				if (std::equal(chunk + s, chunk + s + r, labels.end() - d - r)) {
+					repeat = r;
+					dropped = d;
+					skipped = s;
+					break;
+				}
+			}
+		}
+	}
+	labels.resize(labels.size() - dropped);
+	labels.insert(labels.end(), chunk + skipped + repeat, chunk + len);
+}
@@ -0,0 +1,76 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file line_chunks.hpp
+ * @brief Lines wider than the buffers of the action (MAX_NUMBER_COLUMNS_TEST_SET columns) are
+ * inferred as overlapping chunks, each one a separate image of the action.
+ *
+ * Consecutive chunks share LINE_CHUNK_OVERLAP columns, centred on a seam: the blankest column
+ * (least ink) within the last LINE_CHUNK_SEARCH columns a chunk may hold, i.e. preferably a gap
+ * between words. The text of the overlap is then predicted by both chunks, and the labels of a
+ * chunk are merged into those of the previous ones by dropping the longest prefix, of 2 labels
+ * at least, that repeats their end.
+ *
+ * The labels are merged by their text, not by their columns: the action returns the labels of an
+ * image without the columns they were decoded at, so the blank of the seam cannot be located among
+ * them. The merge thus fails where the overlap does not decode to a repeat of 2 labels or more:
+ * - an overlap of a single label (e.g. a blank and one letter) is kept twice;
+ * - an overlap the two chunks decode differently, apart from a label at either border, is kept
+ *   twice, both versions one after the other;
+ * - a repeat that the end of the previous chunks and the start of the next one share by chance,
+ *   outside of the overlap, drops the text of the next chunk that it covers.
+ */
+
+#ifndef LINE_CHUNKS_HPP
+#define LINE_CHUNKS_HPP
+
+#include <stddef.h>
+
+#include <vector>
+
+/* Columns shared by consecutive chunks of a line */
+#define LINE_CHUNK_OVERLAP 48
+/* Columns before the end of a full chunk in which its seam is searched */
+#define LINE_CHUNK_SEARCH 192
+
+/** A chunk of a line */
+typedef struct {
+	unsigned int start;	/* 1st column */
+	unsigned int cols;	/* number of columns */
+} line_chunk_t;
+
+/**
+ * @brief Splits a line into chunks of at most MAX_NUMBER_COLUMNS_TEST_SET columns. A line that fits
+ * is a single chunk.
+ * @param pixels The normalized pixels of the line, column after column of HIGHT_IN_PIX.
+ * @param cols The number of columns.
+ * @param chunks The chunks, from left to right.
+ */
+void line_chunks(const float *pixels, unsigned int cols, std::vector<line_chunk_t> &chunks);
+
+/**
+ * @brief Appends the labels of the next chunk of a line to those of the previous chunks, minus
+ * their overlap (see above).
+ * @param labels The labels of the previous chunks, then of all of them.
+ * @param chunk The labels of the chunk.
+ * @param len The number of labels of the chunk.
+ */
+void line_merge(std::vector<unsigned int> &labels, const unsigned int *chunk, size_t len);
+
+#endif /* LINE_CHUNKS_HPP */
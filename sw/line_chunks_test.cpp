@@ -0,0 +1,171 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file line_chunks_test.cpp
+ * @brief Checks of line_merge() at the seams of the chunks, and of a line wider than the action
+ * inferred chunk by chunk on the software engine against its ground truth (make check, from sw/).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../include/common_def.h"
+#include "../include/levenshtein.h"
+
+#include "cpu_engine.hpp"
+#include "line_chunks.hpp"
+
+/* Consecutive lines of a page, joined into a line of 2220 columns, i.e. 4 chunks */
+#define LONG_LINE_DATA "../data/"
+#define LONG_LINE_FIRST 1
+#define LONG_LINE_LINES 6
+/* Errors the joined line may make beyond those of its lines inferred one by one: a space lost or
+ * a letter misread per junction of two lines or seam of two chunks. The overlap of a seam, merged
+ * twice or dropped, costs several letters. */
+#define LONG_LINE_SLACK 1
+
+static int failures = 0;
+
+static void check_merge(const char *name, std::vector<unsigned int> labels,
+		const std::vector<unsigned int> &chunk, const std::vector<unsigned int> &expected)
+{
+	line_merge(labels, chunk.data(), chunk.size());
+	if (labels != expected) {
+		fprintf(stderr, "err: line_merge %s: got", name);
+		for (unsigned int l = 0; l < labels.size(); l++)
+			fprintf(stderr, " %u", labels[l]);
+		fprintf(stderr, "\n");
+		failures++;
+	}
+}
+
+static std::string read_file(const std::string &fname)
+{
+	std::ifstream in(fname.c_str());
+	std::stringstream text;
+
+	if (!in.good()) {
+		fprintf(stderr, "err: Cannot open file %s\n", fname.c_str());
+		exit(EXIT_FAILURE);
+	}
+	text << in.rdbuf();
+	return text.str();
+}
+
+static std::string decode(const std::vector<std::string> &alphabet, const std::vector<unsigned int> &labels)
+{
+	std::string text;
+
+	for (unsigned int l = 0; l < labels.size(); l++)
+		text += alphabet.at(labels[l]);
+	return text;
+}
+
+/* Infers the columns [start, start + cols) of a line of pixels on the software engine */
+static std::vector<unsigned int> infer(const std::vector<float> &pixels, unsigned int start, unsigned int cols)
+{
+	std::vector<float> fw(pixels.begin() + (size_t)start * HIGHT_IN_PIX,
+			pixels.begin() + (size_t)(start + cols) * HIGHT_IN_PIX);
+	std::vector<float> bw(fw.size());
+	std::vector<unsigned int> labels(MAX_PREDICTED_STRING_LENGTH);
+
+	/* The backward image mirrors the columns of the forward one */
+	for (unsigned int col = 0; col < cols; col++)
+		memcpy(&bw[(size_t)col * HIGHT_IN_PIX], &fw[(size_t)(cols - col - 1) * HIGHT_IN_PIX],
+				HIGHT_IN_PIX * sizeof(float));
+	labels.resize(cpu_engine_run(fw.data(), bw.data(), cols, labels.data()));
+	return labels;
+}
+
+static void check_long_line()
+{
+	std::vector<std::string> alphabet;
+	std::istringstream symbols(read_file(LONG_LINE_DATA "alphabet/alphabet.txt"));
+	std::string symbol, text, truth;
+	std::vector<float> pixels;
+	unsigned int alone = 0;
+
+	while (getline(symbols, symbol))
+		alphabet.push_back(symbol);
+
+	for (unsigned int l = LONG_LINE_FIRST; l < LONG_LINE_FIRST + LONG_LINE_LINES; l++) {
+		char name[128];
+		std::vector<float> line;
+		float pix;
+
+		snprintf(name, sizeof(name), "fontane_brandenburg01_1862_0043_1600px_01%04u", l);
+		std::istringstream in(read_file(std::string(LONG_LINE_DATA "samples_sm/") + name + ".raw.lnrm.png.txt"));
+		while (in >> pix)
+			line.push_back(pix);
+		std::string gt = read_file(std::string(LONG_LINE_DATA "gt_sm/") + name + ".gt.txt");
+		gt.erase(gt.find_last_not_of("\r\n") + 1);
+
+		/* The errors of the line alone, apart from the joined line */
+		const std::string predicted = decode(alphabet, infer(line, 0, line.size() / HIGHT_IN_PIX));
+		alone += levenshtein_bitpar(predicted.data(), predicted.size(), gt.data(), gt.size());
+
+		pixels.insert(pixels.end(), line.begin(), line.end());
+		truth += (truth.empty() ? "" : " ") + gt;
+	}
+
+	std::vector<line_chunk_t> chunks;
+	std::vector<unsigned int> labels;
+	line_chunks(pixels.data(), pixels.size() / HIGHT_IN_PIX, chunks);
+	for (unsigned int k = 0; k < chunks.size(); k++) {
+		const std::vector<unsigned int> chunk = infer(pixels, chunks[k].start, chunks[k].cols);
+		line_merge(labels, chunk.data(), chunk.size());
+	}
+	text = decode(alphabet, labels);
+
+	const unsigned int errors = levenshtein_bitpar(text.data(), text.size(), truth.data(), truth.size());
+	const unsigned int slack = LONG_LINE_SLACK * (LONG_LINE_LINES - 1 + chunks.size() - 1);
+	if ((chunks.size() < 2) || (errors > alone + slack)) {
+		fprintf(stderr, "err: long line of %u chunks: %u errors, %u for its lines alone (+%u)\n%s\n",
+				(unsigned int)chunks.size(), errors, alone, slack, text.c_str());
+		failures++;
+	}
+}
+
+int main()
+{
+	/* The overlap predicted by both chunks is dropped from the second one */
+	check_merge("overlap", { 10, 11, 12, 13 }, { 12, 13, 14, 15 }, { 10, 11, 12, 13, 14, 15 });
+	/* The last label of the seam matches the first one of the chunk by chance: nothing is dropped */
+	check_merge("coincidence", { 10, 11, 12, 13 }, { 13, 20, 21 }, { 10, 11, 12, 13, 13, 20, 21 });
+	/* The border labels of the repeat are decoded differently by the two chunks */
+	check_merge("last", { 10, 11, 12, 13, 14 }, { 12, 13, 15, 16 }, { 10, 11, 12, 13, 15, 16 });
+	check_merge("first", { 10, 11, 12, 13 }, { 20, 12, 13, 14 }, { 10, 11, 12, 13, 14 });
+	/* The longest repeat wins over a shorter one */
+	check_merge("longest", { 1, 2, 1, 2, 1 }, { 2, 1, 2, 1, 3 }, { 1, 2, 1, 2, 1, 3 });
+	/* The first chunk of a line, and an empty chunk */
+	check_merge("none", { }, { 5, 6 }, { 5, 6 });
+	check_merge("empty", { 5, 6 }, { }, { 5, 6 });
+
+	check_long_line();
+
+	if (failures == 0)
+		printf("line_chunks_test: OK\n");
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
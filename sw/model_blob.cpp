@@ -0,0 +1,76 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file model_blob.cpp
+ * @brief The model of a JOB_LOAD_WEIGHTS job, see model_blob.hpp.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <fstream>
+#include <string>
+
+#include "../include/common_def.h"
+
+#include "model_blob.hpp"
+
+/* The weights of a text model: a hidden layer, then the output layer */
+static int model_read(const std::string &fname, std::vector<float> &weights)
+{
+	std::ifstream stream(fname.c_str());
+	float weight;
+
+	if (!stream.good()) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot open the model %s: %s\n", fname.c_str(), strerror(errno));
+		return -EINVAL;
+	}
+
+	weights.clear();
+	while (stream >> weight)
+		weights.push_back(weight);
+
+	if (weights.size() != NUMBER_OF_WEIGHTS_HIDDEN + NUMBER_OF_WEIGHTS_OUTPUT) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: The model %s holds %zu weights instead of %u\n",
+				fname.c_str(), weights.size(), (unsigned int)(NUMBER_OF_WEIGHTS_HIDDEN + NUMBER_OF_WEIGHTS_OUTPUT));
+		return -EINVAL;
+	}
+	return 0;
+}
+
+int model_blob_read(const char *dir, std::vector<float> &weights)
+{
+	std::vector<float> fw, bw;
+	int rc;
+
+	rc = model_read(std::string(dir) + "/model_fw.txt", fw);
+	if (rc != 0)
+		return rc;
+	rc = model_read(std::string(dir) + "/model_bw.txt", bw);
+	if (rc != 0)
+		return rc;
+
+	weights.clear();
+	weights.reserve(NUMBER_OF_WEIGHTS);
+	weights.insert(weights.end(), fw.begin(), fw.begin() + NUMBER_OF_WEIGHTS_HIDDEN);
+	weights.insert(weights.end(), bw.begin(), bw.begin() + NUMBER_OF_WEIGHTS_HIDDEN);
+	weights.insert(weights.end(), fw.begin() + NUMBER_OF_WEIGHTS_HIDDEN, fw.end());
+	return 0;
+}
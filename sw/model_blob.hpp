@@ -0,0 +1,42 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file model_blob.hpp
+ * @brief The model of a JOB_LOAD_WEIGHTS job (see action_blstm.h), out of the text models of
+ * data/model: a card then runs on the new weights without a new bitstream, and every card of a
+ * run (option -M) as well as the software engine of the host get the same ones.
+ *
+ * Each text model (model_fw.txt, model_bw.txt) is a hidden layer followed by the output layer,
+ * one weight per line (see NUMBER_OF_WEIGHTS). The output layer is taken from model_fw.txt.
+ */
+
+#ifndef MODEL_BLOB_HPP
+#define MODEL_BLOB_HPP
+
+#include <vector>
+
+/**
+ * @brief Reads the text models of a directory into the weights of a JOB_LOAD_WEIGHTS job.
+ * @param dir The directory of model_fw.txt and model_bw.txt.
+ * @param weights The NUMBER_OF_WEIGHTS weights, in the order of the job.
+ * @return 0 upon success, -EINVAL if a model is missing or of the wrong number of weights.
+ */
+int model_blob_read(const char *dir, std::vector<float> &weights);
+
+#endif /* MODEL_BLOB_HPP */
@@ -414,7 +414,7 @@
 		unsigned int offset, label;
 		*str_len = 0;
 
-		for(unsigned int col = 0; col < numberOfColumns-1; col++)
+		for(unsigned int col = 0; col + 1 < numberOfColumns; col++)
 		{
 			if (input[col * NUMBER_OF_CLASSES] > threshold && input[(col + 1) * NUMBER_OF_CLASSES] < threshold )
 				left_limit = (col + 1) * NUMBER_OF_CLASSES;
@@ -488,3 +488,19 @@
 		free(pOutputFromtHiddenLayer_bw);
 		free(poutputFromOutputLayer);
 }
+
+
+	// Replaces the weights of the model by those of a JOB_LOAD_WEIGHTS job, in its order (see NUMBER_OF_WEIGHTS)
+	void LoadWeights(const float *weights)
+	{
+		float *layers[] = { WGI_fw, WGF_fw, WGO_fw, WCI_fw, WIP_fw, WFP_fw, WOP_fw,
+							WGI_bw, WGF_bw, WGO_bw, WCI_bw, WIP_bw, WFP_bw, WOP_bw, W2 };
+		const size_t sizes[] = { sizeof(WGI_fw), sizeof(WGF_fw), sizeof(WGO_fw), sizeof(WCI_fw), sizeof(WIP_fw), sizeof(WFP_fw), sizeof(WOP_fw),
+								 sizeof(WGI_bw), sizeof(WGF_bw), sizeof(WGO_bw), sizeof(WCI_bw), sizeof(WIP_bw), sizeof(WFP_bw), sizeof(WOP_bw), sizeof(W2) };
+		unsigned int i;
+
+		for (i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++) {
+			memcpy(layers[i], weights, sizes[i]);
+			weights += sizes[i] / sizeof(float);
+		}
+	}
@@ -0,0 +1,218 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file quantize.cpp
+ * @brief Host-side float to DTYPE_IMG (ap_fixed<8,4>) quantizer of the input pixels.
+ *
+ * The (DTYPE_IMG) cast truncates towards minus infinity (AP_TRN) and keeps the low
+ * 8 bits of the result (AP_WRAP), so the raw byte of a pixel x is (int8)floor(x * 16).
+ * x * 16 is exact in single precision. Every float with |x * 16| >= 2^31 is a multiple
+ * of 2^8, so its wrapped byte is 0; those values (and NaNs) are forced to 0 before the
+ * float to int32 conversion, which is then exact on every path.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "third-party/xilinx/ap_int.h"
+
+#include "../include/common_def.h"
+
+#include "quantize.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define QUANT_PATH "sse2"
+#elif defined(__VSX__)
+#include <altivec.h>
+#undef vector
+#undef pixel
+#undef bool
+#define QUANT_PATH "vsx"
+#else
+#define QUANT_PATH "scalar"
+#endif
+
+#define QUANT_SCALE ((float)(1 << FRACT_BITS))
+#define QUANT_RANGE 2147483648.0f /* 2^31 */
+
+/* Position of the raw byte inside a 32-bit slot, i.e. the 1st byte in memory */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define QUANT_SLOT_SHIFT 24
+#else
+#define QUANT_SLOT_SHIFT 0
+#endif
+
+/* Pixels per block of quantize_img_check() */
+#define QUANT_CHECK_BLOCK 1024
+
+static inline int32_t quant1(float x)
+{
+	float v = x * QUANT_SCALE;
+
+	if (!(fabsf(v) < QUANT_RANGE))
+		return 0;
+	return (int32_t)floorf(v);
+}
+
+#if defined(__SSE2__)
+
+/* Four pixels, raw byte in the low 8 bits of every lane */
+static inline __m128i quant4(__m128 x)
+{
+	const __m128 absmask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	__m128 v = _mm_mul_ps(x, _mm_set1_ps(QUANT_SCALE));
+	__m128 inrange = _mm_cmplt_ps(_mm_and_ps(v, absmask), _mm_set1_ps(QUANT_RANGE));
+	v = _mm_and_ps(v, inrange);
+	/* SSE2 has no floor: truncate, then step down where truncation rounded up */
+	__m128i t = _mm_cvttps_epi32(v);
+	__m128i up = _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(t), v));
+	return _mm_add_epi32(t, up);
+}
+
+void quantize_img_packed(const float *src, int8_t *dst, size_t n)
+{
+	const __m128i lowbyte = _mm_set1_epi32(0xff);
+	size_t k = 0;
+
+	for (; k + 16 <= n; k += 16) {
+		__m128i q0 = _mm_and_si128(quant4(_mm_loadu_ps(src + k +  0)), lowbyte);
+		__m128i q1 = _mm_and_si128(quant4(_mm_loadu_ps(src + k +  4)), lowbyte);
+		__m128i q2 = _mm_and_si128(quant4(_mm_loadu_ps(src + k +  8)), lowbyte);
+		__m128i q3 = _mm_and_si128(quant4(_mm_loadu_ps(src + k + 12)), lowbyte);
+		/* Lanes are in 0..255, so neither pack saturates */
+		__m128i p = _mm_packus_epi16(_mm_packs_epi32(q0, q1), _mm_packs_epi32(q2, q3));
+		_mm_storeu_si128((__m128i *)(dst + k), p);
+	}
+	for (; k < n; k++)
+		dst[k] = (int8_t)quant1(src[k]);
+}
+
+void quantize_img_slots(const float *src, uint32_t *dst, size_t n)
+{
+	const __m128i lowbyte = _mm_set1_epi32(0xff);
+	size_t k = 0;
+
+	for (; k + 4 <= n; k += 4) {
+		__m128i q = _mm_and_si128(quant4(_mm_loadu_ps(src + k)), lowbyte);
+		_mm_storeu_si128((__m128i *)(dst + k), q);
+	}
+	for (; k < n; k++)
+		dst[k] = (uint32_t)(uint8_t)quant1(src[k]) << QUANT_SLOT_SHIFT;
+}
+
+#elif defined(__VSX__)
+
+typedef __vector float vf32_t;
+typedef __vector signed int vi32_t;
+typedef __vector unsigned int vu32_t;
+typedef __vector signed char vi8_t;
+
+/* Four pixels, raw byte in the low 8 bits of every lane */
+static inline vi32_t quant4(vf32_t x)
+{
+	vf32_t v = vec_madd(x, vec_splats(QUANT_SCALE), vec_splats(0.0f));
+	__vector __bool int inrange = vec_cmplt(vec_abs(v), vec_splats(QUANT_RANGE));
+	v = vec_sel(vec_splats(0.0f), vec_floor(v), inrange);
+	return vec_cts(v, 0);
+}
+
+void quantize_img_packed(const float *src, int8_t *dst, size_t n)
+{
+	size_t k = 0;
+
+	for (; k + 16 <= n; k += 16) {
+		vi32_t q0 = quant4(vec_vsx_ld(0, src + k +  0));
+		vi32_t q1 = quant4(vec_vsx_ld(0, src + k +  4));
+		vi32_t q2 = quant4(vec_vsx_ld(0, src + k +  8));
+		vi32_t q3 = quant4(vec_vsx_ld(0, src + k + 12));
+		/* vec_pack keeps the low half of every lane, i.e. it wraps */
+		vi8_t p = vec_pack(vec_pack(q0, q1), vec_pack(q2, q3));
+		vec_vsx_st(p, 0, (signed char *)(dst + k));
+	}
+	for (; k < n; k++)
+		dst[k] = (int8_t)quant1(src[k]);
+}
+
+void quantize_img_slots(const float *src, uint32_t *dst, size_t n)
+{
+	const vu32_t lowbyte = vec_splats(0xffu);
+	const vu32_t shift = vec_splats((unsigned int)QUANT_SLOT_SHIFT);
+	size_t k = 0;
+
+	for (; k + 4 <= n; k += 4) {
+		vu32_t q = vec_and((vu32_t)quant4(vec_vsx_ld(0, src + k)), lowbyte);
+		vec_vsx_st(vec_sl(q, shift), 0, (unsigned int *)(dst + k));
+	}
+	for (; k < n; k++)
+		dst[k] = (uint32_t)(uint8_t)quant1(src[k]) << QUANT_SLOT_SHIFT;
+}
+
+#else
+
+void quantize_img_packed(const float *src, int8_t *dst, size_t n)
+{
+	for (size_t k = 0; k < n; k++)
+		dst[k] = (int8_t)quant1(src[k]);
+}
+
+void quantize_img_slots(const float *src, uint32_t *dst, size_t n)
+{
+	for (size_t k = 0; k < n; k++)
+		dst[k] = (uint32_t)(uint8_t)quant1(src[k]) << QUANT_SLOT_SHIFT;
+}
+
+#endif
+
+size_t quantize_img_check(const float *src, size_t n)
+{
+	int8_t packed[QUANT_CHECK_BLOCK];
+	uint32_t slots[QUANT_CHECK_BLOCK];
+	size_t errors = 0;
+
+	/* The raw byte of the cast is read the same way the packing loop used to write it */
+	assert(sizeof(DTYPE_IMG) == 1);
+
+	for (size_t b = 0; b < n; b += QUANT_CHECK_BLOCK) {
+		size_t len = (n - b < QUANT_CHECK_BLOCK) ? n - b : QUANT_CHECK_BLOCK;
+
+		quantize_img_packed(src + b, packed, len);
+		quantize_img_slots(src + b, slots, len);
+		for (size_t k = 0; k < len; k++) {
+			DTYPE_IMG ref = (DTYPE_IMG)src[b + k];
+			uint8_t slot_ref[sizeof(uint32_t)] = { 0 };
+			int8_t raw_ref;
+			memcpy(&raw_ref, &ref, sizeof(raw_ref));
+			memcpy(&slot_ref[0], &ref, sizeof(raw_ref));
+			if ((packed[k] != raw_ref) || (memcmp(&slots[k], slot_ref, sizeof(slot_ref)) != 0)) {
+				if (DEBUG_LEVEL >= LOG_DEBUG) fprintf(stderr, "DEBUG: quantizer mismatch at pixel %lu: %f -> 0x%02x, cast 0x%02x\n",
+						(unsigned long)(b + k), src[b + k], (uint8_t)packed[k], (uint8_t)raw_ref);
+				errors++;
+			}
+		}
+	}
+	return errors;
+}
+
+const char *quantize_img_path(void)
+{
+	return QUANT_PATH;
+}
@@ -0,0 +1,63 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file quantize.hpp
+ * @brief Host-side float to DTYPE_IMG (ap_fixed<8,4>) quantizer of the input pixels.
+ * The raw byte of every pixel is floor(x * 2^FRACT_BITS) wrapped to 8 bits, i.e. the
+ * AP_TRN/AP_WRAP behaviour of the (DTYPE_IMG) cast, computed on SSE2 (x86), VSX (POWER)
+ * or plain C, whichever the host compiler targets.
+ */
+
+#ifndef QUANTIZE_HPP
+#define QUANTIZE_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Quantize n pixels to the IN_FMT_PACKED8 layout (one raw byte per pixel).
+ * @param src The float pixels.
+ * @param dst The destination buffer, n bytes.
+ * @param n The number of pixels.
+ */
+void quantize_img_packed(const float *src, int8_t *dst, size_t n);
+
+/**
+ * @brief Quantize n pixels to the IN_FMT_FLOAT32 layout (raw byte in the 1st byte of
+ * every 32-bit slot, remaining bytes zero).
+ * @param src The float pixels.
+ * @param dst The destination buffer, n 32-bit slots.
+ * @param n The number of pixels.
+ */
+void quantize_img_slots(const float *src, uint32_t *dst, size_t n);
+
+/**
+ * @brief Compare the quantizer against the (DTYPE_IMG) cast.
+ * @param src The float pixels.
+ * @param n The number of pixels.
+ * @return The number of pixels whose raw byte differs from the cast.
+ */
+size_t quantize_img_check(const float *src, size_t n);
+
+/**
+ * @brief The name of the quantizer path compiled in ("sse2", "vsx" or "scalar").
+ */
+const char *quantize_img_path(void);
+
+#endif /* QUANTIZE_HPP */
@@ -0,0 +1,187 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file result_sink.cpp
+ * @brief Ordered, buffered writer of the predicted labels of snap_blstm.
+ *
+ * Text output keeps the format of the former per-image file_write(): a header line per
+ * image followed by one label per line. Binary output writes one byte per label and a
+ * label_index_t per image to <output>.idx.
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include <algorithm>
+
+#include "../include/common_def.h"
+
+#include "result_sink.hpp"
+#include "stage_stats.hpp"
+
+ResultSink::ResultSink() : fp(NULL), fidx(NULL), binary(false), offset(0), error(0), closing(false), next(0), depth(RESULT_SINK_DEPTH)
+{
+}
+
+ResultSink::~ResultSink()
+{
+	Close();
+}
+
+int ResultSink::Open(const char *fname, bool binary, unsigned int depth)
+{
+	this->binary = binary;
+	this->depth = std::max(depth, 1u);
+
+	fp = fopen(fname, binary ? "wb" : "w");
+	if (!fp) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot open file %s for writing: %s\n",
+				fname, strerror(errno));
+		return -ENODEV;
+	}
+	setvbuf(fp, NULL, _IOFBF, RESULT_SINK_BUFFER);
+
+	if (binary) {
+		std::string idx = std::string(fname) + ".idx";
+		fidx = fopen(idx.c_str(), "wb");
+		if (!fidx) {
+			if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot open file %s for writing: %s\n",
+					idx.c_str(), strerror(errno));
+			fclose(fp);
+			fp = NULL;
+			return -ENODEV;
+		}
+		setvbuf(fidx, NULL, _IOFBF, RESULT_SINK_BUFFER);
+	}
+
+	writer = std::thread(&ResultSink::Writer, this);
+	return 0;
+}
+
+void ResultSink::Put(unsigned int img, const std::string &name, const unsigned int *labels, size_t len)
+{
+	std::unique_lock<std::mutex> guard(lock);
+	/* Bounds the reorder buffer: the thread of image next never waits, so the writer moves on */
+	while (img - next >= depth)
+		space.wait(guard);
+	Result &result = pending[img];
+	result.name = name;
+	result.labels.assign(labels, labels + len);
+	if (img == next)
+		ready.notify_one();
+}
+
+int ResultSink::Close()
+{
+	if (fp == NULL)
+		return error;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		closing = true;
+		ready.notify_one();
+	}
+	writer.join();
+
+	if (!pending.empty()) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: %u results after a missing image %u were not written\n",
+				(unsigned int)pending.size(), next);
+		error = -EIO;
+	}
+
+	if ((fclose(fp) != 0) && !error)
+		error = -EIO;
+	fp = NULL;
+	if (fidx != NULL) {
+		if ((fclose(fidx) != 0) && !error)
+			error = -EIO;
+		fidx = NULL;
+	}
+	return error;
+}
+
+/* The writer thread: takes the results out of the reorder buffer in input order */
+void ResultSink::Writer()
+{
+	std::unique_lock<std::mutex> guard(lock);
+
+	while (1) {
+		std::map<unsigned int, Result>::iterator it = pending.find(next);
+		if (it == pending.end()) {
+			if (closing)
+				return;
+			ready.wait(guard);
+			continue;
+		}
+
+		Result result;
+		result.name.swap(it->second.name);
+		result.labels.swap(it->second.labels);
+		pending.erase(it);
+		next++;
+		space.notify_all();
+
+		/* Write without holding the lock, the card threads keep on handing over results */
+		guard.unlock();
+		uint64_t t_start = stage_now_ns();
+		if ((Write(result) != 0) && !error)
+			error = -EIO;
+		stage_record(STAGE_WRITE, t_start);
+		guard.lock();
+	}
+}
+
+int ResultSink::Write(const Result &result)
+{
+	const size_t len = result.labels.size();
+
+	if (binary) {
+		label_index_t index;
+		uint8_t bytes[MAX_PREDICTED_STRING_LENGTH];
+		size_t done = 0;
+
+		index.offset = offset;
+		index.length = (uint32_t)len;
+		index.reserved = 0;
+		while (done < len) {
+			size_t chunk = std::min(len - done, sizeof(bytes));
+			for (size_t l = 0; l < chunk; l++)
+				bytes[l] = (uint8_t)result.labels[done + l];
+			if (fwrite(bytes, 1, chunk, fp) != chunk)
+				goto write_error;
+			done += chunk;
+		}
+		if (fwrite(&index, sizeof(index), 1, fidx) != 1)
+			goto write_error;
+		offset += len;
+	}
+	else {
+		if (fprintf(fp, "Output from file : %s, %u characters\n", result.name.c_str(), (unsigned int)len) < 0)
+			goto write_error;
+		for (size_t l = 0; l < len; l++)
+			if (fprintf(fp, "%u\n", result.labels[l]) < 0)
+				goto write_error;
+	}
+	return 0;
+
+write_error:
+	if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot write the labels of %s: %s\n",
+			result.name.c_str(), strerror(errno));
+	return -EIO;
+}
@@ -0,0 +1,107 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file result_sink.hpp
+ * @brief Ordered, buffered writer of the predicted labels of snap_blstm (option -o).
+ * Any thread may hand over the labels of an image, in any order; a single writer thread
+ * restores the input order with a reorder buffer and writes through one open, buffered file.
+ */
+
+#ifndef RESULT_SINK_HPP
+#define RESULT_SINK_HPP
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/* Size of the stdio buffer of the output files */
+#define RESULT_SINK_BUFFER (1 << 20)
+
+/* Images the reorder buffer holds at least ahead of the next one to be written */
+#define RESULT_SINK_DEPTH 1024
+
+/**
+ * Index record of the binary label stream (file <output>.idx), one per image in input order.
+ * The label stream (file <output>) holds one byte per label, as labels are < NUMBER_OF_CLASSES.
+ */
+typedef struct {
+	uint64_t offset;	/* of the 1st label of the image in the label stream, in bytes */
+	uint32_t length;	/* number of labels */
+	uint32_t reserved;
+} label_index_t;
+
+	//=================================================================================================================
+	// RESULT SINK
+	//=================================================================================================================
+
+	class ResultSink
+	{
+		public:
+
+		ResultSink();
+		~ResultSink();
+
+		// Opens (truncates) the output (and the index, if binary) and starts the writer thread. 0 upon success.
+		// depth: the images the reorder buffer holds ahead of the next one to be written, more than
+		// the images between the first and the last one any thread holds at a time.
+		int Open(const char *fname, bool binary, unsigned int depth);
+
+		// Hands over the labels of image img (0-based position in the input order). Thread-safe.
+		// Blocks while img is depth images or more ahead of the next one to be written.
+		void Put(unsigned int img, const std::string &name, const unsigned int *labels, size_t len);
+
+		// Writes the remaining images, stops the writer thread and closes the files. 0 upon success.
+		int Close();
+
+		protected:
+
+		private:
+
+		struct Result {
+			std::string name;
+			std::vector<unsigned int> labels;
+		};
+
+		void Writer();
+		int Write(const Result &result);
+
+		FILE *fp;
+		FILE *fidx;
+		bool binary;
+		uint64_t offset;
+		int error;
+
+		std::thread writer;
+		std::mutex lock;
+		std::condition_variable ready;
+		std::condition_variable space;
+		bool closing;
+		// The reorder buffer: images completed ahead of the next one to be written
+		std::map<unsigned int, Result> pending;
+		unsigned int next;
+		unsigned int depth;
+	};
+
+#endif /* RESULT_SINK_HPP */
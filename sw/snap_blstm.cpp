@@ -27,14 +27,25 @@
 
 
 #include <getopt.h>
-#include <sys/time.h>
 #include <assert.h>
 
 #include <iostream>     // std::cout, std::cerr
 #include <fstream>      // std::ifstream std::ofstream
 #include <vector>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
 #include <algorithm>	// std::sort
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 
 /* Bypassing compiling of snap libs support for old systems (<el5) */
 #ifndef CLOCK_MONOTONIC_RAW
@@ -53,16 +64,49 @@
 #include "../../actions/hls_blstm/include/common_def.h"
 
 #include <errno.h>
+#include <limits.h>
 
 #include "snap_blstm.hpp"
+#include "quantize.hpp"
+#include "stage_stats.hpp"
+#include "result_sink.hpp"
+#include "cpu_engine.hpp"
+#include "image_ingest.hpp"
+#include "image_cache.hpp"
+#include "image_source.hpp"
+#include "line_chunks.hpp"
+#include "model_blob.hpp"
+#include "../include/levenshtein.h"
 #include <sstream>
 
 
 
-#define NAME_BUFF 512
-
 #define MAX_PIXELS_PER_IMAGE 2 * MAX_NUMBER_COLUMNS_TEST_SET * HIGHT_IN_PIX
 
+/* The alignment of the buffers of a batch staged in card DRAM (option -S): a 512b transfer */
+#define STAGED_ALIGN 64
+#define STAGED_ROUND(x) (((x) + STAGED_ALIGN - 1) / STAGED_ALIGN * STAGED_ALIGN)
+
+/* Card numbers probed by "-C all" */
+#define MAX_CARDS 4
+
+/* Images within which the host may reorder to form the actions of similar lengths (option -W) */
+#define REORDER_WINDOW_DEFAULT (8 * ACC_CALLS_PER_ACTION)
+
+/* Images waiting for scoring at most: beyond, the card and host threads wait for the scoring threads */
+#define SCORE_QUEUE_DEPTH 1024
+
+/* Share of the images cross-checked on the host by -X, unless given by -R */
+#define VERIFY_RATE_DEFAULT 0.01
+/* Share of the cross-checked images whose labels may differ beyond which the run fails, unless
+ * given by -T: the fixed-point card and the float engine of the host are not bit-exact, so by
+ * default the mismatches are only reported */
+#define VERIFY_MISMATCH_MAX_DEFAULT 1.0
+/* Images waiting for the cross-check at most: beyond, the samples are dropped */
+#define VERIFY_QUEUE_DEPTH 64
+/* Niceness of the cross-check threads, so that they only take the spare cycles of the host */
+#define VERIFY_NICE 19
+
 
 int verbose_flag = 0;
 
@@ -79,24 +123,37 @@ static void usage(const char *prog)
 {
 	printf("BLSTM algorithm with CAPI support for OpenPOWER systems\n"
 	       "Usage: %s [-h] [-v, --verbose] [-V, --version]\n"
-	       "  -C, --card <cardno> can be (0...3)\n"
-	       "  -i, --input_img_dir <images dir>  input directory\n"
+	       "  -C, --card <cardno>[,<cardno>...] | all  cards to spread the actions over, can be (0...3)\n"
+	       "  -i, --input_img_dir <images dir>  input directory of text (pixels), .pgm, .gray or .png images\n"
 	       "  -g, --input_grt_dir <groundtruth dir>  input directory\n"
-	       "  -o, --output <file.txt>   output file\n"
+	       "  -l, --list <file>         \"<image> <groundtruth>\" per line, relative to -i/-g, read as the images are processed\n"
+	       "  -o, --output <file.txt>   output file, overwritten (not appended to)\n"
+	       "  -B, --binary-out          write the output as a byte per label, indexed by <output>.idx\n"
 	       "  -A, --type-in <CARD_DRAM, HOST_DRAM, ...>.\n"
 	       "  -a, --addr-in <addr>      address e.g. in CARD_RAM\n"
 	       "  -D, --type-out <CARD_DRAM, HOST_DRAM, ...>.\n"
 	       "  -d, --addr-out <addr>     address e.g. in CARD_RAM\n"
 	       "  -n, --num_hw_threads <num> numbers of hw accelerators\n"
 	       "  -t, --timeout             timeout in sec to wait for done\n"
-	       "  -X, --verify              verify result if possible\n"
+	       "  -X, --verify              cross-check a sample of the images on the software engine of the host\n"
+	       "  -R, --verify-rate <r>     share of the images cross-checked by -X (default %g)\n"
+	       "  -T, --verify-max <r>      share of the cross-checked images that may mismatch, beyond which the run fails (default %g)\n"
 	       "  -N, --no-irq              disable Interrupts\n"
+	       "  -P, --packed              send 1 byte per pixel (64 pixels per 512b transfer)\n"
+	       "  -Q, --check-quant         verify the host quantizer against the DTYPE_IMG cast\n"
+	       "  -J, --json <file.json>    write the timing summary of every host stage as JSON\n"
+	       "  -W, --reorder-window <n>  images within which the actions are formed by length (default %u, 0: input order)\n"
+	       "  -H, --host-threads <n>    host threads inferring images on the software engine alongside the cards\n"
+	       "  -K, --cache <dir>         cache the parsed images in dir, for the next runs to skip parsing\n"
+	       "  -L, --latency <cpu>       low-latency mode: one line at a time on the 1st card, polling on CPU <cpu> (-1: any)\n"
+	       "  -M, --model <dir>         load the model of dir (model_fw.txt, model_bw.txt) instead of the one of the bitstream\n"
+	       "  -S, --staged <n>          offline mode: stage n actions at a time in the card DRAM, inferred by a single action call\n"
 	       "\n"
 	       "Example:\n"
 	       "  snap_blstm -i in_dir -g gd_dir -o out.txt -n 1 ...\n"
 	       "\n"
 	       "Report bugs to did@zurich.ibm.com\n\n",
-	       prog);
+	       prog, VERIFY_RATE_DEFAULT, VERIFY_MISMATCH_MAX_DEFAULT, REORDER_WINDOW_DEFAULT);
 }
 
 /**
@@ -109,6 +166,8 @@ static void usage(const char *prog)
  * @param size_out The size of output buffer in bytes.
  * @param type_out The type of output buffer (host-DRAM etc.).
  * @param cols An array storing the number of columns of the images of current action.
+ * @param informat The layout of the input pixels (informat_t).
+ * @param jobtype The kind of job (jobtype_t).
  */
 static void snap_prepare_blstm(struct snap_job *cjob,
 				 struct blstm_job *mjob,
@@ -118,7 +177,9 @@ static void snap_prepare_blstm(struct snap_job *cjob,
 				 void *addr_out,
 				 uint32_t size_out,
 				 uint8_t type_out,
-				 uint16_t *cols)
+				 uint16_t *cols,
+				 uint32_t informat,
+				 uint32_t jobtype)
 {
 	if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "  prepare blstm job of %ld bytes size\n", sizeof(*mjob));
 
@@ -132,7 +193,10 @@ static void snap_prepare_blstm(struct snap_job *cjob,
 		      SNAP_ADDRFLAG_END);
 
 	/* copying columns */
-	memcpy(&mjob->imgcols, cols, sizeof(cols)*sizeof(cols[0]));
+	memcpy(&mjob->imgcols, cols, sizeof(mjob->imgcols));
+
+	mjob->informat = informat;
+	mjob->jobtype = jobtype;
 
 	snap_job_set(cjob, mjob, sizeof(*mjob), NULL, 0);
 }
@@ -142,41 +206,1072 @@ static void snap_prepare_blstm(struct snap_job *cjob,
 
 
 
+/**
+ * @brief An image waiting for scoring, with its predicted labels.
+ */
+struct score_task {
+	unsigned int idx;
+	std::string groundTruth;
+	std::vector<unsigned int> labels;
+};
+
+/**
+ * @brief Scoring state. The card threads push the images of every completed action to the
+ * queue; the scoring threads decode and score them while the cards carry on with inference.
+ * The labels of an image only live until it is scored, and the accuracy is a running sum.
+ */
+struct score_ctx {
+	std::mutex lock;
+	std::condition_variable ready;
+	std::condition_variable space;
+	std::deque<struct score_task> queue;
+	bool closed;
+	const Alphabet *alphabet;
+	unsigned int scored;
+	double errorSum;
+};
+
+/**
+ * @brief Queue an image for scoring, waiting while SCORE_QUEUE_DEPTH images are queued already.
+ * @param item The image.
+ * @param labels Its predicted labels, moved to the queue (labels is left empty).
+ */
+static void score_push(struct score_ctx *s, const image_item_t &item, std::vector<unsigned int> &labels)
+{
+	std::unique_lock<std::mutex> guard(s->lock);
+	while (s->queue.size() >= SCORE_QUEUE_DEPTH)
+		s->space.wait(guard);
+	s->queue.push_back(score_task());
+	s->queue.back().idx = item.idx;
+	s->queue.back().groundTruth = item.groundTruth;
+	s->queue.back().labels.swap(labels);
+	s->ready.notify_one();
+}
+
+/**
+ * @brief An image sampled for the cross-check, with the labels predicted by its card.
+ */
+struct verify_task {
+	image_item_t item;
+	std::vector<unsigned int> labels;
+};
+
+/**
+ * @brief Cross-check state (option -X). The card threads hand over a sample of their images; the
+ * cross-check threads infer them again on the software engine and compare the labels.
+ */
+struct verify_ctx {
+	std::mutex lock;
+	std::condition_variable ready;
+	std::deque<struct verify_task> queue;
+	bool closed;
+	uint64_t threshold;	/* of the hash of the position of a sampled image, rate * 2^32 */
+	ImageCache *cache;
+	std::atomic<unsigned int> sampled;
+	std::atomic<unsigned int> dropped;
+	std::atomic<unsigned int> checked;
+	std::atomic<unsigned int> mismatches;
+};
+
+/**
+ * @brief Hands an image over for the cross-check, if sampled. It never holds the card back:
+ * a sample finding the queue busy or full is dropped instead.
+ * @param item The image.
+ * @param labels The labels predicted by the card, copied.
+ */
+static void verify_push(struct verify_ctx *v, const image_item_t &item, const std::vector<unsigned int> &labels)
+{
+	/* The sample is spread over the dataset by a multiplicative hash of the positions */
+	if ((uint32_t)(item.idx * 2654435761u) >= v->threshold)
+		return;
+	v->sampled++;
+
+	std::unique_lock<std::mutex> guard(v->lock, std::try_to_lock);
+	if (!guard.owns_lock() || (v->queue.size() >= VERIFY_QUEUE_DEPTH)) {
+		v->dropped++;
+		return;
+	}
+	v->queue.push_back(verify_task());
+	v->queue.back().item = item;
+	v->queue.back().labels = labels;
+	v->ready.notify_one();
+}
+
+/**
+ * @brief A scoring thread: translates the labels of the queued images to strings and computes
+ * their Levenshtein distance to the ground truth, until the queue is closed and empty.
+ * @param s The scoring state.
+ */
+static void score_worker(struct score_ctx *s)
+{
+	struct score_task task;
+	uint64_t t_start;
+	// Reused for every image of this thread, so that decoding stops allocating after the 1st images
+	std::string predictedString;
+
+	while (1) {
+		{
+			std::unique_lock<std::mutex> guard(s->lock);
+			while (s->queue.empty() && !s->closed)
+				s->ready.wait(guard);
+			if (s->queue.empty())
+				return;
+			task.idx = s->queue.front().idx;
+			task.groundTruth.swap(s->queue.front().groundTruth);
+			task.labels.swap(s->queue.front().labels);
+			s->queue.pop_front();
+			s->space.notify_one();
+		}
+		const unsigned int i = task.idx;
+
+		// Do the translation from alphabet indexers to actual characters
+		// Since some special characters reserve 2-3 char positions, we do the translation
+		// to the SW, through the flat UTF-8 table of the alphabet (avoiding 2D buffers on HW)
+		t_start = stage_now_ns();
+		predictedString.clear();
+		if (s->alphabet->Decode(task.labels.data(), task.labels.size(), predictedString) != 0) {
+			if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: image %u has labels out of range (>= %u)\n",
+					i, NUMBER_OF_CLASSES);
+		}
+		stage_record(STAGE_DECODE, t_start);
+
+		//----------------------------------------------------------------------
+		// Calculate Levenshtein Distance for each string and output result
+		//----------------------------------------------------------------------
+		/* The ground truth is read by the scorers, while the images are inferred: its time is the one of
+		 * scoring, apart from the loading of the images */
+		GroundTruth groundTruth;
+		t_start = stage_now_ns();
+		groundTruth.Init(task.groundTruth);
+		std::string groundTruthstring = groundTruth.ReturnString();
+		const double error = LevenshteinDistance(predictedString, groundTruthstring);
+		stage_record(STAGE_SCORE, t_start);
+		{
+			std::lock_guard<std::mutex> guard(s->lock);
+			s->scored++;
+			s->errorSum += error;
+		}
+
+		if (DEBUG_LEVEL >= LOG_INFO) {
+			std::ostringstream msg;
+			msg << i << " Expected: "<< groundTruthstring \
+					<< "\n Predicted: " << predictedString << " Accuracy: " << (1-error)*100 << " %\n";
+			msg << " Predicted id: ";
+			for(unsigned int j = 0; j < task.labels.size(); j++)
+				msg << task.labels[j] << " ";
+			log(LOG_INFO) << msg.str() << std::endl;
+		}
+
+		#if PROFILE
+			log(LOG_INFO) << predictedString << std::endl;
+			log(LOG_INFO) << groundTruthstring << std::endl << std::endl;
+		#endif
+
+		groundTruth.Free();
+	}
+}
+
+/**
+ * @brief Parses the card list of option -C.
+ * @param arg Either "all" or a comma separated list of card numbers, e.g. "0,2".
+ * @param card_nos The card numbers to be opened.
+ * @return 1 for "all" (every card number up to MAX_CARDS, the missing ones are skipped),
+ * 0 for a list, -1 for an invalid argument.
+ */
+static int parse_cards(const char *arg, std::vector<int> &card_nos)
+{
+	if (strcmp(arg, "all") == 0) {
+		for (int n = 0; n < MAX_CARDS; n++)
+			card_nos.push_back(n);
+		return 1;
+	}
+
+	std::stringstream list(arg);
+	std::string item;
+	while (std::getline(list, item, ',')) {
+		char *end = NULL;
+		long n = strtol(item.c_str(), &end, 0);
+		if (item.empty() || (*end != '\0') || (n < 0) || (n >= MAX_CARDS) ||
+				(std::find(card_nos.begin(), card_nos.end(), (int)n) != card_nos.end()))
+			return -1;
+		card_nos.push_back((int)n);
+	}
+	return card_nos.empty() ? -1 : 0;
+}
+
+/**
+ * @brief Reads an image file into an image: a text file of pixels, or an image ingested natively
+ * (see image_ingest.hpp). Any failure terminates the process.
+ * @param image The image.
+ * @param fname The image file.
+ * @param cache The image cache, taken instead of parsing the file on a hit and updated on a miss.
+ * NULL without a cache.
+ */
+static void load_image(InputImage &image, const std::string &fname, ImageCache *cache)
+{
+	uint64_t t_start = stage_now_ns();
+	image_key_t key;
+
+	if (cache != NULL) {
+		std::vector<float> pixels;
+		unsigned int cols;
+		if (cache->Lookup(fname, key, pixels, cols)) {
+			image.SetPixels(pixels.data(), cols);
+			stage_record(STAGE_LOAD, t_start);
+			return;
+		}
+	}
+
+	if (ingest_format(fname) == INGEST_TEXT) {
+		std::string text = InputImage::Load(fname);
+		t_start = stage_record(STAGE_LOAD, t_start);
+		image.Parse(text);
+	}
+	else {
+		std::vector<float> pixels;
+		unsigned int cols;
+		if (ingest_image(fname, pixels, cols) != 0)
+			exit(BLSTM_TB_FAILURE);
+		image.SetPixels(pixels.data(), cols);
+	}
+	if (cache != NULL)
+		cache->Store(key, image.image_fw, image.numberOfColumns);
+	stage_record(STAGE_PARSE, t_start);
+}
+
+/**
+ * @brief Per-card state of the fan-out scheduler. Every card owns one attached
+ * action and its own I/O buffers, so the cards run independently of each other.
+ */
+struct card_ctx {
+	int card_no;
+	struct snap_card *card;
+	struct snap_action *action;
+	float *ibuff;
+	unsigned int *obuff;
+	uint8_t *sbuff;		/* the image of a batch in card DRAM (option -S) */
+	unsigned int actions;
+	unsigned int images;
+	uint64_t exec_ns;
+	uint64_t lane_cols;	/* columns of the images of all actions */
+	uint64_t lane_slots;	/* ACC_CALLS_PER_ACTION times the longest image, over all actions */
+};
+
+/**
+ * @brief A host thread running the software engine (option -H).
+ */
+struct cpu_ctx {
+	unsigned int thread_no;
+	unsigned int images;
+	uint64_t busy_ns;
+};
+
+/**
+ * @brief State shared by all cards: the work queue over the dataset and the results.
+ */
+struct sched_ctx {
+	/* The work queue, in processing order */
+	ImageSource *source;
+	const char *output;
+	unsigned long timeout;
+	uint32_t informat;
+	int check_quant;
+	std::atomic<size_t> quant_errors;
+	struct score_ctx *score;
+	ResultSink *sink;
+	ImageCache *cache;
+	struct verify_ctx *verify;	/* NULL without -X */
+	unsigned int staged;	/* actions per batch staged in card DRAM, 0 without -S */
+	/* The measured throughput of the cards, for the host threads to decide whether to take an image */
+	unsigned int cards;
+	std::atomic<uint64_t> card_ns;
+	std::atomic<unsigned int> card_imgs;
+};
+
+/**
+ * @brief An image in flight on a card. A line wider than the action is inferred as several
+ * chunks (see line_chunks.hpp), possibly over several actions.
+ */
+struct line_ctx {
+	image_item_t item;
+	InputImage image;
+	std::vector<line_chunk_t> chunks;
+	std::vector< std::vector<unsigned int> > labels;	/* of every chunk */
+	unsigned int packed;	/* chunks in an action so far */
+	unsigned int done;	/* chunks inferred so far */
+};
+
+/**
+ * @brief A chunk of a line, waiting for a slot of an action.
+ */
+struct line_piece {
+	struct line_ctx *line;
+	unsigned int chunk;
+};
+
+/**
+ * @brief Copies the fw/bw pixels of a chunk of an image into the input buffer of an action, in the
+ * layout of s->informat.
+ * @param s The state shared by all cards.
+ * @param image The image.
+ * @param chunk The columns of the image to be copied.
+ * @param ibuff The input buffer.
+ * @param offset The pixels of the action ahead of this chunk in ibuff.
+ * @param name The name of the image, for the errors.
+ */
+static void pack_image(struct sched_ctx *s, const InputImage &image, const line_chunk_t &chunk,
+		float *ibuff, unsigned int offset, const std::string &name)
+{
+	const unsigned int pixels = chunk.cols * HIGHT_IN_PIX;
+	/* The backward image mirrors the columns: the chunk ends as far from its start */
+	const float *image_fw = image.image_fw + chunk.start * HIGHT_IN_PIX;
+	const float *image_bw = image.image_bw + (image.numberOfColumns - chunk.start - chunk.cols) * HIGHT_IN_PIX;
+
+#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
+	/* Ensure that the casting space is 8-bits FIXME: No-support so far for arbitrary fixed point type for image, when casting is done in SW. */
+	assert(sizeof(DTYPE_IMG) == 1);
+	/* Quantize the fw/bw data of every image from float to DTYPE_IMG (see quantize.hpp) and store the raw bytes on the 1st byte of a float.
+	 * This layout does not utilize the 2nd-4th bytes of float, leading to bandwidth underutilization at 75%. However this is only a workaround for Xilinx VHLS 2017.4
+	 * which seems to have a bug with casting in HW (the generated RTL is producing 0s, compared to v2017.2 which was ok. Nornally, casting has to be done in HW.
+	 * The dense layout (IN_FMT_PACKED8, option -P) avoids the underutilization: one DTYPE_IMG per byte, 64 pixels per 512b transfer.
+	 */
+	if (s->check_quant) {
+		size_t errors = quantize_img_check(image_fw, pixels) + quantize_img_check(image_bw, pixels);
+		if (errors && (DEBUG_LEVEL >= LOG_ERROR)) fprintf(stderr, "ERROR: quantizer differs from the DTYPE_IMG cast on %lu pixels of image %s\n",
+				(unsigned long)errors, name.c_str());
+		s->quant_errors += errors;
+	}
+	if (s->informat == IN_FMT_PACKED8) {
+		int8_t *pbuff = (int8_t*)ibuff;
+		quantize_img_packed(image_fw, pbuff + offset, pixels);
+		quantize_img_packed(image_bw, pbuff + offset + pixels, pixels);
+	}
+	else {
+		uint32_t *sbuff = (uint32_t*)ibuff;
+		quantize_img_slots(image_fw, sbuff + offset, pixels);
+		quantize_img_slots(image_bw, sbuff + offset + pixels, pixels);
+	}
+#else
+	memcpy(ibuff + offset, image_fw, pixels * sizeof(float));
+	memcpy(ibuff + offset + pixels, image_bw, pixels * sizeof(float));
+#endif
+}
+
+/**
+ * @brief Loads an image and splits it into the chunks of the action.
+ * @param s The state shared by all cards.
+ * @param item The image.
+ * @return The image in flight, to be handed to line_close() once all its chunks are inferred.
+ */
+static struct line_ctx *line_open(struct sched_ctx *s, const image_item_t &item)
+{
+	struct line_ctx *line = new line_ctx;
+
+	line->item = item;
+	load_image(line->image, item.image, s->cache);
+	line_chunks(line->image.image_fw, line->image.numberOfColumns, line->chunks);
+	line->labels.resize(line->chunks.size());
+	line->packed = 0;
+	line->done = 0;
+	if ((line->chunks.size() > 1) && (DEBUG_LEVEL >= LOG_INFO))
+		fprintf(stdout, "INFO: image %u of %u columns is inferred as %u chunks\n", item.idx,
+				line->image.numberOfColumns, (unsigned int)line->chunks.size());
+	return line;
+}
+
+/**
+ * @brief Merges the labels of the chunks of an inferred image, hands them to the output and the
+ * scoring, and releases the image.
+ * @param s The state shared by all cards.
+ * @param line The image, deleted.
+ */
+static void line_close(struct sched_ctx *s, struct line_ctx *line)
+{
+	std::vector<unsigned int> labels;
+
+	labels.swap(line->labels[0]);
+	for (unsigned int k = 1; k < line->chunks.size(); k++)
+		line_merge(labels, line->labels[k].data(), line->labels[k].size());
+
+	if (s->sink != NULL)
+		s->sink->Put(line->item.idx, line->item.image, labels.data(), labels.size());
+	if (s->verify != NULL)
+		verify_push(s->verify, line->item, labels);
+	score_push(s->score, line->item, labels);
+	delete line;
+}
+
+/**
+ * @brief The completion thread of a card. It takes the next group of ACC_CALLS_PER_ACTION images
+ * (chunks of the wide lines) from the shared queue, packs them into the input buffer of the card,
+ * executes the action and copies the predicted labels out, until the queue is empty. Any failure
+ * terminates the process.
+ * @param c The card of this thread.
+ * @param s The state shared by all cards.
+ */
+static void card_worker(struct card_ctx *c, struct sched_ctx *s)
+{
+	struct snap_job cjob;
+	struct blstm_job mjob;
+	uint16_t cols[sizeof(mjob.imgcols.cols)/sizeof(mjob.imgcols.cols[0])];
+	const ssize_t size_out = ACC_CALLS_PER_ACTION * MAX_PREDICTED_STRING_LENGTH * sizeof(uint32_t);
+	const uint8_t type_in = SNAP_ADDRTYPE_HOST_DRAM, type_out = SNAP_ADDRTYPE_HOST_DRAM;
+	const uint64_t addr_in = (unsigned long)c->ibuff, addr_out = (unsigned long)c->obuff;
+	/* The chunks waiting for a slot, in processing order */
+	std::deque<struct line_piece> pieces;
+	struct line_piece slot[ACC_CALLS_PER_ACTION] = {};
+	std::vector<struct line_ctx *> inferred;
+	image_item_t item;
+	unsigned int total_pixels_in_action, max_cols;
+	uint64_t t_start, t_exec;
+	ssize_t size_in;
+	int rc;
+
+	/* check that there are enough MMIO register entries to hold the columns of every image */
+	assert(ACC_CALLS_PER_ACTION <= sizeof(mjob.imgcols)/sizeof(mjob.imgcols.cols[0]));
+
+	/* Images are processed in groups of ACC_CALLS_PER_ACTION. The last group may be partial:
+	 * the unused slots keep 0 columns, which the action skips. */
+	while (1) {
+
+		/* Load the images of the current action only: the chunks of a wide line may take
+		 * the slots of several actions, so the images ahead wait for the next ones */
+		while (pieces.size() < ACC_CALLS_PER_ACTION) {
+			if (s->source->Take(&item, 1) == 0)
+				break;
+			struct line_ctx *line = line_open(s, item);
+			for (unsigned int k = 0; k < line->chunks.size(); k++) {
+				struct line_piece piece = { line, k };
+				pieces.push_back(piece);
+			}
+		}
+		if (pieces.empty())
+			break;
+
+		/* The slots of the action hold the chunks slot[], the results go back to their image */
+		const unsigned int imgs_in_action = std::min((size_t)ACC_CALLS_PER_ACTION, pieces.size());
+		for (unsigned int j = 0; j < imgs_in_action; j++) {
+			slot[j] = pieces.front();
+			pieces.pop_front();
+		}
+		const unsigned int i = slot[0].line->item.idx;
+
+		/* Write on MMIO register the number of columns of current image */
+	    memset(cols, 0, sizeof(mjob.imgcols));
+
+	    total_pixels_in_action = 0;
+	    max_cols = 0;
+
+	    /* Loop over every single image of the current action */
+	    t_start = stage_now_ns();
+	    for (unsigned int j = 0; j < imgs_in_action; j++) {
+	    	struct line_ctx *line = slot[j].line;
+	    	const line_chunk_t &chunk = line->chunks[slot[j].chunk];
+	    	cols[j] = chunk.cols;
+	    	max_cols = std::max(max_cols, (unsigned int)cols[j]);
+	    	log(LOG_DEBUG) << "DEBUG: card " << c->card_no << ": numberOfColumnsVec[" << line->item.idx << "] = " << cols[j] << ", total_pixels_in_action = " <<  total_pixels_in_action << std::endl;
+	    	pack_image(s, line->image, chunk, c->ibuff, total_pixels_in_action, line->item.image);
+			/* Update the number of pixels */
+	    	total_pixels_in_action += 2 * cols[j] * HIGHT_IN_PIX;
+	    	log(LOG_INFO) << "INFO: card " << c->card_no << ": numberOfColumnsVec[" << line->item.idx << "] = " <<  cols[j] << std::endl;
+	    	/* Pixels are in ibuff now, release the image once all its chunks are */
+	    	if (++line->packed == line->chunks.size())
+	    		line->image.Free();
+	    }
+
+	    stage_record(STAGE_PACK, t_start);
+
+	    size_in = total_pixels_in_action * ((s->informat == IN_FMT_PACKED8) ? sizeof(DTYPE_IMG) : sizeof(float));
+
+	    if (DEBUG_LEVEL >= LOG_INFO) printf("ACTION PARAMETERS (card %d):\n", c->card_no);
+        for (unsigned int j = 0; j < imgs_in_action; j++)
+		    if (DEBUG_LEVEL >= LOG_INFO) printf(	"  input image %u: %s, chunk %u, %u columns, %u fw-bw pixels, %u bytes\n", slot[j].line->item.idx, \
+                slot[j].line->item.image.c_str(), slot[j].chunk, cols[j], 2*cols[j]*HIGHT_IN_PIX,\
+                (unsigned int)(2*cols[j]*HIGHT_IN_PIX*((s->informat == IN_FMT_PACKED8) ? sizeof(DTYPE_IMG) : sizeof(float))));
+		if (DEBUG_LEVEL >= LOG_INFO) printf(	"  output:      %s\n"
+			"  type_in:     %x %s\n"
+			"  addr_in:     %016llx\n"
+			"  type_out:    %x %s\n"
+			"  addr_out:    %016llx\n"
+			"  size_in:     %u (0x%08lx)\n"
+			"  size_out:    %u (0x%08lx)\n",
+			s->output ? s->output : "not-provided",
+					type_in,  mem_tab[type_in],  (long long)addr_in,
+					type_out, mem_tab[type_out], (long long)addr_out,
+					(unsigned int)size_in, size_in, (unsigned int)size_out, size_out);
+
+
+		snap_prepare_blstm(&cjob, &mjob,
+				(void *)addr_in,  size_in, type_in,
+				(void *)addr_out, size_out, type_out,
+				cols, s->informat, JOB_INFER);
+
+		if (DEBUG_LEVEL >= LOG_INFO) __hexdump(stderr, &mjob, sizeof(mjob));
+
+		t_start = stage_now_ns();
+		rc = snap_action_sync_execute_job(c->action, &cjob, s->timeout);
+		t_exec = stage_record(STAGE_EXECUTE, t_start) - t_start;
+		if (rc != 0) {
+			if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: job execution on card %d %d: %s!\n", c->card_no, rc,
+					strerror(errno));
+			snap_detach_action(c->action);
+			exit(EXIT_FAILURE);
+		}
+
+		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: RETC=%x\n", cjob.retc);
+		if (cjob.retc != SNAP_RETC_SUCCESS) {
+			if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Unexpected RETC=%x on card %d!\n", cjob.retc, c->card_no);
+			snap_detach_action(c->action);
+			exit(EXIT_FAILURE);
+		}
+
+		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: Accelerator returned code on MMIO (AXILite job struct field) : %u\n", mjob.status );
+
+		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: AXI transactions registered on MMIO : In: %u(0x%x), Out: %u(0x%x)  \n", \
+				mjob.axitrans_in, mjob.axitrans_in, mjob.axitrans_out, mjob.axitrans_out);
+
+
+		if (DEBUG_LEVEL >= LOG_INFO) __hexdump(stderr, &mjob, sizeof(mjob));
+
+
+		unsigned int str_addr_index = 0;
+		t_start = stage_now_ns();
+		inferred.clear();
+		for (unsigned int j = 0; j < imgs_in_action; j++) {
+			struct line_ctx *line = slot[j].line;
+			std::vector<unsigned int> &labels = line->labels[slot[j].chunk];
+			labels.resize(mjob.imgstrlen.cols[j]);
+			log(LOG_DEBUG) << "DEBUG tb: vecPredictedStringLen[" << line->item.idx << "] = " << mjob.imgstrlen.cols[j] << std::endl;
+			for (unsigned int l = 0; l < labels.size(); l++) {
+				labels[l] = c->obuff[str_addr_index];
+				/* log(LOG_DEBUG) << "DEBUG tb: vecPredictedStringInd[" << line->item.idx << "][" << l <<\
+						"] = obuff["<< str_addr_index << "] = " << obuff[str_addr_index] << std::endl;
+				*/
+				str_addr_index++;
+			}
+			if (++line->done == line->chunks.size())
+				inferred.push_back(line);
+		}
+		stage_record(STAGE_UNPACK, t_start);
+
+		/* The labels of the images inferred by this action are final: write and score them while
+		 * the card moves on. The sink takes them in input order (see ResultSink::Put()). */
+		std::sort(inferred.begin(), inferred.end(),
+				[](const struct line_ctx *a, const struct line_ctx *b) { return a->item.idx < b->item.idx; });
+		for (unsigned int k = 0; k < inferred.size(); k++)
+			line_close(s, inferred[k]);
+
+		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: SNAP run %u blstm on card %d took %lld usec\n",
+				i, c->card_no, (long long)(t_exec / 1000));
+
+		c->actions++;
+		c->images += inferred.size();
+		c->exec_ns += t_exec;
+		c->lane_cols += total_pixels_in_action / (2 * HIGHT_IN_PIX);
+		c->lane_slots += ACC_CALLS_PER_ACTION * max_cols;
+		s->card_ns += t_exec;
+		s->card_imgs += inferred.size();
+
+	} /* while the queue holds images */
+}
+
+/**
+ * @brief Infers an image on the software engine, in the calling thread.
+ * @param image The image.
+ * @param labels The predicted labels.
+ */
+static void cpu_infer(const InputImage &image, std::vector<unsigned int> &labels)
+{
+	std::vector<line_chunk_t> chunks;
+	unsigned int chunk_labels[MAX_PREDICTED_STRING_LENGTH];
+
+	/* The engine has the buffers of the action, so that it takes the same chunks */
+	line_chunks(image.image_fw, image.numberOfColumns, chunks);
+	labels.clear();
+	for (unsigned int k = 0; k < chunks.size(); k++) {
+		const unsigned int len = cpu_engine_run(image.image_fw + chunks[k].start * HIGHT_IN_PIX,
+				image.image_bw + (image.numberOfColumns - chunks[k].start - chunks[k].cols) * HIGHT_IN_PIX,
+				chunks[k].cols, chunk_labels);
+		line_merge(labels, chunk_labels, len);
+	}
+}
+
+/**
+ * @brief A host thread inferring images on the software engine, from the same queue as the cards.
+ * It takes one image at a time, as long as its measured time per image does not exceed the time
+ * the cards would need for all the remaining images: the faster backend takes the larger share,
+ * and the host never holds back the end of the run.
+ * @param h The host thread.
+ * @param s The state shared by all cards and host threads.
+ */
+static void cpu_worker(struct cpu_ctx *h, struct sched_ctx *s)
+{
+	InputImage inputImage;
+	std::vector<unsigned int> labels;
+	image_item_t img;
+	uint64_t t_start;
+
+	while (1) {
+
+		const unsigned int card_imgs = s->card_imgs;
+		if ((h->images > 0) && (card_imgs > 0)) {
+			/* Unknown before the end of a list file: then there are plenty left */
+			const unsigned int remaining = s->source->Remaining();
+			const uint64_t cards_left_ns = (remaining == UINT_MAX) ? UINT64_MAX :
+					remaining * (s->card_ns / card_imgs) / s->cards;
+			if (h->busy_ns / h->images > cards_left_ns)
+				break;
+		}
+
+		if (s->source->Take(&img, 1) == 0)
+			break;
+
+		load_image(inputImage, img.image, s->cache);
+		t_start = stage_now_ns();
+
+		cpu_infer(inputImage, labels);
+		const unsigned int len = labels.size();
+		h->busy_ns += stage_record(STAGE_CPU, t_start) - t_start;
+		inputImage.Free();
+
+		log(LOG_INFO) << "INFO: host thread " << h->thread_no << ": image " << img.idx << ", " << len << " labels" << std::endl;
+
+		if (s->sink != NULL)
+			s->sink->Put(img.idx, img.image, labels.data(), labels.size());
+		score_push(s->score, img, labels);
+
+		h->images++;
+	}
+}
+
+/**
+ * @brief A cross-check thread (option -X): infers the sampled images again on the software
+ * engine and compares the labels with those of the cards, until the queue is closed and empty.
+ * It runs at the lowest priority, on the cycles the host has to spare.
+ * @param v The cross-check state.
+ */
+static void verify_worker(struct verify_ctx *v)
+{
+	struct verify_task task;
+	InputImage inputImage;
+	std::vector<unsigned int> labels;
+
+	if ((setpriority(PRIO_PROCESS, syscall(SYS_gettid), VERIFY_NICE) != 0) && (DEBUG_LEVEL >= LOG_WARNING))
+		fprintf(stderr, "WARNING: cannot lower the priority of a cross-check thread: %s\n", strerror(errno));
+
+	while (1) {
+		{
+			std::unique_lock<std::mutex> guard(v->lock);
+			while (v->queue.empty() && !v->closed)
+				v->ready.wait(guard);
+			if (v->queue.empty())
+				return;
+			task.item = v->queue.front().item;
+			task.labels.swap(v->queue.front().labels);
+			v->queue.pop_front();
+		}
+
+		load_image(inputImage, task.item.image, v->cache);
+		cpu_infer(inputImage, labels);
+		inputImage.Free();
+		v->checked++;
+
+		if (labels == task.labels)
+			continue;
+		v->mismatches++;
+		if (DEBUG_LEVEL >= LOG_ERROR) {
+			const size_t n = std::min(labels.size(), task.labels.size());
+			const size_t at = std::mismatch(labels.begin(), labels.begin() + n, task.labels.begin()).first - labels.begin();
+			std::ostringstream msg;
+			msg << "VERIFY: image " << task.item.idx << " (" << task.item.image << "): the labels of the card differ from the host from "
+					<< at << " on (" << task.labels.size() << " vs " << labels.size() << " labels)\n  card:";
+			for (size_t l = 0; l < task.labels.size(); l++)
+				msg << " " << task.labels[l];
+			msg << "\n  host:";
+			for (size_t l = 0; l < labels.size(); l++)
+				msg << " " << labels[l];
+			fprintf(stderr, "%s\n", msg.str().c_str());
+		}
+	}
+}
+
+/**
+ * @brief The low-latency mode (option -L): one line per action on a single card, in input order.
+ * The job is staged once, so that a line only updates its columns and input size; completion is
+ * busy-polled instead of waiting for the interrupt, and nothing is formatted on the way. Every
+ * line records the time from its pixels in host memory to its labels out (stage "line").
+ * @param c The card.
+ * @param s The state shared with the scoring.
+ */
+static void latency_worker(struct card_ctx *c, struct sched_ctx *s)
+{
+	struct snap_job cjob;
+	struct blstm_job mjob;
+	uint16_t cols[sizeof(mjob.imgcols.cols)/sizeof(mjob.imgcols.cols[0])];
+	const ssize_t size_out = ACC_CALLS_PER_ACTION * MAX_PREDICTED_STRING_LENGTH * sizeof(uint32_t);
+	const size_t pixel_size = (s->informat == IN_FMT_PACKED8) ? sizeof(DTYPE_IMG) : sizeof(float);
+	InputImage inputImage;
+	std::vector<line_chunk_t> chunks;
+	std::vector<unsigned int> labels;
+	image_item_t img;
+	int rc, idle_rc;
+
+	memset(cols, 0, sizeof(cols));
+	snap_prepare_blstm(&cjob, &mjob, (void *)c->ibuff, 0, SNAP_ADDRTYPE_HOST_DRAM,
+			(void *)c->obuff, size_out, SNAP_ADDRTYPE_HOST_DRAM, cols, s->informat, JOB_INFER);
+
+	while (s->source->Take(&img, 1) != 0) {
+
+		load_image(inputImage, img.image, s->cache);
+		const unsigned int img_cols = inputImage.numberOfColumns;
+		line_chunks(inputImage.image_fw, img_cols, chunks);
+
+		/* A line wider than the action takes one action per chunk */
+		const uint64_t t_start = stage_now_ns();
+		const uint64_t deadline = t_start + (uint64_t)s->timeout * 1000000000ull;
+		labels.clear();
+		for (unsigned int k = 0; k < chunks.size(); k++) {
+			pack_image(s, inputImage, chunks[k], c->ibuff, 0, img.image);
+			mjob.imgcols.cols[0] = chunks[k].cols;
+			mjob.in.size = 2 * chunks[k].cols * HIGHT_IN_PIX * pixel_size;
+
+			rc = snap_action_sync_execute_job_set_regs(c->action, &cjob);
+			if (rc == 0)
+				rc = snap_action_start(c->action);
+			if (rc == 0) {
+				while (!snap_action_is_idle(c->action, &idle_rc))
+					if (stage_now_ns() > deadline) {
+						rc = -ETIME;
+						break;
+					}
+			}
+			if (rc == 0)
+				rc = snap_action_sync_execute_job_check_completion(c->action, &cjob, s->timeout);
+			if ((rc != 0) || (cjob.retc != SNAP_RETC_SUCCESS)) {
+				if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: job execution on card %d %d, RETC=%x: %s!\n", c->card_no, rc,
+						cjob.retc, strerror(errno));
+				snap_detach_action(c->action);
+				exit(EXIT_FAILURE);
+			}
+
+			line_merge(labels, c->obuff, mjob.imgstrlen.cols[0]);
+			c->actions++;
+			c->lane_cols += chunks[k].cols;
+			c->lane_slots += ACC_CALLS_PER_ACTION * chunks[k].cols;
+		}
+		c->exec_ns += stage_record(STAGE_LINE, t_start) - t_start;
+		inputImage.Free();
+
+		if (s->sink != NULL)
+			s->sink->Put(img.idx, img.image, labels.data(), labels.size());
+		if (s->verify != NULL)
+			verify_push(s->verify, img, labels);
+		score_push(s->score, img, labels);
+
+		c->images++;
+	}
+}
+
+/**
+ * @brief The layout of a batch of staged actions, the same in card DRAM (from address 0) and in
+ * the staging buffer of the host: the table of descriptors, the labels of every action, then the
+ * pixels of the actions one after the other.
+ * @param staged The actions of the batch at most.
+ * @param out_base The offset of the labels of the 1st action.
+ * @param in_base The offset of the pixels of the 1st action.
+ * @return The size of the batch at most.
+ */
+static size_t staged_layout(unsigned int staged, uint64_t *out_base, uint64_t *in_base)
+{
+	const size_t size_out = STAGED_ROUND(ACC_CALLS_PER_ACTION * MAX_PREDICTED_STRING_LENGTH * sizeof(uint32_t));
+	const size_t size_in = STAGED_ROUND(ACC_CALLS_PER_ACTION * MAX_PIXELS_PER_IMAGE * sizeof(float));
+
+	*out_base = (uint64_t)staged * sizeof(blstm_desc_t);
+	*in_base = *out_base + (uint64_t)staged * size_out;
+	return *in_base + (size_t)staged * size_in;
+}
+
+/**
+ * @brief Executes a job of a batch staged in card DRAM (JOB_COPY, JOB_INFER_BATCH). Any failure
+ * terminates the process.
+ * @param c The card.
+ * @param s The state shared by all cards.
+ * @param mjob The job, holding its status afterwards.
+ * @param addr_in The address of the input, in host or card DRAM after type_in.
+ * @param size_in The size of the input in bytes.
+ * @param type_in The type of the input.
+ * @param addr_out The address of the output, in host or card DRAM after type_out.
+ * @param type_out The type of the output.
+ * @param jobtype The kind of job.
+ */
+static void staged_execute(struct card_ctx *c, struct sched_ctx *s, struct blstm_job *mjob,
+		uint64_t addr_in, uint32_t size_in, uint8_t type_in,
+		uint64_t addr_out, uint8_t type_out, uint32_t jobtype)
+{
+	struct snap_job cjob;
+	uint16_t cols[sizeof(mjob->imgcols.cols)/sizeof(mjob->imgcols.cols[0])];
+	int rc;
+
+	memset(cols, 0, sizeof(cols));
+	snap_prepare_blstm(&cjob, mjob, (void *)addr_in, size_in, type_in,
+			(void *)addr_out, size_in, type_out, cols, s->informat, jobtype);
+
+	rc = snap_action_sync_execute_job(c->action, &cjob, s->timeout);
+	/* A batch reports the errors of all its actions on its status */
+	if ((rc != 0) || (cjob.retc != SNAP_RETC_SUCCESS) || (mjob->status & ACC_ERR_MASK)) {
+		if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: %s job on card %d %d, RETC=%x, status=%x: %s!\n",
+				(jobtype == JOB_COPY) ? "copy" : "batch", c->card_no, rc, cjob.retc, mjob->status, strerror(errno));
+		snap_detach_action(c->action);
+		exit(EXIT_FAILURE);
+	}
+}
+
+/**
+ * @brief The completion thread of a card in the offline mode (option -S). It packs up to s->staged
+ * actions of images (chunks of the wide lines) from the shared queue at a time, copies them to the
+ * card DRAM (JOB_COPY), infers them all in a single action call walking their descriptors
+ * (JOB_INFER_BATCH), then copies their descriptors and labels back, until the queue is empty. Any
+ * failure terminates the process.
+ * @param c The card of this thread.
+ * @param s The state shared by all cards.
+ */
+static void staged_worker(struct card_ctx *c, struct sched_ctx *s)
+{
+	struct blstm_job mjob;
+	const size_t size_out = STAGED_ROUND(ACC_CALLS_PER_ACTION * MAX_PREDICTED_STRING_LENGTH * sizeof(uint32_t));
+	const size_t pixel_size = (s->informat == IN_FMT_PACKED8) ? sizeof(DTYPE_IMG) : sizeof(float);
+	blstm_desc_t *descs = (blstm_desc_t *)c->sbuff;
+	/* The chunks waiting for a slot, in processing order */
+	std::deque<struct line_piece> pieces;
+	/* The chunks of the slots of every action of the batch */
+	std::vector<struct line_piece> slots(s->staged * ACC_CALLS_PER_ACTION);
+	std::vector<struct line_ctx *> inferred;
+	image_item_t item;
+	uint64_t out_base, in_base, in_end, t_start, t_exec;
+	uint64_t lane_cols, lane_slots;
+	unsigned int actions;
+
+	staged_layout(s->staged, &out_base, &in_base);
+
+	while (1) {
+
+		/* Pack the actions of the batch, each one as card_worker() would */
+		t_start = stage_now_ns();
+		in_end = in_base;
+		lane_cols = lane_slots = 0;
+		for (actions = 0; actions < s->staged; actions++) {
+			while (pieces.size() < ACC_CALLS_PER_ACTION) {
+				if (s->source->Take(&item, 1) == 0)
+					break;
+				struct line_ctx *line = line_open(s, item);
+				for (unsigned int k = 0; k < line->chunks.size(); k++) {
+					struct line_piece piece = { line, k };
+					pieces.push_back(piece);
+				}
+			}
+			if (pieces.empty())
+				break;
+
+			blstm_desc_t *desc = &descs[actions];
+			struct line_piece *slot = &slots[actions * ACC_CALLS_PER_ACTION];
+			unsigned int total_pixels_in_action = 0, max_cols = 0;
+
+			memset(desc, 0, sizeof(*desc));
+			for (unsigned int j = 0; j < ACC_CALLS_PER_ACTION; j++) {
+				if (pieces.empty()) {
+					slot[j].line = NULL;
+					continue;
+				}
+				slot[j] = pieces.front();
+				pieces.pop_front();
+
+				struct line_ctx *line = slot[j].line;
+				const line_chunk_t &chunk = line->chunks[slot[j].chunk];
+				desc->imgcols.cols[j] = chunk.cols;
+				max_cols = std::max(max_cols, chunk.cols);
+				pack_image(s, line->image, chunk, (float *)(c->sbuff + in_end), total_pixels_in_action, line->item.image);
+				total_pixels_in_action += 2 * chunk.cols * HIGHT_IN_PIX;
+				if (++line->packed == line->chunks.size())
+					line->image.Free();
+			}
+
+			desc->in_addr = in_end;
+			desc->in_size = total_pixels_in_action * pixel_size;
+			desc->out_addr = out_base + actions * size_out;
+			desc->informat = s->informat;
+			in_end += STAGED_ROUND(desc->in_size);
+			lane_cols += total_pixels_in_action / (2 * HIGHT_IN_PIX);
+			lane_slots += ACC_CALLS_PER_ACTION * max_cols;
+		}
+		if (actions == 0)
+			break;
+		stage_record(STAGE_PACK, t_start);
+
+		/* The whole batch goes to the card DRAM at once, the labels area along */
+		t_start = stage_now_ns();
+		staged_execute(c, s, &mjob, (unsigned long)c->sbuff, in_end, SNAP_ADDRTYPE_HOST_DRAM,
+				0, SNAP_ADDRTYPE_CARD_DRAM, JOB_COPY);
+		t_start = stage_record(STAGE_COPY, t_start);
+
+		staged_execute(c, s, &mjob, 0, actions * sizeof(blstm_desc_t), SNAP_ADDRTYPE_CARD_DRAM,
+				0, SNAP_ADDRTYPE_CARD_DRAM, JOB_INFER_BATCH);
+		t_exec = stage_record(STAGE_EXECUTE, t_start) - t_start;
+		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: batch of %u actions on card %d took %lld usec, status %x\n",
+				actions, c->card_no, (long long)(t_exec / 1000), mjob.status);
+
+		/* The descriptors and the labels come back in place */
+		t_start = stage_now_ns();
+		staged_execute(c, s, &mjob, 0, out_base + actions * size_out, SNAP_ADDRTYPE_CARD_DRAM,
+				(unsigned long)c->sbuff, SNAP_ADDRTYPE_HOST_DRAM, JOB_COPY);
+		stage_record(STAGE_COPY, t_start);
+
+		t_start = stage_now_ns();
+		inferred.clear();
+		for (unsigned int a = 0; a < actions; a++) {
+			const blstm_desc_t *desc = &descs[a];
+			const unsigned int *obuff = (const unsigned int *)(c->sbuff + desc->out_addr);
+			unsigned int str_addr_index = 0;
+
+			if (desc->status & ACC_ERR_MASK) {
+				if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: action %u of a batch on card %d, status=%x\n",
+						a, c->card_no, desc->status);
+				snap_detach_action(c->action);
+				exit(EXIT_FAILURE);
+			}
+			for (unsigned int j = 0; j < ACC_CALLS_PER_ACTION; j++) {
+				struct line_ctx *line = slots[a * ACC_CALLS_PER_ACTION + j].line;
+				if (line == NULL)
+					continue;
+				std::vector<unsigned int> &labels = line->labels[slots[a * ACC_CALLS_PER_ACTION + j].chunk];
+				labels.assign(obuff + str_addr_index, obuff + str_addr_index + desc->imgstrlen.cols[j]);
+				str_addr_index += desc->imgstrlen.cols[j];
+				if (++line->done == line->chunks.size())
+					inferred.push_back(line);
+			}
+		}
+		stage_record(STAGE_UNPACK, t_start);
+
+		/* As in card_worker(), the images inferred by this batch are written and scored in input order */
+		std::sort(inferred.begin(), inferred.end(),
+				[](const struct line_ctx *a, const struct line_ctx *b) { return a->item.idx < b->item.idx; });
+		for (unsigned int k = 0; k < inferred.size(); k++)
+			line_close(s, inferred[k]);
+
+		c->actions += actions;
+		c->images += inferred.size();
+		c->exec_ns += t_exec;
+		c->lane_cols += lane_cols;
+		c->lane_slots += lane_slots;
+		s->card_ns += t_exec;
+		s->card_imgs += inferred.size();
+
+	} /* while the queue holds images */
+}
+
+/**
+ * @brief Loads a model on a card (JOB_LOAD_WEIGHTS): the actions that follow run on it.
+ * @param c The card.
+ * @param weights The NUMBER_OF_WEIGHTS weights, see model_blob.hpp.
+ * @param timeout The timeout of the job in sec.
+ * @return 0 upon success, else the card keeps its previous model.
+ */
+static int card_load_model(struct card_ctx *c, const std::vector<float> &weights, unsigned long timeout)
+{
+	struct snap_job cjob;
+	struct blstm_job mjob;
+	uint16_t cols[sizeof(mjob.imgcols.cols)/sizeof(mjob.imgcols.cols[0])];
+	const size_t size_in = weights.size() * sizeof(float);
+	uint64_t t_start;
+	int rc;
+
+	float *wbuff = (float *)snap_malloc(size_in);
+	if (wbuff == NULL)
+		return -ENOMEM;
+	memcpy(wbuff, weights.data(), size_in);
+
+	memset(cols, 0, sizeof(cols));
+	snap_prepare_blstm(&cjob, &mjob, (void *)wbuff, size_in, SNAP_ADDRTYPE_HOST_DRAM,
+			(void *)c->obuff, 0, SNAP_ADDRTYPE_HOST_DRAM, cols, IN_FMT_FLOAT32, JOB_LOAD_WEIGHTS);
+
+	t_start = stage_now_ns();
+	rc = snap_action_sync_execute_job(c->action, &cjob, timeout);
+	if ((rc == 0) && ((cjob.retc != SNAP_RETC_SUCCESS) || !(mjob.status & ACC_WEIGHTS_LOADED)))
+		rc = -EIO;
+	if (rc != 0) {
+		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: loading the model on card %d %d, RETC=%x, status=%x\n",
+				c->card_no, rc, cjob.retc, mjob.status);
+	}
+	else
+		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: model of %u weights loaded on card %d in %lld usec\n",
+				(unsigned int)weights.size(), c->card_no, (long long)((stage_now_ns() - t_start) / 1000));
+
+	__free(wbuff);
+	return rc;
+}
+
+/**
+ * @brief Binds a thread to the CPUs of a set. Failures only cost the binding.
+ */
+static void bind_thread(pthread_t thread, const cpu_set_t *cpus)
+{
+	int rc = pthread_setaffinity_np(thread, sizeof(*cpus), cpus);
+	if ((rc != 0) && (DEBUG_LEVEL >= LOG_WARNING))
+		fprintf(stderr, "WARNING: cannot bind a thread to its CPUs: %s\n", strerror(rc));
+}
+
+
+
 /**
  * @brief The main function. It is used both for HW and SW action.
  */
 int main(int argc, char *argv[])
 {
 	int ch, rc = 0;
-	int card_no = 0;
-	struct snap_card *card = NULL;
-	struct snap_action *action = NULL;
+	std::vector<int> card_nos;
+	int all_cards = 0;
 	char device[128];
-	struct snap_job cjob;
-	struct blstm_job mjob;
+	struct sched_ctx sched;
+	struct score_ctx score;
 	const char *input_img_dir = NULL, *input_grt_dir = NULL;
+	const char *list_file = NULL;
 	//const char *input_grt_dir = NULL;
 	const char *output = NULL;
+	bool binary_out = false;
 	unsigned long timeout = 600;
 	const char *space = "CARD_RAM";
-	struct timeval etime[MAX_NUMBER_IMAGES_TEST_SET+1], stime[MAX_NUMBER_IMAGES_TEST_SET+1];
-	long long snap_action_total_time = 0;
+	const char *json = NULL;
+	unsigned int window = REORDER_WINDOW_DEFAULT;
+	unsigned int host_threads = 0, host_images = 0;
+	const char *cache_dir = NULL;
+	const char *model_dir = NULL;
+	std::vector<float> model;
+	unsigned int staged = 0;
+	size_t size_staged = 0;
+	int latency = 0, latency_cpu = -1;
+	ImageCache cache;
+	ImageSource source;
+	unsigned int imgs;
+	uint64_t lane_cols = 0, lane_slots = 0;
+	uint64_t t_all;
+	unsigned int actions = 0;
 	ssize_t size_in, size_out;
-	float *ibuff = NULL;
-	unsigned int *obuff = NULL;
-	char **filenames = NULL;
 	uint8_t type_in = SNAP_ADDRTYPE_HOST_DRAM;
 	uint64_t addr_in = 0x0ull;
 	uint8_t type_out = SNAP_ADDRTYPE_HOST_DRAM;
 	uint64_t addr_out = 0x0ull;
 	int verify = 0;
+	double verify_rate = VERIFY_RATE_DEFAULT;
+	double verify_max = VERIFY_MISMATCH_MAX_DEFAULT;
+	struct verify_ctx check;
 	int exit_code = EXIT_SUCCESS;
 	snap_action_flag_t action_irq = (snap_action_flag_t)(SNAP_ACTION_DONE_IRQ | SNAP_ATTACH_IRQ);
-	unsigned int total_pixels_in_action = 0;
 	std::string inputFileImageDir, inputFileGroundTruthDir;
 	unsigned int hw_threads = HW_THREADS_PER_ACTION;
+	uint32_t informat = IN_FMT_FLOAT32;
+	int check_quant = 0;
+	size_t quant_errors = 0;
 
-	gettimeofday(&stime[MAX_NUMBER_IMAGES_TEST_SET], NULL);
+	t_all = stage_now_ns();
 
 	while (1) {
 		int option_index = 0;
@@ -184,7 +1279,9 @@ int main(int argc, char *argv[])
 			{ "card",	 	required_argument, NULL, 'C' },
 			{ "input_img_dir",	required_argument, NULL, 'i' },
 			{ "input_grt_dir",	required_argument, NULL, 'g' },
-			{ "output",		no_argument	 , NULL, 'o' },
+			{ "list",		required_argument, NULL, 'l' },
+			{ "output",		required_argument, NULL, 'o' },
+			{ "binary-out",		no_argument	 , NULL, 'B' },
 			{ "src-type",		required_argument, NULL, 'A' },
 			{ "src-addr",	 	required_argument, NULL, 'a' },
 			{ "dst-type",	 	required_argument, NULL, 'D' },
@@ -192,7 +1289,18 @@ int main(int argc, char *argv[])
 			{ "num_hw_threads",	required_argument, NULL, 'n' },
 			{ "timeout",	 	required_argument, NULL, 't' },
 			{ "verify",	 	no_argument	 , NULL, 'X' },
+			{ "verify-rate",	required_argument, NULL, 'R' },
+			{ "verify-max",		required_argument, NULL, 'T' },
 			{ "no-irq",	 	no_argument	 , NULL, 'N' },
+			{ "packed",	 	no_argument	 , NULL, 'P' },
+			{ "check-quant",	no_argument	 , NULL, 'Q' },
+			{ "json",		required_argument, NULL, 'J' },
+			{ "reorder-window",	required_argument, NULL, 'W' },
+			{ "host-threads",	required_argument, NULL, 'H' },
+			{ "cache",		required_argument, NULL, 'K' },
+			{ "latency",		required_argument, NULL, 'L' },
+			{ "model",		required_argument, NULL, 'M' },
+			{ "staged",		required_argument, NULL, 'S' },
 			{ "version",	 	no_argument	 , NULL, 'V' },
 			{ "verbose",	 	no_argument	 , NULL, 'v' },
 			{ "help",	 	no_argument	 , NULL, 'h' },
@@ -200,14 +1308,19 @@ int main(int argc, char *argv[])
 		};
 
 		ch = getopt_long(argc, argv,
-				 "C:i:g:o:A:a:D:d:n:t:XNVvh",
+				 "C:i:g:l:o:BA:a:D:d:n:t:XR:T:NPQJ:W:H:K:L:M:S:Vvh",
 				 long_options, &option_index);
 		if (ch == -1)
 			break;
 
 		switch (ch) {
 		case 'C':
-			card_no = strtol(optarg, (char **)NULL, 0);
+			card_nos.clear();
+			all_cards = parse_cards(optarg, card_nos);
+			if (all_cards < 0) {
+				usage(argv[0]);
+				exit(EXIT_FAILURE);
+			}
 			break;
 		case 'i':
 			input_img_dir = optarg;
@@ -215,9 +1328,15 @@ int main(int argc, char *argv[])
 		case 'g':
 			input_grt_dir = optarg;
 			break;
+		case 'l':
+			list_file = optarg;
+			break;
 		case 'o':
 			output = optarg;
 			break;
+		case 'B':
+			binary_out = true;
+			break;
 		case 'n':
 			hw_threads = __str_to_num(optarg);
 			break;
@@ -257,6 +1376,14 @@ int main(int argc, char *argv[])
 		case 'X':
 			verify++;
 			break;
+		case 'R':
+			verify_rate = strtod(optarg, (char **)NULL);
+			verify++;
+			break;
+		case 'T':
+			verify_max = strtod(optarg, (char **)NULL);
+			verify++;
+			break;
 			/* service */
 		case 'V':
 			printf("%s\n", version);
@@ -271,6 +1398,42 @@ int main(int argc, char *argv[])
 		case 'N':
 			action_irq = (snap_action_flag_t)0;
 			break;
+		case 'P':
+#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
+			informat = IN_FMT_PACKED8;
+#else
+			if (DEBUG_LEVEL >= LOG_WARNING) fprintf(stderr, "WARNING: packed input requires IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1, ignoring -P\n");
+#endif
+			break;
+		case 'Q':
+#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
+			check_quant = 1;
+#else
+			if (DEBUG_LEVEL >= LOG_WARNING) fprintf(stderr, "WARNING: the host quantizer requires IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1, ignoring -Q\n");
+#endif
+			break;
+		case 'J':
+			json = optarg;
+			break;
+		case 'W':
+			window = strtoul(optarg, (char **)NULL, 0);
+			break;
+		case 'H':
+			host_threads = strtoul(optarg, (char **)NULL, 0);
+			break;
+		case 'K':
+			cache_dir = optarg;
+			break;
+		case 'L':
+			latency = 1;
+			latency_cpu = strtol(optarg, (char **)NULL, 0);
+			break;
+		case 'M':
+			model_dir = optarg;
+			break;
+		case 'S':
+			staged = strtoul(optarg, (char **)NULL, 0);
+			break;
 		default:
 			usage(argv[0]);
 			exit(EXIT_FAILURE);
@@ -287,6 +1450,11 @@ int main(int argc, char *argv[])
 		inputFileImageDir = input_img_dir;
 		inputFileGroundTruthDir = input_grt_dir;
 	}
+	else if (list_file != NULL) {
+		/* The paths of the list are taken as they are, or relative to the directories given */
+		inputFileImageDir = (input_img_dir != NULL) ? input_img_dir : "";
+		inputFileGroundTruthDir = (input_grt_dir != NULL) ? input_grt_dir : "";
+	}
 	else {
 			usage(argv[0]);
 			exit(EXIT_FAILURE);
@@ -294,113 +1462,98 @@ int main(int argc, char *argv[])
 
 	assert (hw_threads == HW_THREADS_PER_ACTION); // FIXME
 
+	if (card_nos.empty())
+		card_nos.push_back(0);
+
+	/* The low-latency mode polls a single card for one line at a time */
+	if (latency) {
+		if (((card_nos.size() > 1) || all_cards || host_threads) && (DEBUG_LEVEL >= LOG_WARNING))
+			fprintf(stderr, "WARNING: the low-latency mode runs on card %d only, without host threads\n", card_nos[0]);
+		card_nos.resize(1);
+		all_cards = 0;
+		host_threads = 0;
+		window = 0;
+		action_irq = (snap_action_flag_t)0;
+		if (staged && (DEBUG_LEVEL >= LOG_WARNING))
+			fprintf(stderr, "WARNING: the low-latency mode does not stage the actions in card DRAM\n");
+		staged = 0;
+	}
+
+	if ((type_in != SNAP_ADDRTYPE_HOST_DRAM) || (type_out != SNAP_ADDRTYPE_HOST_DRAM) || addr_in || addr_out)
+		if (DEBUG_LEVEL >= LOG_WARNING) fprintf(stderr, "WARNING: -A/-a/-D/-d are ignored, the buffers of every card are allocated in host DRAM\n");
+
+	/* A batch of the offline mode fits in the card DRAM */
+	if (staged) {
+		uint64_t out_base, in_base;
+		size_staged = staged_layout(staged, &out_base, &in_base);
+		if (size_staged > CARD_DRAM_SIZE) {
+			staged = CARD_DRAM_SIZE / (size_staged / staged);
+			size_staged = staged_layout(staged, &out_base, &in_base);
+			if (DEBUG_LEVEL >= LOG_WARNING) fprintf(stderr, "WARNING: the card DRAM holds %u actions per batch at most\n", staged);
+		}
+	}
+
 	// The initialization of the alphabet
 	Alphabet alphabet;
 	alphabet.Init("/tools/projects/snap/actions/hls_blstm/data/alphabet/alphabet.txt");
 	//alphabet.Init("../data/alphabet/alphabet.txt");
 	//alphabet.Print();
-	// Return the list of images' file names
-	std::vector<std::string> listOfImages = open(inputFileImageDir);
-	unsigned int imgs = listOfImages.size();
-	// Return the list of ground truth' file names
-	std::vector<std::string> listOfGroundTruth = open(inputFileGroundTruthDir);
-	unsigned int imgs_gd = listOfImages.size();
-
-	/* Check that there are equal number of image files and groundtruth files */
-	assert(((imgs == imgs_gd) != 0) && ("#Input Images / #Groundtruth shall be equal and at least one."));
-
-	//----------------------------------------------------------------------
-	// Read Images
-	//----------------------------------------------------------------------
-
-	filenames = (char**)malloc(listOfImages.size() * sizeof(char*));
-	assert (filenames != NULL);
-	std::vector<InputImage> vecInputImage;
-	vecInputImage.resize(listOfImages.size());
-
-	for(unsigned int i = 0; i < listOfImages.size(); i++)
-	{
-		std::string inputFileImage = inputFileImageDir + listOfImages.at(i);
-		filenames[i] = (char*)malloc(NAME_BUFF * sizeof(char));
-		assert (filenames[i] != NULL);
-		vecInputImage.at(i).Init(inputFileImage);
-        if (strlen(filenames[i]) <= NAME_BUFF) {
-            strcpy(filenames[i], inputFileImage.c_str());
-        }
-        else {
-            if (DEBUG_LEVEL >= LOG_CRITICAL) printf("ERROR: filename length is higher (%u) than limit (%u)\n", \
-                (unsigned int)strlen(filenames[i]), NAME_BUFF);
-            exit(EXIT_FAILURE);
-        }
+	/* The images are taken a window at a time: a list file is read as they are processed, so that
+	 * nothing grows with the number of images; the directories are listed and sorted up front */
+	if (list_file != NULL) {
+		rc = source.Init(list_file, inputFileImageDir, inputFileGroundTruthDir, window);
+		if (rc != 0)
+			return rc;
 	}
-
-	log(LOG_DEBUG) << "DEBUG: listOfImages.size() = " << listOfImages.size() << "\n";
-
-	//----------------------------------------------------------------------
-	// Read Ground Truth
-	//----------------------------------------------------------------------
-
-	std::vector<GroundTruth> vecGroundTruth;
-	vecGroundTruth.resize(listOfImages.size());
-
-	for(unsigned int i = 0; i < listOfImages.size(); i++)
-	{
-		std::string inputFileGroundTruth = inputFileGroundTruthDir + listOfGroundTruth.at(i);
-
-		vecGroundTruth.at(i).Init(inputFileGroundTruth);
+	else {
+		// Return the list of images' file names
+		std::vector<std::string> listOfImages = open(inputFileImageDir);
+		imgs = listOfImages.size();
+		// Return the list of ground truth' file names
+		std::vector<std::string> listOfGroundTruth = open(inputFileGroundTruthDir);
+		unsigned int imgs_gd = listOfGroundTruth.size();
+
+		/* Check that there are equal number of image files and groundtruth files */
+		assert((imgs == imgs_gd) && (imgs > 0) && ("#Input Images / #Groundtruth shall be equal and at least one."));
+
+		log(LOG_DEBUG) << "DEBUG: listOfImages.size() = " << listOfImages.size() << "\n";
+		source.Init(inputFileImageDir, inputFileGroundTruthDir, listOfImages, listOfGroundTruth, window);
 	}
-
-	//----------------------------------------------------------------------
-	// Predicted string
-	//----------------------------------------------------------------------
-
-	std::vector<std::string> vecPredictedString;
-	vecPredictedString.resize(listOfImages.size());
+	/* Reported as the source applies it */
+	window = source.Window();
 
 	//----------------------------------------------------------------------
 	// Allocation of the resources
 	//----------------------------------------------------------------------
 
-	// Verify that we hold enough space for the loaded images of folder provided
-	assert(listOfImages.size() <= MAX_NUMBER_IMAGES_TEST_SET);
-
-
-	/* Allocate space for predicted length and string ids */
-	unsigned int *vecPredictedStringLen = (unsigned int *)malloc(listOfImages.size()\
-	 * sizeof(unsigned int ));
-	assert (vecPredictedStringLen != NULL);
-	unsigned int **vecPredictedStringInd = (unsigned int **)malloc(listOfImages.size()\
-	 * sizeof(unsigned int *));
-	assert (vecPredictedStringInd != NULL);
-	for(unsigned int i = 0; i < listOfImages.size(); i++) {
-		vecPredictedStringInd[i] = (unsigned int *)malloc(MAX_NUMBER_COLUMNS_TEST_SET\
-	 * sizeof(unsigned int));
-	 assert (vecPredictedStringInd[i] != NULL);
- 	}
-
-	double *error = new double [listOfImages.size()];
-	double errorSum = 0.0;
+	/* Images are loaded per action and released right after it, and their labels once written
+	 * and scored: memory is bounded by the images in flight, regardless of the dataset size. */
 	double accuracy = 0.0;
 
-
-	short unsigned int numberOfColumnsVec[MAX_NUMBER_IMAGES_TEST_SET];
-
-
-	/* if output file is defined, use that as output */
+	/* if output file is defined, use that as output: the sink keeps it open and writes
+	 * the labels in the order of the images, whatever card processed them */
+	ResultSink sink;
 	if (output != NULL) {
-
-		/* Erase file, since we append results later */
-		FILE *fp = fopen(output, "w");
-		if (!fp) {
-		  if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot open file %s for writing: %s\n",
-                		output, strerror(errno));
-		  return -ENODEV;
-		}
-		fclose(fp);
+		/* Within a window the images are processed out of order (see ImageSource), and a card
+		 * may hand over the images ahead of a wide line before the line itself */
+		rc = sink.Open(output, binary_out, std::max(2 * (window + ACC_CALLS_PER_ACTION), (unsigned int)RESULT_SINK_DEPTH));
+		if (rc != 0)
+			return rc;
 	}
 	else
 		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stderr, "INFO: no output file provided, verification only with sw.\n");
 
+	if ((cache_dir != NULL) && (cache.Init(cache_dir) != 0))
+		return -ENODEV;
+
+	/* A model of its own replaces the one of the bitstream on every card, and the one of the software engine */
+	if (model_dir != NULL) {
+		rc = model_blob_read(model_dir, model);
+		if (rc != 0)
+			return rc;
+		cpu_engine_load(model.data());
+	}
+
 
 	//====================================================================================================================================================================================================================
 	// START
@@ -409,303 +1562,294 @@ int main(int argc, char *argv[])
 	log(LOG_INFO) << "Start ..." << std::endl;
 
 	// Starting point - the first time stemp
-	time_t t1 = time(0);
+	const uint64_t t1 = stage_now_ns();
 
-	/* source buffer */
+	/* Open the cards. Every card gets its own action and I/O buffers */
 	size_in = ACC_CALLS_PER_ACTION * MAX_PIXELS_PER_IMAGE * sizeof(float); // for fw and bw
-	ibuff = (float*)snap_malloc(size_in);
-	if (ibuff == NULL) {
-		log(LOG_ERROR) << "Error on allocating ibuf. Aborting...\n";
-		exit(EXIT_FAILURE);
-	}
-	memset(ibuff, 0x0, size_in);
-	type_in = SNAP_ADDRTYPE_HOST_DRAM;
-	addr_in = (unsigned long)ibuff;
-
-
-	/* output buffer */
 	size_out = ACC_CALLS_PER_ACTION * MAX_PREDICTED_STRING_LENGTH * sizeof(uint32_t);
-	obuff = (unsigned int*)snap_malloc(size_out);
-	if (obuff == NULL) {
-		log(LOG_ERROR) << "Error on allocating obuf. Aborting...\n";
-		exit(EXIT_FAILURE);
-	}
-	type_out = SNAP_ADDRTYPE_HOST_DRAM;
-	addr_out = (unsigned long)obuff;
-
-
-	/* check that there are enough MMIO register entries to hold the columns of every image */
-	assert(ACC_CALLS_PER_ACTION <= sizeof(mjob.imgcols)/sizeof(mjob.imgcols.cols[0]));
-
-	/* check that inputs are multiples of what accelerator is waiting for every iteration */
-	assert (ceil((float)listOfImages.size() / ACC_CALLS_PER_ACTION) == floor((float)listOfImages.size() / ACC_CALLS_PER_ACTION));
-	/* previous assertion verifies that action_loops is integer FIXME: should update it to any case of reminder */
-
-	uint16_t cols[8];
-
-
-	snprintf(device, sizeof(device)-1, "/dev/cxl/afu%d.0s", card_no);
-	card = snap_card_alloc_dev(device, SNAP_VENDOR_ID_IBM,
-			 SNAP_DEVICE_ID_SNAP);
-	if (card == NULL) {
-		if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: failed to open card /dev/cxl/afu%u.0s: %s\n",
-				card_no, strerror(errno));
-		__free(obuff);
-		__free(ibuff);
-		exit(EXIT_FAILURE);
-	}
-
-	action = snap_attach_action(card, BLSTM_ACTION_TYPE, action_irq, 60);
-	if (action == NULL) {
-		if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: failed to attach action %u: %s\n",
-				card_no, strerror(errno));
-		snap_card_free(card);
-		exit(EXIT_FAILURE);
-	}
-
-
-	/* Main loop over the provided image dataset. Images are processed in groups of ACC_CALLS_PER_ACTION */
-	for(unsigned int i = 0; i < vecInputImage.size(); i += ACC_CALLS_PER_ACTION) {
-
-		/* Write on MMIO register the number of columns of current image */
-	    memset(cols, 0, sizeof(mjob.imgcols));
-
-		/* Write on MMIO register the number of columns of current image */
-	    memset(mjob.imgstrlen.cols, 0, sizeof(mjob.imgstrlen));
-
-	    total_pixels_in_action = 0;
-
-	    /* Loop over every single image of the current action */
-	    for (unsigned int j = 0; j < ACC_CALLS_PER_ACTION; j++) {
-	    	numberOfColumnsVec[i+j] = vecInputImage.at(i+j).numberOfColumns;
-	    	cols[j] = numberOfColumnsVec[i+j];
-	    	log(LOG_DEBUG) << "DEBUG: numberOfColumnsVec[" << i+j << "] = " << cols[j] << ", total_pixels_in_action = " <<  total_pixels_in_action << std::endl;
-#if IMG_FLOAT_TO_FIXED_CASTING_IN_CPU == 1
-				/* Ensure that the casting space is 8-bits FIXME: No-support so far for arbitrary fixed point type for image, when casting is done in SW. */
-				assert(sizeof(DTYPE_IMG) == 1);
-	    	/* Copy actual fw/bw data of every image and cast from float to DTYPE_IMG. Then move the casted value as a raw byte on 1st byte of a float and store to buffer.
-				 * This snippet does not utilize the 2nd-4th bytes of float, leading to bandwidth underutilization at 75%. However this is only a workaround for Xilinx VHLS 2017.4
-				 * which seems to have a bug with casting in HW (the generated RTL is producing 0s, compared to v2017.2 which was ok. Nornally, casting has to be done in HW.
-				 */
-	    	for(unsigned int k = 0 ; k < numberOfColumnsVec[i+j] * HIGHT_IN_PIX; k++) {
-					float val_in_float_fw = vecInputImage.at(i+j).image_fw[k];
-					float val_in_float_bw = vecInputImage.at(i+j).image_bw[k];
-					DTYPE_IMG val_in_apfixed_fw = (DTYPE_IMG)val_in_float_fw;
-					DTYPE_IMG val_in_apfixed_bw = (DTYPE_IMG)val_in_float_bw;
-					float val_to_send_fw = 0;
-					float val_to_send_bw = 0;
-					*((DTYPE_IMG*)(&val_to_send_fw) + 0) = val_in_apfixed_fw;
-					*((DTYPE_IMG*)(&val_to_send_bw) + 0) = val_in_apfixed_bw;
-					ibuff[total_pixels_in_action + k] = val_to_send_fw;
-					ibuff[total_pixels_in_action + numberOfColumnsVec[i+j] * HIGHT_IN_PIX + k] = val_to_send_bw;
-	    		/* log(LOG_DEBUG) << "DEBUG: bw index = " << total_pixels + numberOfColumnsVec[i] * HIGHT_IN_PIX + j << ", vecInputImage.at(" << i << ").image_bw[" << j << "]=" << \
-					vecInputImage.at(i).image_bw[j] << "\n";
-	    		 */
-	    	}
-#else
-				memcpy(ibuff + total_pixels_in_action, vecInputImage.at(i+j).image_fw, (numberOfColumnsVec[i+j] * HIGHT_IN_PIX) * sizeof(float));
-				memcpy(ibuff + total_pixels_in_action + numberOfColumnsVec[i+j] * HIGHT_IN_PIX, vecInputImage.at(i+j).image_bw, (numberOfColumnsVec[i+j] * HIGHT_IN_PIX) * sizeof(float));
-#endif
-			/* Update the number of pixels */
-	    	total_pixels_in_action += 2 * numberOfColumnsVec[i+j] * HIGHT_IN_PIX;
-	    	log(LOG_INFO) << "INFO: numberOfColumnsVec[" << i+j << "] = " <<  numberOfColumnsVec[i+j] << std::endl;
-	    }
-
-	    size_in = total_pixels_in_action*sizeof(float);
-
-	    if (DEBUG_LEVEL >= LOG_INFO) printf("ACTION PARAMETERS:\n");
-        for (unsigned int j = 0; j < ACC_CALLS_PER_ACTION; j++)
-		    if (DEBUG_LEVEL >= LOG_INFO) printf(	"  input image %u: %s, %u columns, %u fw-bw pixels, %u bytes\n", i+j, \
-                filenames[i+j], numberOfColumnsVec[i+j], 2*numberOfColumnsVec[i+j]*HIGHT_IN_PIX,\
-                (unsigned int)(2*numberOfColumnsVec[i+j]*HIGHT_IN_PIX*sizeof(float)));
-		if (DEBUG_LEVEL >= LOG_INFO) printf(	"  output:      %s\n"
-			"  type_in:     %x %s\n"
-			"  addr_in:     %016llx\n"
-			"  type_out:    %x %s\n"
-			"  addr_out:    %016llx\n"
-			"  size_in:     %u (0x%08lx)\n"
-			"  size_out:    %u (0x%08lx)\n",
-			output ? output : "not-provided",
-					type_in,  mem_tab[type_in],  (long long)addr_in,
-					type_out, mem_tab[type_out], (long long)addr_out,
-					(unsigned int)size_in, size_in, (unsigned int)size_out, size_out);
-
-
-		snap_prepare_blstm(&cjob, &mjob,
-				(void *)addr_in,  size_in, type_in,
-				(void *)addr_out, size_out, type_out,
-				cols);
-
-		if (DEBUG_LEVEL >= LOG_INFO) __hexdump(stderr, &mjob, sizeof(mjob));
-
-		gettimeofday(&stime[i], NULL);
-		rc = snap_action_sync_execute_job(action, &cjob, timeout);
-
-		gettimeofday(&etime[i], NULL);
-		if (rc != 0) {
-			if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: job execution %d: %s!\n", rc,
-					strerror(errno));
-			snap_detach_action(action);
+	std::vector<struct card_ctx *> cards;
+	for (unsigned int n = 0; n < card_nos.size(); n++) {
+		struct card_ctx *c = new card_ctx();
+		c->card_no = card_nos[n];
+
+		snprintf(device, sizeof(device)-1, "/dev/cxl/afu%d.0s", c->card_no);
+		c->card = snap_card_alloc_dev(device, SNAP_VENDOR_ID_IBM,
+				 SNAP_DEVICE_ID_SNAP);
+		if (c->card == NULL) {
+			/* With "all", cards which cannot be opened are simply not there */
+			if (all_cards) {
+				delete c;
+				continue;
+			}
+			if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: failed to open card /dev/cxl/afu%u.0s: %s\n",
+					c->card_no, strerror(errno));
 			exit(EXIT_FAILURE);
 		}
 
-		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: Accelerator returned code on MMIO (AXILite job struct field) : %u\n", mjob.status );
-
-		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: AXI transactions registered on MMIO : In: %u(0x%x), Out: %u(0x%x)  \n", \
-				mjob.axitrans_in, mjob.axitrans_in, mjob.axitrans_out, mjob.axitrans_out);
-
-
-		if (DEBUG_LEVEL >= LOG_INFO) __hexdump(stderr, &mjob, sizeof(mjob));
-
-
-		unsigned int str_addr_index = 0;
-		for (unsigned int j = 0; j < ACC_CALLS_PER_ACTION; j++) {
-			vecPredictedStringLen[i+j] = mjob.imgstrlen.cols[j];
-			log(LOG_DEBUG) << "DEBUG tb: vecPredictedStringLen[" << i+j << "] = " << mjob.imgstrlen.cols[j] << std::endl;
-			for (unsigned int l = 0; l < vecPredictedStringLen[i+j]; l++) {
-				vecPredictedStringInd[i+j][l] = obuff[str_addr_index];
-				/* log(LOG_DEBUG) << "DEBUG tb: vecPredictedStringInd[" << i+j << "][" << l <<\
-						"] = obuff["<< str_addr_index << "] = " << obuff[str_addr_index] << std::endl;
-				*/
-				str_addr_index++;
-			}
-
-
-		    /* If the output buffer is in host DRAM we can write it to a file */
-		    if (output != NULL) {
-			    if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: writing output data %p %u uintegers to %s\n",
-					obuff, vecPredictedStringLen[i+j], output);
-
-			    rc = file_write(output, filenames[i+j], vecPredictedStringInd[i+j], vecPredictedStringLen[i+j]*sizeof(unsigned int));
-			    if (rc != (int)(vecPredictedStringLen[i+j])) {
-			        log(LOG_ERROR) << "Error on writing the exact number of indexes to " << output << std::endl;
-			    }
-		    }
+		c->action = snap_attach_action(c->card, BLSTM_ACTION_TYPE, action_irq, 60);
+		if (c->action == NULL) {
+			if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: failed to attach action %u: %s\n",
+					c->card_no, strerror(errno));
+			snap_card_free(c->card);
+			exit(EXIT_FAILURE);
 		}
 
+		/* source buffer */
+		c->ibuff = (float*)snap_malloc(size_in);
+		if (c->ibuff == NULL) {
+			log(LOG_ERROR) << "Error on allocating ibuf. Aborting...\n";
+			exit(EXIT_FAILURE);
+		}
+		memset(c->ibuff, 0x0, size_in);
 
-		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: RETC=%x\n", cjob.retc);
-		if (cjob.retc != SNAP_RETC_SUCCESS) {
-			if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Unexpected RETC=%x!\n", cjob.retc);
-			snap_detach_action(action);
+		/* output buffer */
+		c->obuff = (unsigned int*)snap_malloc(size_out);
+		if (c->obuff == NULL) {
+			log(LOG_ERROR) << "Error on allocating obuf. Aborting...\n";
 			exit(EXIT_FAILURE);
 		}
 
-		if (DEBUG_LEVEL >= LOG_INFO) fprintf(stdout, "INFO: SNAP run %u blstm took %lld usec\n",
-				i, (long long)timediff_usec(&etime[i], &stime[i]));
+		/* The image of the batches in card DRAM */
+		if (staged) {
+			c->sbuff = (uint8_t *)snap_malloc(size_staged);
+			if (c->sbuff == NULL) {
+				log(LOG_ERROR) << "Error on allocating the staging buffer. Aborting...\n";
+				exit(EXIT_FAILURE);
+			}
+		}
 
+		/* Keep the buffers of the low-latency mode resident: no page fault nor swap on the path of a line */
+		if (latency) {
+			memset(c->obuff, 0x0, size_out);
+			if (((mlock(c->ibuff, size_in) != 0) || (mlock(c->obuff, size_out) != 0)) && (DEBUG_LEVEL >= LOG_WARNING))
+				fprintf(stderr, "WARNING: cannot lock the buffers of card %d in memory: %s\n", c->card_no, strerror(errno));
+		}
 
-	} /* for list of images += ACC_CALLS_PER_ACTION */
+		cards.push_back(c);
+	}
 
-	snap_detach_action(action);
-	snap_card_free(card);
+	if (cards.empty()) {
+		if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: no card could be opened\n");
+		exit(EXIT_FAILURE);
+	}
 
-	__free(ibuff);
-	__free(obuff);
+	if (model_dir != NULL)
+		for (unsigned int n = 0; n < cards.size(); n++)
+			if (card_load_model(cards[n], model, timeout) != 0) {
+				if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, "err: failed to load the model %s on card %d\n", model_dir, cards[n]->card_no);
+				exit(EXIT_FAILURE);
+			}
 
-	/* free the filenames */
-	for(unsigned int i = 0; i < listOfImages.size(); i++)
-		free(filenames[i]);
-	free(filenames);
+	/* Main loop over the provided image dataset: one completion thread per card,
+	 * all of them taking actions from the same queue until the dataset is done. */
+	sched.source = &source;
+	sched.output = output;
+	sched.timeout = timeout;
+	sched.informat = informat;
+	sched.check_quant = check_quant;
+	sched.quant_errors = 0;
+	sched.score = &score;
+	sched.sink = (output != NULL) ? &sink : NULL;
+	sched.cache = (cache_dir != NULL) ? &cache : NULL;
+	sched.verify = verify ? &check : NULL;
+	sched.staged = staged;
+	sched.cards = cards.size();
+	sched.card_ns = 0;
+	sched.card_imgs = 0;
+
+	/* Scoring runs on every host thread in parallel with the cards */
+	score.closed = false;
+	score.alphabet = &alphabet;
+	score.scored = 0;
+	score.errorSum = 0.0;
+
+	std::vector<std::thread> scorers;
+	for (unsigned int n = 0; n < std::max(std::thread::hardware_concurrency(), 1u); n++)
+		scorers.push_back(std::thread(score_worker, &score));
+
+	/* The cross-check takes the host threads not driving a card, the software engine or the scoring,
+	 * one at least */
+	std::vector<std::thread> verifiers;
+	if (verify) {
+		verify_rate = std::min(std::max(verify_rate, 0.0), 1.0);
+		check.closed = false;
+		check.threshold = (uint64_t)(verify_rate * 4294967296.0);
+		check.cache = sched.cache;
+		check.sampled = 0;
+		check.dropped = 0;
+		check.checked = 0;
+		check.mismatches = 0;
+		const int spare = (int)std::thread::hardware_concurrency() - (int)cards.size() - (int)host_threads - (int)scorers.size();
+		for (int n = 0; n < std::max(spare, 1); n++)
+			verifiers.push_back(std::thread(verify_worker, &check));
+	}
 
-	// Do the translation from alphabet indexers to actual characters
-	// Since some special characters reserve 2-3 char positions, we do the translation
-	// to the SW, using string vectors, i.e. dynamic alloc, (avoiding 2D buffers on HW)
-	for(unsigned int i = 0; i < listOfImages.size(); i++) {
-		for(unsigned int j = 0; j < vecPredictedStringLen[i]; j++) {
-			std::string tmpSymbol = alphabet.ReturnSymbol(vecPredictedStringInd[i][j]);
-			vecPredictedString.at(i).insert(vecPredictedString.at(i).end(), tmpSymbol.begin(), tmpSymbol.end() );
+	std::vector<std::thread> threads;
+	if (latency) {
+		/* The polling thread owns its CPU, the scoring threads take the others */
+		threads.push_back(std::thread(latency_worker, cards[0], &sched));
+		if ((latency_cpu >= 0) && (latency_cpu < CPU_SETSIZE)) {
+			cpu_set_t cpus;
+			CPU_ZERO(&cpus);
+			CPU_SET(latency_cpu, &cpus);
+			bind_thread(threads[0].native_handle(), &cpus);
+			if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0) {
+				CPU_CLR(latency_cpu, &cpus);
+				if (CPU_COUNT(&cpus) > 0)
+					for (unsigned int n = 0; n < scorers.size(); n++)
+						bind_thread(scorers[n].native_handle(), &cpus);
+			}
 		}
 	}
-
+	else if (staged)
+		for (unsigned int n = 0; n < cards.size(); n++)
+			threads.push_back(std::thread(staged_worker, cards[n], &sched));
+	else
+		for (unsigned int n = 0; n < cards.size(); n++)
+			threads.push_back(std::thread(card_worker, cards[n], &sched));
+	/* The software engine on the host threads, if any, takes its share of the same queue */
+	std::vector<struct cpu_ctx> hosts(host_threads);
+	for (unsigned int n = 0; n < host_threads; n++) {
+		hosts[n].thread_no = n;
+		hosts[n].images = 0;
+		hosts[n].busy_ns = 0;
+		threads.push_back(std::thread(cpu_worker, &hosts[n], &sched));
+	}
+	for (unsigned int n = 0; n < threads.size(); n++)
+		threads[n].join();
 
 	// Ending point - the final time stemp
-	//auto t2 = std::chrono::high_resolution_clock::now();
-	time_t t2 = time(0);
+	const uint64_t t2 = stage_now_ns();
+
+	for (unsigned int n = 0; n < cards.size(); n++) {
+		struct card_ctx *c = cards[n];
+		log(LOG_CRITICAL) << "Card " << c->card_no << ": " << c->actions << " actions, " << c->images << " images, action time "
+				<< c->exec_ns/1000 << " us" << std::endl;
+		actions += c->actions;
+		lane_cols += c->lane_cols;
+		lane_slots += c->lane_slots;
+		snap_detach_action(c->action);
+		snap_card_free(c->card);
+		__free(c->ibuff);
+		__free(c->obuff);
+		if (c->sbuff != NULL)
+			__free(c->sbuff);
+		delete c;
+	}
+	for (unsigned int n = 0; n < host_threads; n++) {
+		log(LOG_CRITICAL) << "Host thread " << n << ": " << hosts[n].images << " images, engine time "
+				<< hosts[n].busy_ns/1000 << " us" << std::endl;
+		host_images += hosts[n].images;
+	}
+	quant_errors = sched.quant_errors;
+	if (cache_dir != NULL)
+		log(LOG_CRITICAL) << "Image cache " << cache_dir << ": " << cache.hits << " hits, " << cache.misses << " misses" << std::endl;
+
 	//====================================================================================================================================================================================================================
 	// FINISH
 	//====================================================================================================================================================================================================================
 
-
-	for(unsigned int i = 0; i < listOfImages.size(); i++) {
-
-		//----------------------------------------------------------------------
-		// Calculate Levenshtein Distance for each string and output result
-		//----------------------------------------------------------------------
-		std::string groundTruthstring = vecGroundTruth.at(i).ReturnString();
-		error[i] = LevenshteinDistance(vecPredictedString.at(i), groundTruthstring);
-		log(LOG_INFO) << i << " Expected: "<< groundTruthstring \
-				  << "\n Predicted: " << vecPredictedString.at(i) << " Accuracy: " << (1-error[i])*100 << " %\n";
-
-		log(LOG_INFO) << " Predicted id: ";
-		for(unsigned int j = 0; j < vecPredictedStringLen[i]; j++)
-			log(LOG_INFO) << vecPredictedStringInd[i][j] << " ";
-		log(LOG_INFO) << std::endl;
-
-		log(LOG_INFO) << "INFO: Accelerator status code on MMIO : " \
-				  << mjob.status << " (0x" << std::hex << mjob.status << ")" << std::dec << std::endl;
-
-		log(LOG_INFO) << "INFO: AXI transaction registered on MMIO : \nINFO: In: " \
-				  << mjob.axitrans_in  << " (0x" << std::hex << mjob.axitrans_in  << ")\nINFO: Out:" << std::dec \
-				  << mjob.axitrans_out << " (0x" << std::hex << mjob.axitrans_out << ")" << std::dec << std::endl;
-
-    	//for (unsigned int j = 0; j < sizeof(act_reg.Data.imgcols.cols)/sizeof(uint16_t); j++)
-    	//	log(LOG_INFO) << "act_reg->Data.imgcols.cols[" << j << "] = " << act_reg.Data.imgcols.cols[j] << std::endl;
-
-		//error[i] = LevenshteinDistanceCStyle(predictedString.c_str(), groundTruthstring.c_str());
-
-		#if PROFILE
-			log(LOG_INFO) << vecPredictedString.at(i) << std::endl;
-			log(LOG_INFO) << groundTruthstring << std::endl << std::endl;
-		#endif
-
-		vecPredictedString.at(i).clear();
-		groundTruthstring.clear();
-		if (i%ACC_CALLS_PER_ACTION == 0)
-			snap_action_total_time += (long long)timediff_usec(&etime[i], &stime[i]);
-		//groundTruth.Free();
+	/* No more images to come: let the cross-check and the scoring threads drain their queues */
+	if (verify) {
+		{
+			std::lock_guard<std::mutex> guard(check.lock);
+			check.closed = true;
+			check.ready.notify_all();
+		}
+		for (unsigned int n = 0; n < verifiers.size(); n++)
+			verifiers[n].join();
+	}
+	{
+		std::lock_guard<std::mutex> guard(score.lock);
+		score.closed = true;
+		score.ready.notify_all();
 	}
+	for (unsigned int n = 0; n < scorers.size(); n++)
+		scorers[n].join();
 
-	for(unsigned int e = 0; e < listOfImages.size(); e++)
-		errorSum += error[e];
+	if ((output != NULL) && (sink.Close() != 0)) {
+		log(LOG_ERROR) << "Error on writing the predicted labels to " << output << std::endl;
+		exit_code = EXIT_FAILURE;
+	}
 
-	accuracy = (1.0 - errorSum / (float)listOfImages.size()) * 100.0;
+	imgs = source.Taken();
+	if (score.scored > 0)
+		accuracy = (1.0 - score.errorSum / (double)score.scored) * 100.0;
 	log(LOG_CRITICAL) << "Accuracy: " <<  accuracy << "%" << std::endl;
 
-	errorSum = 0.0;
-
-	//std::chrono::seconds time_span = std::chrono::duration_cast<std::chrono::seconds>(t2-t1);
-	double time_span = difftime( t2, t1);
-
-	for(unsigned int i = 0; i < listOfImages.size(); i++)
-		free (vecPredictedStringInd[i]);
-	free(vecPredictedStringInd);
-	free(vecPredictedStringLen);
+	if (verify) {
+		const unsigned int checked = check.checked, mismatches = check.mismatches;
+		log(LOG_CRITICAL) << "Cross-check on the host: " << checked << " of " << check.sampled << " sampled images (rate " << verify_rate
+				<< ", " << check.dropped << " dropped), " << mismatches << " mismatches ("
+				<< (checked ? 100.0 * mismatches / checked : 0.0) << "%)" << std::endl;
+		if (checked && ((double)mismatches / checked > verify_max)) {
+			log(LOG_ERROR) << "Cross-check: more than " << 100.0 * verify_max << "% of the images mismatch" << std::endl;
+			exit_code = EXIT_FAILURE;
+		}
+	}
 
-	gettimeofday(&etime[MAX_NUMBER_IMAGES_TEST_SET], NULL);
+	if (check_quant) {
+		log(LOG_CRITICAL) << "Quantizer (" << quantize_img_path() << ") check: " << quant_errors << " pixels differ from the DTYPE_IMG cast" << std::endl;
+		if (quant_errors)
+			exit_code = EXIT_FAILURE;
+	}
 
+	const uint64_t time_span = t2 - t1;
+	const uint64_t time_all = stage_now_ns() - t_all;
+	/* The low-latency mode times the whole path of a line, see latency_worker() */
+	const uint64_t snap_action_total_time = stage_total_ns(latency ? STAGE_LINE : STAGE_EXECUTE);
 
-  log(LOG_CRITICAL) << "Measured time ... " << time_span << " seconds (" <<
-  (long long)timediff_usec(&etime[MAX_NUMBER_IMAGES_TEST_SET], &stime[MAX_NUMBER_IMAGES_TEST_SET])
-  << " us) for " << listOfImages.size() << " images. Action time " << snap_action_total_time << " us (" <<
-  snap_action_total_time/(MAX_NUMBER_IMAGES_TEST_SET/ACC_CALLS_PER_ACTION) <<
+  log(LOG_CRITICAL) << "Measured time ... " << time_span/1e9 << " seconds (" <<
+  time_all/1000
+  << " us) for " << imgs << " images. Action time " << snap_action_total_time/1000 << " us (" <<
+  (actions ? snap_action_total_time/1000/actions : 0) <<
   " us per action -> " << ACC_CALLS_PER_ACTION << " images, ~" <<
-   snap_action_total_time/MAX_NUMBER_IMAGES_TEST_SET
+   ((imgs > host_images) ? snap_action_total_time/1000/(imgs - host_images) : 0)
    << " us / image)" << std::endl << std::endl;
 
-	//----------------------------------------------------------------------
-	// END
-	//----------------------------------------------------------------------
-
-
-    if (cjob.retc  == SNAP_RETC_FAILURE) {
-	    if (DEBUG_LEVEL >= LOG_CRITICAL) fprintf(stderr, " ==> RETURN CODE FAILURE <==\n");
-	    return 1;
-    }
+	/* The share of the columns the parallel kernel instances spend on actual images */
+	const double lane_utilization = lane_slots ? (double)lane_cols / (double)lane_slots * 100.0 : 0.0;
+	log(LOG_CRITICAL) << "Kernel instance utilization: " << lane_utilization << "% (" << ACC_CALLS_PER_ACTION
+			<< " images per action, reorder window " << window << ")" << std::endl;
 
+	if (DEBUG_LEVEL >= LOG_CRITICAL) stage_print(stdout);
 
+	if (json != NULL) {
+		FILE *fp = fopen(json, "w");
+		if (!fp) {
+			if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot open file %s for writing: %s\n",
+					json, strerror(errno));
+			exit_code = EXIT_FAILURE;
+		}
+		else {
+			fprintf(fp, "{\n"
+					"  \"images\": %u,\n"
+					"  \"actions\": %u,\n"
+					"  \"cards\": %u,\n"
+					"  \"host_threads\": %u,\n"
+					"  \"host_images\": %u,\n"
+					"  \"acc_calls_per_action\": %u,\n"
+					"  \"informat\": \"%s\",\n"
+					"  \"accuracy\": %f,\n"
+					"  \"reorder_window\": %u,\n"
+					"  \"lane_utilization\": %f,\n"
+					"  \"verified\": %u,\n"
+					"  \"verify_mismatches\": %u,\n"
+					"  \"inference_ns\": %llu,\n"
+					"  \"wall_ns\": %llu,\n"
+					"  \"stages\": {\n",
+					imgs, actions, (unsigned int)cards.size(), host_threads, host_images, ACC_CALLS_PER_ACTION, (informat == IN_FMT_PACKED8) ? "packed8" : "float32",
+					accuracy, window, lane_utilization, verify ? (unsigned int)check.checked : 0, verify ? (unsigned int)check.mismatches : 0,
+					(unsigned long long)time_span, (unsigned long long)time_all);
+			stage_print_json(fp, "    ");
+			fprintf(fp, "  }\n}\n");
+			fclose(fp);
+		}
+	}
 
-    delete[] error;
+	//----------------------------------------------------------------------
+	// END
+	//----------------------------------------------------------------------
 
 
     exit(exit_code);
@@ -722,7 +1866,7 @@ int main(int argc, char *argv[])
 //====================================================================================================================================================================================================================
 
 // Constructor
-Alphabet::Alphabet()
+Alphabet::Alphabet() : offsets(), maxSymbolSize(0)
 {
 }
 
@@ -754,9 +1898,41 @@ void Alphabet::Init(std::string inputFileAlphabet)
 	if(alphabet.size() != NUMBER_OF_CLASSES)
 		std::cerr << "ERROR: Wrong Number of Aplhabetic Symbols...!" << std::endl;
 
+	// The flat symbol table of Decode()
+	symbols.clear();
+	maxSymbolSize = 0;
+	for(unsigned int l = 0; l < NUMBER_OF_CLASSES; l++) {
+		offsets[l] = symbols.size();
+		if(l < alphabet.size()) {
+			symbols += alphabet[l];
+			maxSymbolSize = std::max(maxSymbolSize, alphabet[l].size());
+		}
+	}
+	offsets[NUMBER_OF_CLASSES] = symbols.size();
+	offsets[NUMBER_OF_CLASSES + 1] = symbols.size();
+}
+
+unsigned int Alphabet::Decode(const unsigned int *labels, size_t len, std::string &out) const
+{
+	const size_t start = out.size();
+	const char *table = symbols.data();
+	unsigned int invalid = 0;
+	size_t pos = start;
+
+	out.resize(start + len * maxSymbolSize);
+	char *dst = &out[0];
+	for(size_t j = 0; j < len; j++) {
+		const unsigned int l = (labels[j] < NUMBER_OF_CLASSES) ? labels[j] : NUMBER_OF_CLASSES;
+		const unsigned int n = offsets[l + 1] - offsets[l];
+		invalid += (l == NUMBER_OF_CLASSES);
+		memcpy(dst + pos, table + offsets[l], n);
+		pos += n;
+	}
+	out.resize(pos);
+	return invalid;
 }
 
-std::string Alphabet::ReturnSymbol(unsigned int label)
+std::string Alphabet::ReturnSymbol(unsigned int label) const
 {
 	if(label < NUMBER_OF_CLASSES)
 		return alphabet.at(label);
@@ -795,6 +1971,8 @@ void Alphabet::Print()
 InputImage::InputImage()
 {
 	numberOfColumns = 0;
+	image_fw = NULL;
+	image_bw = NULL;
 }
 
 // Destructor
@@ -814,6 +1992,11 @@ InputImage::~InputImage()
 }
 
 void InputImage::Init(std::string inputFileImage)
+{
+	Parse(Load(inputFileImage));
+}
+
+std::string InputImage::Load(std::string inputFileImage)
 {
 	std::ifstream inputStream;
 	inputStream.open(inputFileImage, std::ifstream::in);
@@ -822,9 +2005,19 @@ void InputImage::Init(std::string inputFileImage)
 	{
 		std::cerr << "ERROR: Failed to open " << inputFileImage << std::endl;
 		exit(BLSTM_TB_FAILURE);
-		return;
 	}
 
+	std::stringstream text;
+	text << inputStream.rdbuf();
+	inputStream.close();
+
+	return text.str();
+}
+
+void InputImage::Parse(const std::string &text)
+{
+	std::istringstream inputStream(text);
+
 	// Temporal structure to store image
 	std::vector<float> tmp;
 	float pix;
@@ -834,8 +2027,6 @@ void InputImage::Init(std::string inputFileImage)
 		tmp.push_back(pix);
 	}
 
-	inputStream.close();
-
 	// Number of columns of the image has to be a multiple of HIGHT_IN_PIX
 	if(tmp.size() % HIGHT_IN_PIX != 0)
 	{
@@ -844,8 +2035,16 @@ void InputImage::Init(std::string inputFileImage)
 		return;
 	}
 
-	numberOfColumns = tmp.size() / HIGHT_IN_PIX;
+	SetPixels(tmp.data(), tmp.size() / HIGHT_IN_PIX);
+
+	tmp.clear();
+}
+
+void InputImage::SetPixels(const float *pixels, unsigned int cols)
+{
+	numberOfColumns = cols;
 
+	Free();
 	image_fw = new float [numberOfColumns * HIGHT_IN_PIX];
 	image_bw = new float [numberOfColumns * HIGHT_IN_PIX];
 
@@ -853,15 +2052,13 @@ void InputImage::Init(std::string inputFileImage)
 	{
 		for(unsigned int row = 0; row < HIGHT_IN_PIX; row++)
 		{
-			image_fw[col * HIGHT_IN_PIX + row] = tmp.at(col * HIGHT_IN_PIX + row);
+			image_fw[col * HIGHT_IN_PIX + row] = pixels[col * HIGHT_IN_PIX + row];
 
 			// Creat an image for backward processing: mirror the columns of the forward image
-			//image_bw[col * HIGHT_IN_PIX + row] = tmp.at((numberOfColumns - col - 1) * HIGHT_IN_PIX + row);
-			image_bw[col * HIGHT_IN_PIX + row] = tmp.at((numberOfColumns - col - 1) * HIGHT_IN_PIX + (row));
+			//image_bw[col * HIGHT_IN_PIX + row] = pixels[(numberOfColumns - col - 1) * HIGHT_IN_PIX + row];
+			image_bw[col * HIGHT_IN_PIX + row] = pixels[(numberOfColumns - col - 1) * HIGHT_IN_PIX + (row)];
 		}
 	}
-
-	tmp.clear();
 }
 
 void InputImage::Free()
@@ -953,24 +2150,23 @@ std::vector<std::string> open(std::string path)
 
 	dir = opendir(path.empty() ? "." : path.c_str());
 
+	if (dir == NULL) {
+		std::cerr << "ERROR: Failed to open directory " << path << " Aborting..." << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
 	while ( (pdir = readdir(dir) )) {
-			/* std::cout << "pushed " << pdir->d_name << std::endl; */
-			files.push_back(pdir->d_name);
+			/* skip '.', '..' and hidden files */
+			if (pdir->d_name[0] != '.')
+				files.push_back(pdir->d_name);
 	}
 
 	closedir(dir);
 
 	std::sort(files.begin(), files.end());
-	files.erase(files.begin(), files.begin()+2);
 
 	log(LOG_INFO) << "INFO: Read " << (files.end() - files.begin()) << " files from path " <<  path << std::endl;
 
-	if ((files.end() - files.begin()) > MAX_NUMBER_IMAGES_TEST_SET) {
-		log(LOG_WARNING) << "WARNING: Max number of files reached (MAX_NUMBER_IMAGES_TEST_SET = " \
-				  << MAX_NUMBER_IMAGES_TEST_SET << " )" << std::endl;
-		files.erase((files.begin() + MAX_NUMBER_IMAGES_TEST_SET), files.end());
-	}
-
 	return files;
 }
 
@@ -980,28 +2176,13 @@ std::vector<std::string> open(std::string path)
 
 	double LevenshteinDistance(const std::string& s1, const std::string& s2)
 	{
-		const std::size_t len1 = s1.size(), len2 = s2.size();
-		std::vector<unsigned int> col(len2+1), prevCol(len2+1);
-
-		for (unsigned int i = 0; i < prevCol.size(); i++)
-			prevCol[i] = i;
-		for (unsigned int i = 0; i < len1; i++)
-		{
-			col[0] = i+1;
-			for (unsigned int j = 0; j < len2; j++)
-			{
-				//col[j+1] = std::min({ prevCol[1 + j] + 1, col[j] + 1, prevCol[j] + (s1[i]==s2[j] ? 0 : 1) });
-
-				col[j+1] = std::min(prevCol[1 + j] + 1, std::min(col[j] + 1, prevCol[j] + (s1[i]==s2[j] ? 0 : 1)));
-			}
-
-			col.swap(prevCol);
-		}
+		/* Bit-parallel, see levenshtein.h */
+		const unsigned int distance = levenshtein_bitpar(s1.data(), s1.size(), s2.data(), s2.size());
 		#if PROFILE
-			std::cout << prevCol[len2] << std::endl;
+			std::cout << distance << std::endl;
 		#endif
 
-		return (double)prevCol[len2] / (double)s2.size();
+		return (double)distance / (double)s2.size();
 	}
 
 	double LevenshteinDistanceCStyle(const char *s1, const char *s2)
@@ -1028,49 +2209,3 @@ std::vector<std::string> open(std::string path)
 
 	    return (double)(column[s1len]) / (double)s1len;
 	}
-
-
-
-
-
-static inline ssize_t
-file_write(const char *fname_out, const char *fname_in, const uint32_t *buff, size_t len)
-{
-	int rc=0;
-	FILE *fp;
-	unsigned int i;
-	if ((fname_out == NULL) || (buff == NULL))
-		return -EINVAL;
-	fp = fopen(fname_out, "a");
-	if (!fp) {
-		if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot open file %s: %s\n",
-				fname_out, strerror(errno));
-        return -ENODEV;
-	}
-
-	if (DEBUG_LEVEL >= LOG_INFO) rc = fprintf(fp, "Output from file : %s, %u characters\n", fname_in, (unsigned int)(len/sizeof(unsigned int)));
-
-	if (rc == -1) {
-              if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot write to %s: %s\n",
-            		  fname_out, strerror(errno));
-              fclose(fp);
-              return -EIO;
-	}
-
-	for (i = 0; i < len/sizeof(unsigned int); i++) {
-		if (DEBUG_LEVEL >= LOG_INFO) rc = fprintf(fp, "%u\n", buff[i]);
-		//rc = fwrite(buff, len, 1, fp);
-		if (rc == -1) {
-			if (DEBUG_LEVEL >= LOG_ERROR) fprintf(stderr, "err: Cannot write to %s: %s\n",
-					fname_out, strerror(errno));
-			fclose(fp);
-			return -EIO;
-		}
-	}
-	fclose(fp);
-
-	if (len != 0)
-		return i;
-	else
-		return 0;
-}
@@ -35,7 +35,6 @@
 
 
 /* Function prototypes */
-static inline ssize_t file_write(const char *fname_out, const char *fname_in, const uint32_t *buff, size_t len);
 std::vector<std::string> open(std::string path);
 
 
@@ -57,14 +56,26 @@ std::vector<std::string> open(std::string path);
 		unsigned int size;
 		void Init(std::string inputFileAlphabet);
 
-		std::string ReturnSymbol(unsigned int lable);
+		std::string ReturnSymbol(unsigned int lable) const;
 		//char ReturnSymbol(unsigned int lable);
 
+		// Appends the UTF-8 string of a label sequence to out in one pass, without allocating
+		// once out has grown to len * MaxSymbolSize(). Returns the number of out of range labels,
+		// which decode to nothing.
+		unsigned int Decode(const unsigned int *labels, size_t len, std::string &out) const;
+		size_t MaxSymbolSize() const { return maxSymbolSize; }
+
 		void Print();
 
 		protected:
 
 		private:
+
+		// All symbols back to back, symbol l at symbols[offsets[l]] up to symbols[offsets[l+1]].
+		// Entry NUMBER_OF_CLASSES is the empty symbol the out of range labels are mapped to.
+		std::string symbols;
+		unsigned int offsets[NUMBER_OF_CLASSES + 2];
+		size_t maxSymbolSize;
 	};
 
 
@@ -89,6 +100,12 @@ std::vector<std::string> open(std::string path);
 
 		void Init(std::string inputFileImage);
 
+		// Init split in its file read and text parse, so that both can be timed
+		static std::string Load(std::string inputFileImage);
+		void Parse(const std::string &text);
+		// Takes numberOfColumns * HIGHT_IN_PIX pixels, column after column, e.g. of an ingested image
+		void SetPixels(const float *pixels, unsigned int cols);
+
 		void Print();
 
 		void Free();
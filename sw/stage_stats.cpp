@@ -0,0 +1,146 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file stage_stats.cpp
+ * @brief Latency histograms of the host stages of snap_blstm.
+ *
+ * A sample v lands in bucket v for v < 2^STAGE_SUB_BITS, otherwise in one of the
+ * 2^STAGE_SUB_BITS equal sub-buckets of its power of two. Percentiles report the upper
+ * bound of their bucket, clamped to the exact maximum.
+ */
+
+#include <time.h>
+
+#include <atomic>
+
+#include "stage_stats.hpp"
+
+#define STAGE_SUB_BITS 4
+#define STAGE_SUBS (1 << STAGE_SUB_BITS)
+#define STAGE_BUCKETS ((64 - STAGE_SUB_BITS + 1) << STAGE_SUB_BITS)
+
+struct stage_hist {
+	std::atomic<uint64_t> count;
+	std::atomic<uint64_t> total;
+	std::atomic<uint64_t> max;
+	std::atomic<uint64_t> bucket[STAGE_BUCKETS];
+};
+
+static stage_hist hist[STAGE_NUM];
+
+static const char *stage_names[STAGE_NUM] = {
+	"load", "parse", "pack", "execute", "copy", "cpu", "line", "unpack", "decode", "write", "score"
+};
+
+static inline unsigned int bucket_of(uint64_t v)
+{
+	if (v < STAGE_SUBS)
+		return (unsigned int)v;
+	unsigned int msb = 63 - __builtin_clzll(v);
+	return ((msb - STAGE_SUB_BITS + 1) << STAGE_SUB_BITS) + (unsigned int)((v >> (msb - STAGE_SUB_BITS)) & (STAGE_SUBS - 1));
+}
+
+/* The largest value of a bucket */
+static inline uint64_t bucket_upper(unsigned int b)
+{
+	if (b < STAGE_SUBS)
+		return b;
+	unsigned int msb = (b >> STAGE_SUB_BITS) + STAGE_SUB_BITS - 1;
+	uint64_t width = 1ull << (msb - STAGE_SUB_BITS);
+	return (1ull << msb) + (b & (STAGE_SUBS - 1)) * width + (width - 1);
+}
+
+static uint64_t percentile(const stage_hist &h, double p)
+{
+	uint64_t count = h.count.load();
+	uint64_t rank = (uint64_t)(p / 100.0 * (double)count + 0.999999);
+	uint64_t seen = 0;
+
+	if (rank == 0)
+		rank = 1;
+	for (unsigned int b = 0; b < STAGE_BUCKETS; b++) {
+		seen += h.bucket[b].load();
+		if (seen >= rank) {
+			uint64_t v = bucket_upper(b);
+			return (v < h.max.load()) ? v : h.max.load();
+		}
+	}
+	return h.max.load();
+}
+
+uint64_t stage_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t stage_record(stage_t stage, uint64_t start_ns)
+{
+	uint64_t now = stage_now_ns();
+	uint64_t ns = now - start_ns;
+	stage_hist &h = hist[stage];
+	uint64_t max = h.max.load();
+
+	h.count++;
+	h.total += ns;
+	h.bucket[bucket_of(ns)]++;
+	while ((ns > max) && !h.max.compare_exchange_weak(max, ns))
+		;
+	return now;
+}
+
+uint64_t stage_total_ns(stage_t stage)
+{
+	return hist[stage].total.load();
+}
+
+void stage_print(FILE *fp)
+{
+	fprintf(fp, "%-8s %8s %12s %10s %10s %10s %10s %10s\n",
+			"stage", "count", "total_us", "mean_us", "p50_us", "p90_us", "p99_us", "max_us");
+	for (unsigned int s = 0; s < STAGE_NUM; s++) {
+		const stage_hist &h = hist[s];
+		uint64_t count = h.count.load();
+		if (count == 0)
+			continue;
+		fprintf(fp, "%-8s %8llu %12.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", stage_names[s],
+				(unsigned long long)count, h.total.load() / 1e3, h.total.load() / 1e3 / count,
+				percentile(h, 50) / 1e3, percentile(h, 90) / 1e3, percentile(h, 99) / 1e3, h.max.load() / 1e3);
+	}
+}
+
+void stage_print_json(FILE *fp, const char *indent)
+{
+	bool first = true;
+
+	for (unsigned int s = 0; s < STAGE_NUM; s++) {
+		const stage_hist &h = hist[s];
+		uint64_t count = h.count.load();
+		fprintf(fp, "%s%s\"%s\": { \"count\": %llu, \"total_ns\": %llu, \"mean_ns\": %llu, "
+				"\"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, \"max_ns\": %llu }",
+				first ? "" : ",\n", indent, stage_names[s], (unsigned long long)count,
+				(unsigned long long)h.total.load(), (unsigned long long)(count ? h.total.load() / count : 0),
+				(unsigned long long)(count ? percentile(h, 50) : 0), (unsigned long long)(count ? percentile(h, 90) : 0),
+				(unsigned long long)(count ? percentile(h, 99) : 0), (unsigned long long)h.max.load());
+		first = false;
+	}
+	fprintf(fp, "\n");
+}
@@ -0,0 +1,81 @@
+/****************************************************************************
+   Copyright 2017 - The OPRECOMP Project Consortium,
+                    IBM Research GmbH, University of Kaiserslautern,
+                    All rights reserved.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+****************************************************************************/
+
+/**
+ * @file stage_stats.hpp
+ * @brief Latency histograms of the host stages of snap_blstm, on a monotonic
+ * nanosecond clock. Every stage keeps a log-linear histogram (16 sub-buckets per
+ * power of two, i.e. percentiles within ~6%), so memory does not grow with the
+ * dataset. Recording is thread-safe.
+ */
+
+#ifndef STAGE_STATS_HPP
+#define STAGE_STATS_HPP
+
+#include <stdio.h>
+#include <stdint.h>
+
+/** The host stages being timed */
+typedef enum {
+	STAGE_LOAD = 0,		/* reading an image file */
+	STAGE_PARSE,		/* parsing the text of an image to floats, or decoding and normalizing an image file */
+	STAGE_PACK,		/* quantizing/packing the images of an action into the input buffer */
+	STAGE_EXECUTE,		/* executing an action */
+	STAGE_COPY,		/* copying a batch of actions to or from the card DRAM (option -S) */
+	STAGE_CPU,		/* inferring an image on the software engine of the host (option -H) */
+	STAGE_LINE,		/* packing, executing and unpacking one line in the low-latency mode (option -L) */
+	STAGE_UNPACK,		/* copying the labels of an action out of the output buffer */
+	STAGE_DECODE,		/* translating the labels of an image to its string */
+	STAGE_WRITE,		/* writing the labels of an image to the output file */
+	STAGE_SCORE,		/* reading the ground truth of an image and its Levenshtein distance */
+	STAGE_NUM
+} stage_t;
+
+/**
+ * @brief The current time of the monotonic clock in ns.
+ */
+uint64_t stage_now_ns(void);
+
+/**
+ * @brief Record one sample of a stage, from start_ns until now.
+ * @param stage The stage.
+ * @param start_ns The time the stage started, from stage_now_ns().
+ * @return The current time, so that consecutive stages can be chained.
+ */
+uint64_t stage_record(stage_t stage, uint64_t start_ns);
+
+/**
+ * @brief The sum of all samples of a stage in ns.
+ */
+uint64_t stage_total_ns(stage_t stage);
+
+/**
+ * @brief Print count, total, mean, p50/p90/p99 and max of every stage that has samples.
+ * @param fp The stream to print to.
+ */
+void stage_print(FILE *fp);
+
+/**
+ * @brief Print the stages as the members of a JSON object, e.g.
+ * "load": { "count": 20, "total_ns": ..., "p50_ns": ..., ... }, ...
+ * @param fp The stream to print to.
+ * @param indent The indentation of every member.
+ */
+void stage_print_json(FILE *fp, const char *indent);
+
+#endif /* STAGE_STATS_HPP */